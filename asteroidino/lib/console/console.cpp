@@ -0,0 +1,138 @@
+/*
+ * console.cpp - Line console task
+ *
+ * The task only ever looks at what has already arrived: Serial bytes
+ * are collected into a line buffer, UDP datagrams are taken whole (one
+ * or more lines). A finished line is split into words and handed to
+ * the matching handler; the reply goes back over the same channel.
+ * Handlers run in this task, so they must only read counters and set
+ * values that the emulation and the display pick up on their own.
+ */
+
+#include "../../src/config.h"  // MUST be first for CONSOLE_*
+#include "console.h"
+
+#if CONSOLE_ENABLE
+
+#if CONSOLE_UDP
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#endif
+
+#define CONSOLE_MAX_ARGS   8
+#define CONSOLE_REPLY_MAX  1024
+
+static const ConsoleCommand* console_commands = nullptr;
+static int console_count = 0;
+
+static size_t console_help(char* out, size_t cap) {
+    size_t len = snprintf(out, cap, "Commands:\n");
+    for (int i = 0; i < console_count && len < cap; i++) {
+        const ConsoleCommand& c = console_commands[i];
+        char head[40];
+        snprintf(head, sizeof(head), "%s %s", c.name, c.usage);
+        len += snprintf(out + len, cap - len, "  %-22s %s\n", head, c.help);
+    }
+    return len < cap ? len : cap - 1;
+}
+
+size_t console_exec(char* line, char* out, size_t cap) {
+    char* argv[CONSOLE_MAX_ARGS];
+    int argc = 0;
+    char* save = nullptr;
+    for (char* p = strtok_r(line, " \t\r\n", &save); p && argc < CONSOLE_MAX_ARGS;
+         p = strtok_r(nullptr, " \t\r\n", &save)) {
+        argv[argc++] = p;
+    }
+    out[0] = 0;
+    if (argc == 0) return 0;
+
+    if (!strcmp(argv[0], "help") || !strcmp(argv[0], "?")) return console_help(out, cap);
+    for (int i = 0; i < console_count; i++) {
+        if (!strcmp(argv[0], console_commands[i].name)) {
+            size_t len = console_commands[i].run(argc, argv, out, cap);
+            return len < cap ? len : cap - 1;
+        }
+    }
+    size_t len = snprintf(out, cap, "Unknown command '%s' (help)\n", argv[0]);
+    return len < cap ? len : cap - 1;
+}
+
+#if CONSOLE_UDP
+static WiFiUDP console_udp;
+static bool console_udp_open = false;
+
+// Every line of a datagram is a command; all replies go back in one
+static void console_poll_udp(char* reply) {
+    if (WiFi.status() != WL_CONNECTED) {
+        console_udp_open = false;
+        return;
+    }
+    if (!console_udp_open) console_udp_open = console_udp.begin(CONSOLE_UDP_PORT);
+    if (!console_udp_open || console_udp.parsePacket() <= 0) return;
+
+    static char dgram[CONSOLE_LINE_MAX * 4];
+    int n = console_udp.read((uint8_t*)dgram, sizeof(dgram) - 1);
+    if (n <= 0) return;
+    dgram[n] = 0;
+
+    size_t len = 0;
+    char* next = dgram;
+    while (next && *next && len < CONSOLE_REPLY_MAX - 1) {
+        char* line = next;
+        next = strchr(line, '\n');
+        if (next) *next++ = 0;
+        len += console_exec(line, reply + len, CONSOLE_REPLY_MAX - len);
+    }
+    if (!len) return;
+    console_udp.beginPacket(console_udp.remoteIP(), console_udp.remotePort());
+    console_udp.write((const uint8_t*)reply, len);
+    console_udp.endPacket();
+}
+#endif
+
+static void console_task(void* parameter) {
+    static char line[CONSOLE_LINE_MAX];
+    static char reply[CONSOLE_REPLY_MAX];
+    size_t len = 0;
+
+    while (true) {
+        while (Serial.available() > 0) {
+            int c = Serial.read();
+            if (c == '\r' || c == '\n') {
+                if (!len) continue;
+                line[len] = 0;
+                len = 0;
+                size_t n = console_exec(line, reply, sizeof(reply));
+                if (n) Serial.write((const uint8_t*)reply, n);
+            } else if (len < sizeof(line) - 1) {
+                line[len++] = c;
+            }
+        }
+#if CONSOLE_UDP
+        console_poll_udp(reply);
+#endif
+        vTaskDelay(pdMS_TO_TICKS(CONSOLE_POLL_MS));
+    }
+}
+
+void console_begin(const ConsoleCommand* commands, int count) {
+    console_commands = commands;
+    console_count = count;
+
+#if CONSOLE_UDP
+    // Shares the network of the vector logger; join it if nobody did
+    if (WiFi.getMode() == WIFI_OFF) {
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(VECTOR_LOG_WIFI_SSID, VECTOR_LOG_WIFI_PASS);
+    }
+#endif
+    xTaskCreatePinnedToCore(console_task, "console", 4096, NULL, 1, NULL, 1);
+#if CONSOLE_UDP
+    Serial.printf("Console: %d commands on Serial and UDP port %d (help)\n", count, CONSOLE_UDP_PORT);
+#else
+    Serial.printf("Console: %d commands on Serial (help)\n", count);
+#endif
+}
+
+#endif // CONSOLE_ENABLE
@@ -0,0 +1,48 @@
+/*
+ * console.h - Befehlskonsole über Serial und UDP
+ *
+ * Eine Task niedriger Priorität auf Core 1 fragt alle CONSOLE_POLL_MS
+ * Serial (und mit CONSOLE_UDP einen UDP-Port) ab, ohne zu blockieren,
+ * und führt vollständige Zeilen über die Befehlstabelle der Anwendung
+ * aus. Handler schreiben ihre Antwort in einen Puffer (wie
+ * prof_report()); sie geht an den Kanal zurück, von dem der Befehl kam.
+ * "help" ist eingebaut und listet die Tabelle.
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef CONSOLE_ENABLE
+#error "config.h must be included before console.h"
+#endif
+
+// Handler: argv[0] is the command; format the reply into out/cap and
+// return its length
+typedef size_t (*console_handler)(int argc, char** argv, char* out, size_t cap);
+
+struct ConsoleCommand {
+    const char*     name;
+    const char*     usage;   // Arguments for "help", "" if none
+    const char*     help;
+    console_handler run;
+};
+
+#if CONSOLE_ENABLE
+
+// Start the console task with a command table (call once from setup)
+void console_begin(const ConsoleCommand* commands, int count);
+
+// Run one command line (modified in place); returns the reply length
+size_t console_exec(char* line, char* out, size_t cap);
+
+#else
+
+inline void console_begin(const ConsoleCommand*, int) {}
+inline size_t console_exec(char*, char* out, size_t cap) { if (cap) out[0] = 0; return 0; }
+
+#endif
+
+#endif // CONSOLE_H
@@ -39,11 +39,25 @@ mos6502::mos6502(BusRead r, BusWrite w, ClockCycle c)
    , nmi_request(false)
    , nmi_inhibit(false)
    , nmi_line(true)
-{
-   Write = (BusWrite)w;
-   Read = (BusRead)r;
+   , instructions(0)
+   , run_cycles(0)
+   , idleCheck(nullptr)
+   , idle_branch(IDLE_NONE)
+   , idle_skipped(0)
+   , pd_cache(nullptr)
+   , pd_base(0)
+   , pd_size(0)
+{
+   busWrite = (BusWrite)w;
+   busRead = (BusRead)r;
    Cycle = (ClockCycle)c;
 
+   for(int i = 0; i < 256; i++)
+   {
+      readPage[i] = nullptr;
+      writePage[i] = nullptr;
+   }
+
    static bool initialized = false;
    if (initialized) return;
    initialized = true;
@@ -1553,6 +1567,7 @@ void mos6502::Reset()
    // do not set or clear nmi_line, that's external to us
    nmi_request = false;
    nmi_inhibit = false;
+   idle_branch = IDLE_NONE;
 
    A = reset_A;
    Y = reset_Y;
@@ -1593,6 +1608,7 @@ void mos6502::Svc_IRQ()
    StackPush(pc & 0xFF);
    StackPush((status & ~BREAK) | CONSTANT);
    SET_INTERRUPT(1);
+   idle_branch = IDLE_NONE;
 
    // load PC from interrupt request vector
    uint8_t pcl = Read(irqVectorL);
@@ -1612,6 +1628,7 @@ void mos6502::Svc_NMI()
    StackPush(pc & 0xFF);
    StackPush((status & ~BREAK) | CONSTANT);
    SET_INTERRUPT(1);
+   idle_branch = IDLE_NONE;
 
    // load PC from non-maskable interrupt vector
    uint8_t pcl = Read(nmiVectorL);
@@ -1649,14 +1666,22 @@ void mos6502::Run(
 {
    uint8_t opcode;
    Instr instr;
+   uint64_t cycles = cycleCount;
+   uint32_t executed = 0;
+
+   bool idle = idleCheck && !Cycle && cycleMethod == CYCLE_COUNT;
 
    while(cyclesRemaining > 0 && !illegalOpcode)
    {
+      uint32_t elapsed = 0;
+
       if (CheckInterrupts()) {
-         cycleCount += 6; // TODO FIX verify this is correct
+         elapsed += 7;
       }
 
       // fetch
+      uint16_t op_pc = pc;
+      run_cycles = cycles;
       opcode = Read(pc++);
 
       // decode
@@ -1664,16 +1689,24 @@ void mos6502::Run(
 
       // execute
       Exec(instr);
+      executed++;
 
-      cycleCount += instr.cycles;
+      elapsed += instr.cycles;
       if (branched) {
-         cycleCount++;
+         elapsed++;
       }
       if (instr.penalty && crossed) {
-         cycleCount++;
+         elapsed++;
+      }
+      if (idle && branched && pc <= op_pc) {
+         int32_t skip = IdlePass(op_pc, pc, A, X, Y, status, sp, cycles,
+               instructions + executed, cyclesRemaining, elapsed);
+         cycles += skip;
+         cyclesRemaining -= skip;
       }
+      cycles += elapsed;
       cyclesRemaining -=
-         cycleMethod == CYCLE_COUNT        ? instr.cycles
+         cycleMethod == CYCLE_COUNT        ? elapsed
          /* cycleMethod == INST_COUNT */   : 1;
 
       // run clock cycle callback
@@ -1681,6 +1714,10 @@ void mos6502::Run(
          for(int i = 0; i < instr.cycles; i++)
             Cycle(this);
    }
+
+   cycleCount = cycles;
+   run_cycles = cycles;
+   instructions += executed;
 }
 
 void mos6502::RunEternally()
@@ -1708,6 +1745,116 @@ void mos6502::RunEternally()
    }
 }
 
+void mos6502::MapReadPages(uint8_t first, uint16_t count, const uint8_t* base)
+{
+   for(uint16_t i = 0; i < count && first + i < 256; i++)
+   {
+      readPage[first + i] = base ? base + i * 256 : nullptr;
+   }
+}
+
+void mos6502::MapWritePages(uint8_t first, uint16_t count, uint8_t* base)
+{
+   for(uint16_t i = 0; i < count && first + i < 256; i++)
+   {
+      writePage[first + i] = base ? base + i * 256 : nullptr;
+   }
+}
+
+void mos6502::SetIdleCheck(IdleCheck check)
+{
+   idleCheck = check;
+   idle_branch = IDLE_NONE;
+}
+
+void mos6502::GetState(State& s)
+{
+   s.pc = pc;
+   s.A = A;
+   s.X = X;
+   s.Y = Y;
+   s.sp = sp;
+   s.status = status;
+   s.lines = (irq_line ? STATE_IRQ_LINE : 0) |
+         (nmi_line ? STATE_NMI_LINE : 0) |
+         (nmi_request ? STATE_NMI_REQUEST : 0) |
+         (nmi_inhibit ? STATE_NMI_INHIBIT : 0) |
+         (illegalOpcode ? STATE_ILLEGAL : 0);
+   s.instructions = instructions;
+   s.cycles = run_cycles;
+   s.idle_skipped = idle_skipped;
+}
+
+void mos6502::SetState(const State& s)
+{
+   pc = s.pc;
+   A = s.A;
+   X = s.X;
+   Y = s.Y;
+   sp = s.sp;
+   status = s.status;
+   irq_line = (s.lines & STATE_IRQ_LINE) != 0;
+   nmi_line = (s.lines & STATE_NMI_LINE) != 0;
+   nmi_request = (s.lines & STATE_NMI_REQUEST) != 0;
+   nmi_inhibit = (s.lines & STATE_NMI_INHIBIT) != 0;
+   illegalOpcode = (s.lines & STATE_ILLEGAL) != 0;
+   instructions = s.instructions;
+   run_cycles = s.cycles;
+   idle_skipped = s.idle_skipped;
+   idle_branch = IDLE_NONE;
+}
+
+int32_t mos6502::PollAddress(uint16_t target, uint16_t branch)
+{
+   if ((uint16_t)(target + 3) != branch) return -1;
+   uint8_t op = Read(target);
+   if (op != 0xAD && op != 0xAE && op != 0xAC && op != 0x2C) return -1;
+   return Read(target + 1) | (Read(target + 2) << 8);
+}
+
+// called on every taken backward branch, before 'elapsed' (the branch
+// itself) is accounted. returns the cycles of the passes to skip
+int32_t mos6502::IdlePass(uint16_t branch, uint16_t target,
+      uint8_t a, uint8_t x, uint8_t y, uint8_t p, uint8_t s,
+      uint64_t cycles, uint64_t executed, int32_t cyclesRemaining,
+      uint32_t elapsed)
+{
+   uint32_t regs = a | (x << 8) | (y << 16) | ((uint32_t)p << 24);
+   if (branch != idle_branch || regs != idle_regs || s != idle_sp) {
+      idle_branch = branch;
+      idle_regs = regs;
+      idle_sp = s;
+      idle_cycles = cycles;
+      idle_executed = executed;
+      return 0;
+   }
+
+   // one full pass left the registers unchanged
+   int32_t pass = (int32_t)(cycles - idle_cycles);
+   uint32_t insts = (uint32_t)(executed - idle_executed);
+   idle_cycles = cycles;
+   idle_executed = executed;
+   if (pass <= 0 || nmi_request) return 0;
+
+   run_cycles = cycles;
+   int32_t limit = (target == branch) ? INT32_MAX : idleCheck(this, target, branch);
+   if (limit <= 0) return 0;
+
+   // stop short of the slice end, so the instruction that reaches it is
+   // executed normally (timed interrupts are posted between slices)
+   int32_t left = cyclesRemaining - (int32_t)elapsed;
+   if (left < limit) limit = left;
+   int32_t n = (limit - 1) / pass;
+   if (n <= 0) return 0;
+
+   int32_t skip = n * pass;
+   instructions += (uint64_t)n * insts;
+   idle_cycles += skip;
+   idle_executed += (uint64_t)n * insts;
+   idle_skipped += skip;
+   return skip;
+}
+
 void mos6502::Exec(Instr i)
 {
    crossed = false;
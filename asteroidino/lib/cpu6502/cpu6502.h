@@ -62,7 +62,14 @@ class mos6502
       bool nmi_inhibit;  // are we currently handling an NMI?
       bool nmi_line;      // current state of the NMI line
 
+      uint64_t instructions; // executed instruction counter
+      uint64_t run_cycles;   // cycle count at the current instruction
+
       bool CheckInterrupts();
+      int32_t IdlePass(uint16_t branch, uint16_t target,
+            uint8_t a, uint8_t x, uint8_t y, uint8_t p, uint8_t s,
+            uint64_t cycles, uint64_t executed, int32_t cyclesRemaining,
+            uint32_t elapsed);
 
       // addressing modes
       uint16_t Addr_ACC(); // ACCUMULATOR
@@ -186,10 +193,80 @@ class mos6502
       typedef void (*BusWrite)(uint16_t, uint8_t);
       typedef uint8_t (*BusRead)(uint16_t);
       typedef void (*ClockCycle)(mos6502*);
-      BusRead Read;
-      BusWrite Write;
+      typedef int32_t (*IdleCheck)(mos6502*, uint16_t, uint16_t);
+      BusRead busRead;
+      BusWrite busWrite;
       ClockCycle Cycle;
 
+      // idle-loop fast-forward (see SetIdleCheck)
+      static const uint16_t IDLE_NONE = 0xFFFF;
+      IdleCheck idleCheck;
+      uint16_t idle_branch;   // branch of the last taken backward branch
+      uint16_t idle_sp;
+      uint32_t idle_regs;     // A, X, Y, P when it was taken
+      uint64_t idle_cycles;   // cycle and instruction count at that time
+      uint64_t idle_executed;
+      uint64_t idle_skipped;  // cycles skipped so far
+
+      // direct-mapped 256-byte pages. a non-null entry points at the host
+      // memory backing that CPU page, null entries fall back to the bus
+      // callbacks (I/O, unmapped space)
+      const uint8_t* readPage[256];
+      uint8_t* writePage[256];
+
+      inline uint8_t Read(uint16_t addr)
+      {
+         const uint8_t* page = readPage[addr >> 8];
+         return page ? page[addr & 0xFF] : busRead(addr);
+      }
+
+      inline void Write(uint16_t addr, uint8_t value)
+      {
+         uint8_t* page = writePage[addr >> 8];
+         if (page) page[addr & 0xFF] = value;
+         else busWrite(addr, value);
+      }
+
+      // variants for the switch core, which keeps PC and the cycle count
+      // in locals: both are published before falling back to a bus callback
+      inline uint8_t ReadAt(uint16_t addr, uint16_t cur_pc, uint64_t cur_cycles)
+      {
+         const uint8_t* page = readPage[addr >> 8];
+         if (page) return page[addr & 0xFF];
+         pc = cur_pc;
+         run_cycles = cur_cycles;
+         return busRead(addr);
+      }
+
+      inline void WriteAt(uint16_t addr, uint8_t value, uint16_t cur_pc, uint64_t cur_cycles)
+      {
+         uint8_t* page = writePage[addr >> 8];
+         if (page) { page[addr & 0xFF] = value; return; }
+         pc = cur_pc;
+         run_cycles = cur_cycles;
+         busWrite(addr, value);
+      }
+
+      // predecoded instructions of the ROM range set by SetPredecode, one
+      // record per start address, filled on first execution
+      struct Predecoded
+      {
+         uint16_t operand;   // absolute/zero-page address, or branch target
+         uint8_t opcode;
+         uint8_t flags;      // PD_* bits
+      };
+      static const uint8_t PD_VALID   = 0x01;
+      static const uint8_t PD_CROSSED = 0x02;   // branch target in another page
+      Predecoded* pd_cache;
+      uint16_t pd_base;
+      uint16_t pd_size;
+
+      void Predecode(uint16_t addr, Predecoded& d);
+
+      // body of RunSwitch and RunPredecoded (cpu6502_switch.cpp)
+      template <bool PREDECODE>
+      void RunCore(int32_t cycles, uint64_t& cycleCount);
+
       // stack operations
       inline void StackPush(uint8_t byte);
       inline uint8_t StackPop();
@@ -201,6 +278,13 @@ class mos6502
       };
       mos6502(BusRead r, BusWrite w, ClockCycle c = nullptr);
 
+      // map 'count' consecutive 256-byte CPU pages starting at page 'first'
+      // onto host memory at 'base' (page n -> base + (n - first) * 256).
+      // mapped accesses bypass the bus callbacks entirely; passing a null
+      // base returns the pages to the callbacks
+      void MapReadPages(uint8_t first, uint16_t count, const uint8_t* base);
+      void MapWritePages(uint8_t first, uint16_t count, uint8_t* base);
+
       // set or clear the NMI line.  this is an input to the processor.
       // a high to low edge transition will trigger an interrupt.
       // line state is NOT cleared by Reset()
@@ -216,11 +300,48 @@ class mos6502
             int32_t cycles,
             uint64_t& cycleCount,
             CycleMethod cycleMethod = CYCLE_COUNT);
+      // same contract as Run() with CYCLE_COUNT, executed by the switch
+      // core (cpu6502_switch.cpp): opcodes specialized at compile time,
+      // registers held in locals for the whole slice
+      void RunSwitch(
+            int32_t cycles,
+            uint64_t& cycleCount);
+      // switch core that takes opcodes and operands inside the predecode
+      // range from the predecoded records instead of fetching them.
+      // outside the range (RAM, other ROM) it behaves like RunSwitch
+      void RunPredecoded(
+            int32_t cycles,
+            uint64_t& cycleCount);
       void RunEternally(); // until it encounters a illegal opcode
                            // useful when running e.g. WOZ Monitor
                            // no need to worry about cycle exhaus-
                            // tion
 
+      // idle-loop fast-forward. when a backward branch is taken twice in
+      // a row with the same registers and no interrupt in between, the
+      // pass from its target to the branch is a candidate spin loop. a
+      // branch to itself is skipped right away; any other loop is only
+      // skipped if check(cpu, target, branch) returns the number of
+      // cycles (INT32_MAX = until an interrupt) for which every pass
+      // keeps memory and I/O unchanged. whole passes are then added to
+      // the cycle and instruction counts up to the end of the slice or
+      // that limit, so the result is the same as running them (the NMI
+      // comes from the scheduler between slices). registers are not
+      // current during the check. not used while a clock-cycle callback
+      // is set. null disables it
+      void SetIdleCheck(IdleCheck check);
+
+      // absolute operand of a LDA/LDX/LDY/BIT abs at 'target' that the
+      // branch at 'branch' loops back to directly (a port poll), else -1
+      int32_t PollAddress(uint16_t target, uint16_t branch);
+
+      uint64_t GetIdleCycles() { return idle_skipped; }
+
+      // predecode the code at CPU addresses first..first+count-1 lazily
+      // for RunPredecoded. the range must be ROM: records are never
+      // invalidated, except by calling this again. count 0 disables it
+      void SetPredecode(uint16_t first, uint16_t count);
+
       // Various getter/setters
 
       uint16_t GetPC();
@@ -249,6 +370,42 @@ class mos6502
       uint8_t GetResetX();
       uint8_t GetResetY();
       
+      uint64_t GetInstructionCount() { return instructions; }
+
+      // true after an illegal opcode jammed the CPU, until Reset()
+      bool GetIllegalOpcode() { return illegalOpcode; }
+
+      // cycle count (as passed to Run) at the start of the instruction
+      // being executed. valid inside bus callbacks and the idle check,
+      // and equal to the final count after Run() returns
+      uint64_t GetCycles() { return run_cycles; }
+
+      // complete execution state, for savestates: registers, interrupt
+      // lines and pending requests, and the counters. plain
+      // data, copied byte for byte. callbacks and page maps are set up by
+      // the owner and not part of it; SetState() restarts the idle-loop
+      // tracker and leaves the cycle count (as passed to Run) in 'cycles'
+      struct State
+      {
+         uint16_t pc;
+         uint8_t A;
+         uint8_t X;
+         uint8_t Y;
+         uint8_t sp;
+         uint8_t status;
+         uint8_t lines;          // STATE_* bits
+         uint64_t instructions;
+         uint64_t cycles;
+         uint64_t idle_skipped;
+      };
+      static const uint8_t STATE_IRQ_LINE    = 0x01;
+      static const uint8_t STATE_NMI_LINE    = 0x02;
+      static const uint8_t STATE_NMI_REQUEST = 0x04;
+      static const uint8_t STATE_NMI_INHIBIT = 0x08;
+      static const uint8_t STATE_ILLEGAL     = 0x10;
+      void GetState(State& s);
+      void SetState(const State& s);
+
       // Debug helpers
       bool GetNMIRequest() { return nmi_request; }
       bool GetNMIInhibit() { return nmi_inhibit; }
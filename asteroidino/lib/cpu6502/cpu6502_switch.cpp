@@ -0,0 +1,595 @@
+//============================================================================
+// Name        : mos6502 switch core
+// Description : Alternative execution core for mos6502. Every opcode is
+//               specialized in one switch: the addressing mode is inlined
+//               into the operation, registers live in locals for the whole
+//               slice and cycle costs are constants. InstrTable is only
+//               used for opcodes the switch does not handle (illegal
+//               opcodes), and stays the reference for disassembly.
+//               RunPredecoded is the same core reading opcodes and
+//               operands of ROM code from predecoded records.
+//============================================================================
+
+#include "cpu6502.h"
+
+#define NEGATIVE  0x80
+#define OVERFLOW  0x40
+#define CONSTANT  0x20
+#define BREAK     0x10
+#define DECIMAL   0x08
+#define INTERRUPT 0x04
+#define ZERO      0x02
+#define CARRY     0x01
+
+// bus access with the local PC and cycle count published first, so bus
+// callbacks that look at GetPC()/GetCycles() see the same values as with
+// the table core
+#define RD(addr)        ReadAt((addr), PC, cycles)
+#define WR(addr, value) WriteAt((addr), (value), PC, cycles)
+#define FETCH()         (PC++, RD((uint16_t)(PC - 1)))
+
+// operand bytes: from the predecoded record if there is one, PC advances
+// the same way in both cases
+#define OPND8()         ((PREDECODE && pd) ? (PC++, (uint8_t)pd->operand) : FETCH())
+#define OPND16()        ((PREDECODE && pd) ? (PC += 2, pd->operand) \
+                                           : (opnd = FETCH(), opnd | (FETCH() << 8)))
+
+#define PUSH(value)     do { WR(0x0100 + s, (value)); s--; } while (0)
+#define POP()           (s++, RD(0x0100 + s))
+
+#define SET_NZ(v)       p = (p & ~(NEGATIVE | ZERO)) | ((v) & NEGATIVE) | ((v) ? 0 : ZERO)
+#define SET_FLAG(f, c)  p = (c) ? (p | (f)) : (p & ~(f))
+
+// addressing modes: leave the effective address in 'ea'
+#define EA_IMM()  ea = PC++
+#define EA_ZER()  ea = OPND8()
+#define EA_ZEX()  ea = (OPND8() + x) & 0xFF
+#define EA_ZEY()  ea = (OPND8() + y) & 0xFF
+#define EA_ABS()  ea = OPND16()
+#define EA_ABX()  do { uint16_t base = OPND16(); \
+                       ea = base + x; crossed = ((base & 0xFF) + x) > 255; } while (0)
+#define EA_ABY()  do { uint16_t base = OPND16(); \
+                       ea = base + y; crossed = ((base & 0xFF) + y) > 255; } while (0)
+#define EA_INX()  do { uint8_t zl = OPND8() + x; uint16_t lo = RD(zl); \
+                       ea = lo + (RD((uint8_t)(zl + 1)) << 8); } while (0)
+#define EA_INY()  do { uint8_t zl = OPND8(); uint16_t lo = RD(zl); \
+                       ea = lo + (RD((uint8_t)(zl + 1)) << 8) + y; \
+                       crossed = (lo + y) > 255; } while (0)
+#ifndef CMOS_INDIRECT_JMP_FIX
+#define EA_ABI()  do { uint16_t abs = OPND16(); uint16_t effL = RD(abs); \
+                       ea = effL + 0x100 * RD((abs & 0xFF00) + ((abs + 1) & 0x00FF)); } while (0)
+#else
+#define EA_ABI()  do { uint16_t abs = OPND16(); uint16_t effL = RD(abs); \
+                       ea = effL + 0x100 * RD(abs + 1); } while (0)
+#endif
+#define EA_REL()  do { if (PREDECODE && pd) { PC++; ea = pd->operand; \
+                          crossed = pd->flags & PD_CROSSED; break; } \
+                       uint16_t off = FETCH(); if (off & 0x80) off |= 0xFF00; \
+                       ea = PC + (int16_t)off; \
+                       crossed = (ea & 0xFF00) != (PC & 0xFF00); } while (0)
+
+// branches: 2 cycles, +1 if taken, +1 more if the target is in another page
+#define BRANCH(cond) do { if (cond) { elapsed = 3 + crossed; \
+                          if (idleCheck && ea <= PC - 2) BRANCH_IDLE(); \
+                          PC = ea; } \
+                          else elapsed = 2; } while (0)
+
+// taken backward branch: fast-forward spin loops (see SetIdleCheck)
+#define BRANCH_IDLE() do { int32_t skip = IdlePass(PC - 2, ea, a, x, y, p, s, \
+                          cycles, instructions + executed, cyclesRemaining, elapsed); \
+                          cycles += skip; cyclesRemaining -= skip; } while (0)
+
+// operations (see the Op_* reference implementations in cpu6502.cpp)
+#define OP_ADC()     a = Adc(a, p, RD(ea))
+#define OP_SBC()     a = Sbc(a, p, RD(ea))
+#define OP_AND()     do { a &= RD(ea); SET_NZ(a); } while (0)
+#define OP_ORA()     do { a |= RD(ea); SET_NZ(a); } while (0)
+#define OP_EOR()     do { a ^= RD(ea); SET_NZ(a); } while (0)
+#define OP_LDA()     do { a = RD(ea); SET_NZ(a); } while (0)
+#define OP_LDX()     do { x = RD(ea); SET_NZ(x); } while (0)
+#define OP_LDY()     do { y = RD(ea); SET_NZ(y); } while (0)
+#define OP_STA()     WR(ea, a)
+#define OP_STX()     WR(ea, x)
+#define OP_STY()     WR(ea, y)
+#define COMPARE(r)   do { unsigned int t = (r) - RD(ea); SET_FLAG(CARRY, t < 0x100); \
+                          SET_NZ((uint8_t)t); } while (0)
+#define OP_CMP()     COMPARE(a)
+#define OP_CPX()     COMPARE(x)
+#define OP_CPY()     COMPARE(y)
+#define OP_BIT()     do { uint8_t m = RD(ea); p = (p & 0x3F) | (m & 0xC0); \
+                          SET_FLAG(ZERO, !(m & a)); } while (0)
+
+#define RMW(expr)    do { uint8_t m = RD(ea); expr; SET_NZ(m); WR(ea, m); } while (0)
+#define OP_INC()     RMW(m++)
+#define OP_DEC()     RMW(m--)
+#define OP_ASL()     RMW(SET_FLAG(CARRY, m & 0x80); m <<= 1)
+#define OP_LSR()     RMW(SET_FLAG(CARRY, m & 0x01); m >>= 1)
+#define OP_ROL()     RMW(uint8_t c = p & CARRY; SET_FLAG(CARRY, m & 0x80); m = (m << 1) | c)
+#define OP_ROR()     RMW(uint8_t c = (p & CARRY) << 7; SET_FLAG(CARRY, m & 0x01); m = (m >> 1) | c)
+#define OP_ASL_ACC() do { SET_FLAG(CARRY, a & 0x80); a <<= 1; SET_NZ(a); } while (0)
+#define OP_LSR_ACC() do { SET_FLAG(CARRY, a & 0x01); a >>= 1; SET_NZ(a); } while (0)
+#define OP_ROL_ACC() do { uint8_t c = p & CARRY; SET_FLAG(CARRY, a & 0x80); \
+                          a = (a << 1) | c; SET_NZ(a); } while (0)
+#define OP_ROR_ACC() do { uint8_t c = (p & CARRY) << 7; SET_FLAG(CARRY, a & 0x01); \
+                          a = (a >> 1) | c; SET_NZ(a); } while (0)
+
+#define OP_INX()     do { x++; SET_NZ(x); } while (0)
+#define OP_INY()     do { y++; SET_NZ(y); } while (0)
+#define OP_DEX()     do { x--; SET_NZ(x); } while (0)
+#define OP_DEY()     do { y--; SET_NZ(y); } while (0)
+#define OP_TAX()     do { x = a; SET_NZ(x); } while (0)
+#define OP_TAY()     do { y = a; SET_NZ(y); } while (0)
+#define OP_TXA()     do { a = x; SET_NZ(a); } while (0)
+#define OP_TYA()     do { a = y; SET_NZ(a); } while (0)
+#define OP_TSX()     do { x = s; SET_NZ(x); } while (0)
+#define OP_TXS()     s = x
+
+#define OP_CLC()     p &= ~CARRY
+#define OP_SEC()     p |= CARRY
+#define OP_CLD()     p &= ~DECIMAL
+#define OP_SED()     p |= DECIMAL
+#define OP_CLI()     p &= ~INTERRUPT
+#define OP_SEI()     p |= INTERRUPT
+#define OP_CLV()     p &= ~OVERFLOW
+#define OP_NOP()     do { } while (0)
+
+#define OP_PHA()     PUSH(a)
+#define OP_PHP()     PUSH(p | CONSTANT | BREAK)
+#define OP_PLA()     do { a = POP(); SET_NZ(a); } while (0)
+#define OP_PLP()     do { uint8_t m = POP(); \
+                          p = (p & (CONSTANT | BREAK)) | (m & ~(CONSTANT | BREAK)); } while (0)
+
+#define OP_JMP()     PC = ea
+#define OP_JSR()     do { PC--; PUSH(PC >> 8); PUSH(PC & 0xFF); \
+                          PC = (ea & 0xFF) | (RD(PC) << 8); } while (0)
+#define OP_RTS()     do { uint16_t lo = POP(); uint16_t hi = POP(); \
+                          PC = ((hi << 8) | lo) + 1; } while (0)
+#define OP_RTI()     do { uint8_t m = POP(); \
+                          p = (p & (CONSTANT | BREAK)) | (m & ~(CONSTANT | BREAK)); \
+                          uint16_t lo = POP(); uint16_t hi = POP(); \
+                          PC = (hi << 8) | lo; nmi_inhibit = false; } while (0)
+#define OP_BRK()     do { PC++; PUSH(PC >> 8); PUSH(PC & 0xFF); \
+                          PUSH(p | CONSTANT | BREAK); p |= INTERRUPT; \
+                          PC = (RD(irqVectorH) << 8) + RD(irqVectorL); } while (0)
+
+static inline uint8_t Adc(uint8_t a, uint8_t& p, uint8_t m)
+{
+   unsigned int tmp = m + a + (p & CARRY);
+
+   // N V Z computed *BEFORE* adjustment
+   SET_FLAG(OVERFLOW, !((a ^ m) & 0x80) && ((a ^ tmp) & 0x80));
+   SET_FLAG(NEGATIVE, tmp & 0x80);
+   SET_FLAG(ZERO, !(tmp & 0xFF));
+
+   if (p & DECIMAL)
+   {
+      int AL = ((a & 0xF) + (m & 0xF) + (p & CARRY));
+      if (AL >= 0xA) {
+         AL = ((AL + 6) & 0xF) + 0x10;
+      }
+      tmp = (m & 0xF0) + (a & 0xF0) + AL;
+      SET_FLAG(OVERFLOW, !((a ^ m) & 0x80) && ((a ^ tmp) & 0x80));
+      SET_FLAG(NEGATIVE, tmp & 0x80);
+      if (tmp >= 0xA0) tmp += 0x60;
+   }
+
+   // C computed *AFTER* adjustment
+   SET_FLAG(CARRY, tmp > 0xFF);
+   return tmp & 0xFF;
+}
+
+static inline uint8_t Sbc(uint8_t a, uint8_t& p, uint8_t m)
+{
+   int tmp = a - m - ((p & CARRY) ? 0 : 1);
+
+   // N V Z computed *BEFORE* adjustment (binary semantics)
+   SET_FLAG(OVERFLOW, ((a ^ m) & (a ^ tmp) & 0x80) != 0);
+   SET_FLAG(NEGATIVE, tmp & 0x80);
+   SET_FLAG(ZERO, !(tmp & 0xFF));
+
+   if (p & DECIMAL)
+   {
+      int AL = (a & 0x0F) - (m & 0x0F) - ((p & CARRY) ? 0 : 1);
+      if (AL < 0) {
+         AL = ((AL - 6) & 0x0F) - 0x10;
+      }
+      tmp = (a & 0xF0) - (m & 0xF0) + AL;
+      SET_FLAG(OVERFLOW, ((a ^ m) & (a ^ tmp) & 0x80) != 0);
+      SET_FLAG(NEGATIVE, tmp & 0x80);
+      if (tmp < 0) tmp -= 0x60;
+   }
+
+   // C computed *AFTER* adjustment
+   SET_FLAG(CARRY, tmp >= 0);
+   return tmp & 0xFF;
+}
+
+void mos6502::SetPredecode(uint16_t first, uint16_t count)
+{
+   delete[] pd_cache;
+   pd_cache = count ? new Predecoded[count]() : nullptr;
+   pd_base = first;
+   pd_size = pd_cache ? count : 0;
+}
+
+// decode the instruction at 'addr' once: operand bytes by addressing mode,
+// relative branches resolved to their target and page crossing
+void mos6502::Predecode(uint16_t addr, Predecoded& d)
+{
+   uint8_t opcode = Read(addr);
+   AddrExec mode = InstrTable[opcode].addr;
+   uint16_t next = addr + 1;
+
+   d.opcode = opcode;
+   d.operand = 0;
+   d.flags = PD_VALID;
+   if (mode == &mos6502::Addr_ABS || mode == &mos6502::Addr_ABX ||
+       mode == &mos6502::Addr_ABY || mode == &mos6502::Addr_ABI) {
+      d.operand = Read(next) | (Read(next + 1) << 8);
+   } else if (mode == &mos6502::Addr_REL) {
+      uint16_t off = Read(next);
+      if (off & 0x80) off |= 0xFF00;
+      next++;
+      d.operand = next + (int16_t)off;
+      if ((d.operand & 0xFF00) != (next & 0xFF00)) d.flags |= PD_CROSSED;
+   } else if (mode != &mos6502::Addr_IMP && mode != &mos6502::Addr_ACC) {
+      d.operand = Read(next);
+   }
+}
+
+void mos6502::RunSwitch(int32_t cyclesRemaining, uint64_t& cycleCount)
+{
+   RunCore<false>(cyclesRemaining, cycleCount);
+}
+
+void mos6502::RunPredecoded(int32_t cyclesRemaining, uint64_t& cycleCount)
+{
+   if (!pd_cache) {
+      RunCore<false>(cyclesRemaining, cycleCount);
+      return;
+   }
+   RunCore<true>(cyclesRemaining, cycleCount);
+}
+
+template <bool PREDECODE>
+void mos6502::RunCore(int32_t cyclesRemaining, uint64_t& cycleCount)
+{
+   // the clock-cycle callback is only supported by the table core
+   if (Cycle) {
+      Run(cyclesRemaining, cycleCount);
+      return;
+   }
+
+   uint8_t a = A, x = X, y = Y, s = sp, p = status;
+   uint16_t PC = pc;
+   uint64_t cycles = cycleCount;
+   uint32_t executed = 0;
+
+   while(cyclesRemaining > 0 && !illegalOpcode)
+   {
+      uint32_t elapsed;
+      uint32_t irq_cycles = 0;
+      uint16_t ea;
+      uint16_t opnd;
+      bool crossed = false;
+      const Predecoded* pd = nullptr;
+
+      // NMI is edge triggered, IRQ is level triggered
+      if (nmi_request && !nmi_inhibit) {
+         nmi_request = false;
+         nmi_inhibit = true;
+         PUSH(PC >> 8);
+         PUSH(PC & 0xFF);
+         PUSH((p & ~BREAK) | CONSTANT);
+         p |= INTERRUPT;
+         idle_branch = IDLE_NONE;
+         PC = RD(nmiVectorL) | (RD(nmiVectorH) << 8);
+         irq_cycles = 7;
+      }
+      else if (!(p & INTERRUPT) && irq_line == false && !nmi_inhibit) {
+         PUSH(PC >> 8);
+         PUSH(PC & 0xFF);
+         PUSH((p & ~BREAK) | CONSTANT);
+         p |= INTERRUPT;
+         idle_branch = IDLE_NONE;
+         PC = RD(irqVectorL) | (RD(irqVectorH) << 8);
+         irq_cycles = 7;
+      }
+
+      if (PREDECODE && (uint16_t)(PC - pd_base) < pd_size) {
+         Predecoded* d = &pd_cache[(uint16_t)(PC - pd_base)];
+         if (!(d->flags & PD_VALID)) Predecode(PC, *d);
+         pd = d;
+      }
+      uint8_t opcode = (PREDECODE && pd) ? (PC++, pd->opcode) : FETCH();
+
+      switch (opcode)
+      {
+         // ADC
+         case 0x69: EA_IMM(); OP_ADC(); elapsed = 2; break;
+         case 0x65: EA_ZER(); OP_ADC(); elapsed = 3; break;
+         case 0x75: EA_ZEX(); OP_ADC(); elapsed = 4; break;
+         case 0x6D: EA_ABS(); OP_ADC(); elapsed = 4; break;
+         case 0x7D: EA_ABX(); OP_ADC(); elapsed = 4 + crossed; break;
+         case 0x79: EA_ABY(); OP_ADC(); elapsed = 4 + crossed; break;
+         case 0x61: EA_INX(); OP_ADC(); elapsed = 6; break;
+         case 0x71: EA_INY(); OP_ADC(); elapsed = 5 + crossed; break;
+
+         // AND
+         case 0x29: EA_IMM(); OP_AND(); elapsed = 2; break;
+         case 0x25: EA_ZER(); OP_AND(); elapsed = 3; break;
+         case 0x35: EA_ZEX(); OP_AND(); elapsed = 4; break;
+         case 0x2D: EA_ABS(); OP_AND(); elapsed = 4; break;
+         case 0x3D: EA_ABX(); OP_AND(); elapsed = 4 + crossed; break;
+         case 0x39: EA_ABY(); OP_AND(); elapsed = 4 + crossed; break;
+         case 0x21: EA_INX(); OP_AND(); elapsed = 6; break;
+         case 0x31: EA_INY(); OP_AND(); elapsed = 5 + crossed; break;
+
+         // ASL
+         case 0x0A: OP_ASL_ACC(); elapsed = 2; break;
+         case 0x06: EA_ZER(); OP_ASL(); elapsed = 5; break;
+         case 0x16: EA_ZEX(); OP_ASL(); elapsed = 6; break;
+         case 0x0E: EA_ABS(); OP_ASL(); elapsed = 6; break;
+         case 0x1E: EA_ABX(); OP_ASL(); elapsed = 7; break;
+
+         // BCC
+         case 0x90: EA_REL(); BRANCH(!(p & CARRY)); break;
+
+         // BCS
+         case 0xB0: EA_REL(); BRANCH(p & CARRY); break;
+
+         // BEQ
+         case 0xF0: EA_REL(); BRANCH(p & ZERO); break;
+
+         // BIT
+         case 0x24: EA_ZER(); OP_BIT(); elapsed = 3; break;
+         case 0x2C: EA_ABS(); OP_BIT(); elapsed = 4; break;
+
+         // BMI
+         case 0x30: EA_REL(); BRANCH(p & NEGATIVE); break;
+
+         // BNE
+         case 0xD0: EA_REL(); BRANCH(!(p & ZERO)); break;
+
+         // BPL
+         case 0x10: EA_REL(); BRANCH(!(p & NEGATIVE)); break;
+
+         // BRK
+         case 0x00: OP_BRK(); elapsed = 7; break;
+
+         // BVC
+         case 0x50: EA_REL(); BRANCH(!(p & OVERFLOW)); break;
+
+         // BVS
+         case 0x70: EA_REL(); BRANCH(p & OVERFLOW); break;
+
+         // CLC
+         case 0x18: OP_CLC(); elapsed = 2; break;
+
+         // CLD
+         case 0xD8: OP_CLD(); elapsed = 2; break;
+
+         // CLI
+         case 0x58: OP_CLI(); elapsed = 2; break;
+
+         // CLV
+         case 0xB8: OP_CLV(); elapsed = 2; break;
+
+         // CMP
+         case 0xC9: EA_IMM(); OP_CMP(); elapsed = 2; break;
+         case 0xC5: EA_ZER(); OP_CMP(); elapsed = 3; break;
+         case 0xD5: EA_ZEX(); OP_CMP(); elapsed = 4; break;
+         case 0xCD: EA_ABS(); OP_CMP(); elapsed = 4; break;
+         case 0xDD: EA_ABX(); OP_CMP(); elapsed = 4 + crossed; break;
+         case 0xD9: EA_ABY(); OP_CMP(); elapsed = 4 + crossed; break;
+         case 0xC1: EA_INX(); OP_CMP(); elapsed = 6; break;
+         case 0xD1: EA_INY(); OP_CMP(); elapsed = 5 + crossed; break;
+
+         // CPX
+         case 0xE0: EA_IMM(); OP_CPX(); elapsed = 2; break;
+         case 0xE4: EA_ZER(); OP_CPX(); elapsed = 3; break;
+         case 0xEC: EA_ABS(); OP_CPX(); elapsed = 4; break;
+
+         // CPY
+         case 0xC0: EA_IMM(); OP_CPY(); elapsed = 2; break;
+         case 0xC4: EA_ZER(); OP_CPY(); elapsed = 3; break;
+         case 0xCC: EA_ABS(); OP_CPY(); elapsed = 4; break;
+
+         // DEC
+         case 0xC6: EA_ZER(); OP_DEC(); elapsed = 5; break;
+         case 0xD6: EA_ZEX(); OP_DEC(); elapsed = 6; break;
+         case 0xCE: EA_ABS(); OP_DEC(); elapsed = 6; break;
+         case 0xDE: EA_ABX(); OP_DEC(); elapsed = 7; break;
+
+         // DEX
+         case 0xCA: OP_DEX(); elapsed = 2; break;
+
+         // DEY
+         case 0x88: OP_DEY(); elapsed = 2; break;
+
+         // EOR
+         case 0x49: EA_IMM(); OP_EOR(); elapsed = 2; break;
+         case 0x45: EA_ZER(); OP_EOR(); elapsed = 3; break;
+         case 0x55: EA_ZEX(); OP_EOR(); elapsed = 4; break;
+         case 0x4D: EA_ABS(); OP_EOR(); elapsed = 4; break;
+         case 0x5D: EA_ABX(); OP_EOR(); elapsed = 4 + crossed; break;
+         case 0x59: EA_ABY(); OP_EOR(); elapsed = 4 + crossed; break;
+         case 0x41: EA_INX(); OP_EOR(); elapsed = 6; break;
+         case 0x51: EA_INY(); OP_EOR(); elapsed = 5 + crossed; break;
+
+         // INC
+         case 0xE6: EA_ZER(); OP_INC(); elapsed = 5; break;
+         case 0xF6: EA_ZEX(); OP_INC(); elapsed = 6; break;
+         case 0xEE: EA_ABS(); OP_INC(); elapsed = 6; break;
+         case 0xFE: EA_ABX(); OP_INC(); elapsed = 7; break;
+
+         // INX
+         case 0xE8: OP_INX(); elapsed = 2; break;
+
+         // INY
+         case 0xC8: OP_INY(); elapsed = 2; break;
+
+         // JMP
+         case 0x4C: EA_ABS(); OP_JMP(); elapsed = 3; break;
+         case 0x6C: EA_ABI(); OP_JMP(); elapsed = 5; break;
+
+         // JSR
+         case 0x20: EA_ABS(); OP_JSR(); elapsed = 6; break;
+
+         // LDA
+         case 0xA9: EA_IMM(); OP_LDA(); elapsed = 2; break;
+         case 0xA5: EA_ZER(); OP_LDA(); elapsed = 3; break;
+         case 0xB5: EA_ZEX(); OP_LDA(); elapsed = 4; break;
+         case 0xAD: EA_ABS(); OP_LDA(); elapsed = 4; break;
+         case 0xBD: EA_ABX(); OP_LDA(); elapsed = 4 + crossed; break;
+         case 0xB9: EA_ABY(); OP_LDA(); elapsed = 4 + crossed; break;
+         case 0xA1: EA_INX(); OP_LDA(); elapsed = 6; break;
+         case 0xB1: EA_INY(); OP_LDA(); elapsed = 5 + crossed; break;
+
+         // LDX
+         case 0xA2: EA_IMM(); OP_LDX(); elapsed = 2; break;
+         case 0xA6: EA_ZER(); OP_LDX(); elapsed = 3; break;
+         case 0xB6: EA_ZEY(); OP_LDX(); elapsed = 4; break;
+         case 0xAE: EA_ABS(); OP_LDX(); elapsed = 4; break;
+         case 0xBE: EA_ABY(); OP_LDX(); elapsed = 4 + crossed; break;
+
+         // LDY
+         case 0xA0: EA_IMM(); OP_LDY(); elapsed = 2; break;
+         case 0xA4: EA_ZER(); OP_LDY(); elapsed = 3; break;
+         case 0xB4: EA_ZEX(); OP_LDY(); elapsed = 4; break;
+         case 0xAC: EA_ABS(); OP_LDY(); elapsed = 4; break;
+         case 0xBC: EA_ABX(); OP_LDY(); elapsed = 4 + crossed; break;
+
+         // LSR
+         case 0x4A: OP_LSR_ACC(); elapsed = 2; break;
+         case 0x46: EA_ZER(); OP_LSR(); elapsed = 5; break;
+         case 0x56: EA_ZEX(); OP_LSR(); elapsed = 6; break;
+         case 0x4E: EA_ABS(); OP_LSR(); elapsed = 6; break;
+         case 0x5E: EA_ABX(); OP_LSR(); elapsed = 7; break;
+
+         // NOP
+         case 0xEA: OP_NOP(); elapsed = 2; break;
+
+         // ORA
+         case 0x09: EA_IMM(); OP_ORA(); elapsed = 2; break;
+         case 0x05: EA_ZER(); OP_ORA(); elapsed = 3; break;
+         case 0x15: EA_ZEX(); OP_ORA(); elapsed = 4; break;
+         case 0x0D: EA_ABS(); OP_ORA(); elapsed = 4; break;
+         case 0x1D: EA_ABX(); OP_ORA(); elapsed = 4 + crossed; break;
+         case 0x19: EA_ABY(); OP_ORA(); elapsed = 4 + crossed; break;
+         case 0x01: EA_INX(); OP_ORA(); elapsed = 6; break;
+         case 0x11: EA_INY(); OP_ORA(); elapsed = 5 + crossed; break;
+
+         // PHA
+         case 0x48: OP_PHA(); elapsed = 3; break;
+
+         // PHP
+         case 0x08: OP_PHP(); elapsed = 3; break;
+
+         // PLA
+         case 0x68: OP_PLA(); elapsed = 4; break;
+
+         // PLP
+         case 0x28: OP_PLP(); elapsed = 4; break;
+
+         // ROL
+         case 0x2A: OP_ROL_ACC(); elapsed = 2; break;
+         case 0x26: EA_ZER(); OP_ROL(); elapsed = 5; break;
+         case 0x36: EA_ZEX(); OP_ROL(); elapsed = 6; break;
+         case 0x2E: EA_ABS(); OP_ROL(); elapsed = 6; break;
+         case 0x3E: EA_ABX(); OP_ROL(); elapsed = 7; break;
+
+         // ROR
+         case 0x6A: OP_ROR_ACC(); elapsed = 2; break;
+         case 0x66: EA_ZER(); OP_ROR(); elapsed = 5; break;
+         case 0x76: EA_ZEX(); OP_ROR(); elapsed = 6; break;
+         case 0x6E: EA_ABS(); OP_ROR(); elapsed = 6; break;
+         case 0x7E: EA_ABX(); OP_ROR(); elapsed = 7; break;
+
+         // RTI
+         case 0x40: OP_RTI(); elapsed = 6; break;
+
+         // RTS
+         case 0x60: OP_RTS(); elapsed = 6; break;
+
+         // SBC
+         case 0xE9: EA_IMM(); OP_SBC(); elapsed = 2; break;
+         case 0xE5: EA_ZER(); OP_SBC(); elapsed = 3; break;
+         case 0xF5: EA_ZEX(); OP_SBC(); elapsed = 4; break;
+         case 0xED: EA_ABS(); OP_SBC(); elapsed = 4; break;
+         case 0xFD: EA_ABX(); OP_SBC(); elapsed = 4 + crossed; break;
+         case 0xF9: EA_ABY(); OP_SBC(); elapsed = 4 + crossed; break;
+         case 0xE1: EA_INX(); OP_SBC(); elapsed = 6; break;
+         case 0xF1: EA_INY(); OP_SBC(); elapsed = 5 + crossed; break;
+
+         // SEC
+         case 0x38: OP_SEC(); elapsed = 2; break;
+
+         // SED
+         case 0xF8: OP_SED(); elapsed = 2; break;
+
+         // SEI
+         case 0x78: OP_SEI(); elapsed = 2; break;
+
+         // STA
+         case 0x85: EA_ZER(); OP_STA(); elapsed = 3; break;
+         case 0x95: EA_ZEX(); OP_STA(); elapsed = 4; break;
+         case 0x8D: EA_ABS(); OP_STA(); elapsed = 4; break;
+         case 0x9D: EA_ABX(); OP_STA(); elapsed = 5; break;
+         case 0x99: EA_ABY(); OP_STA(); elapsed = 5; break;
+         case 0x81: EA_INX(); OP_STA(); elapsed = 6; break;
+         case 0x91: EA_INY(); OP_STA(); elapsed = 6; break;
+
+         // STX
+         case 0x86: EA_ZER(); OP_STX(); elapsed = 3; break;
+         case 0x96: EA_ZEY(); OP_STX(); elapsed = 4; break;
+         case 0x8E: EA_ABS(); OP_STX(); elapsed = 4; break;
+
+         // STY
+         case 0x84: EA_ZER(); OP_STY(); elapsed = 3; break;
+         case 0x94: EA_ZEX(); OP_STY(); elapsed = 4; break;
+         case 0x8C: EA_ABS(); OP_STY(); elapsed = 4; break;
+
+         // TAX
+         case 0xAA: OP_TAX(); elapsed = 2; break;
+
+         // TAY
+         case 0xA8: OP_TAY(); elapsed = 2; break;
+
+         // TSX
+         case 0xBA: OP_TSX(); elapsed = 2; break;
+
+         // TXA
+         case 0x8A: OP_TXA(); elapsed = 2; break;
+
+         // TXS
+         case 0x9A: OP_TXS(); elapsed = 2; break;
+
+         // TYA
+         case 0x98: OP_TYA(); elapsed = 2; break;
+         default:
+         {
+            // not specialized: run it through InstrTable
+            Instr instr = InstrTable[opcode];
+            A = a; X = x; Y = y; sp = s; status = p; pc = PC;
+            run_cycles = cycles;
+            Exec(instr);
+            a = A; x = X; y = Y; s = sp; p = status; PC = pc;
+            elapsed = instr.cycles;
+            if (branched) elapsed++;
+            if (instr.penalty && this->crossed) elapsed++;
+            break;
+         }
+      }
+
+      elapsed += irq_cycles;
+      executed++;
+      cycles += elapsed;
+      cyclesRemaining -= elapsed;
+   }
+
+   A = a; X = x; Y = y; sp = s; status = p; pc = PC;
+   cycleCount = cycles;
+   run_cycles = cycles;
+   instructions += executed;
+}
@@ -0,0 +1,135 @@
+/*
+ * display_gov.cpp - Adaptive refresh governor
+ *
+ * The output time of a frame is points x (SPI time + dwell), so one
+ * measured frame gives the cost per point. From it the planner picks the
+ * best level that fits the load target: full density at the highest
+ * rate and longest dwell first, then a smaller point budget, then
+ * shorter dwell, then a lower rate. A frame that does not fit drops to
+ * that level at once; a better level is only taken after it was
+ * planned for VECT_GOV_HOLD_FRAMES frames in a row, so the settings do
+ * not flicker between neighbouring levels.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_GOV_*
+#include "display_gov.h"
+
+#define GOV_HZ_STEP  5          // Refresh rate steps (Hz)
+
+// Output time a frame may take at a refresh rate
+static inline uint32_t gov_target_us(uint16_t hz) {
+    return 1000000u / hz * VECT_GOV_LOAD_PCT / 100;
+}
+
+void DisplayGovernor::begin(int max_points_, uint8_t dwell_max_, uint8_t dwell_min_) {
+    path_points = max_points_;
+    path_dwell = dwell_max_ > 0;
+    setLimits(VECT_REFRESH_MIN_HZ, VECT_REFRESH_HZ, max_points_, dwell_min_, dwell_max_);
+    cost_q8 = 0;
+    frames = overloads = degrades = restores = 0;
+    last_draw_us = peak_draw_us = 0;
+}
+
+void DisplayGovernor::setLimits(uint16_t hz_min_, uint16_t hz_max_, int max_points_,
+                                uint8_t dwell_min_, uint8_t dwell_max_) {
+    hz_max = max(hz_max_, (uint16_t)1);
+    hz_min = min(max(hz_min_, (uint16_t)1), hz_max);
+    points_limit = min(max(max_points_, VECT_GOV_MIN_POINTS), path_points);
+    if (path_dwell) {
+        dwell_max = dwell_max_;
+        dwell_min = min(dwell_min_, dwell_max_);
+    }
+    apply({ hz_max, dwell_max, points_limit });
+    calm = 0;
+}
+
+// Lexicographic: refresh rate first, then dwell, then points
+bool DisplayGovernor::better(const Level& a, const Level& b) {
+    if (a.hz != b.hz) return a.hz > b.hz;
+    if (a.dwell != b.dwell) return a.dwell > b.dwell;
+    return a.points > b.points;
+}
+
+// Output time of a frame of 'wanted' points at a level
+uint32_t DisplayGovernor::predict(const Level& l, int wanted) const {
+    uint32_t n = (wanted < l.points) ? wanted : l.points;
+    return (uint32_t)(((uint64_t)n * (cost_q8 + (l.dwell << 8))) >> 8);
+}
+
+DisplayGovernor::Level DisplayGovernor::plan(int wanted) const {
+    for (int h = hz_max; ; h -= GOV_HZ_STEP) {
+        if (h < hz_min) h = hz_min;
+        uint64_t target_q8 = (uint64_t)gov_target_us(h) << 8;
+
+        for (int d = dwell_max; d >= dwell_min; d--) {
+            uint32_t per_point = cost_q8 + (d << 8);
+            uint32_t fit = per_point ? (uint32_t)min(target_q8 / per_point, (uint64_t)INT32_MAX)
+                                     : (uint32_t)points_limit;
+            if (fit >= (uint32_t)wanted || fit >= (uint32_t)points_limit) {
+                return { (uint16_t)h, (uint8_t)d, points_limit };
+            }
+            if (fit >= VECT_GOV_MIN_POINTS) {
+                // Leave some margin, the next frame may be a bit busier
+                int points = fit - fit / 8;
+                if (points < VECT_GOV_MIN_POINTS) points = VECT_GOV_MIN_POINTS;
+                return { (uint16_t)h, (uint8_t)d, points };
+            }
+        }
+        if (h == hz_min) break;
+    }
+    return { hz_min, dwell_min, VECT_GOV_MIN_POINTS };
+}
+
+bool DisplayGovernor::apply(const Level& l) {
+    bool points_changed = (l.points != max_points);
+    hz = l.hz;
+    period_us = 1000000u / l.hz;
+    dwell_us = l.dwell;
+    max_points = l.points;
+    return points_changed;
+}
+
+bool DisplayGovernor::update(uint32_t draw_us, int points, int wanted) {
+    frames++;
+    last_draw_us = draw_us;
+    if (draw_us > peak_draw_us) peak_draw_us = draw_us;
+    if (draw_us > period_us) overloads++;
+
+#if VECT_GOV_ENABLE
+    if (points <= 0) return false;
+
+    // Cost per point without the dwell: rises at once, decays slowly
+    int32_t c = (int32_t)(((uint64_t)draw_us << 8) / points) - (dwell_us << 8);
+    if (c < 0) c = 0;
+    if ((uint32_t)c > cost_q8) {
+        cost_q8 = c;
+    } else {
+        cost_q8 -= (cost_q8 - c) >> 4;
+    }
+
+    Level current = { hz, dwell_us, max_points };
+    Level next = plan(wanted);
+
+    if (predict(current, wanted) > gov_target_us(hz)) {
+        // Behind: step down right away
+        calm = 0;
+        if (!better(current, next)) return false;  // Already at the limits
+        degrades++;
+        return apply(next);
+    }
+
+    if (!better(next, current)) {
+        calm = 0;
+        return false;
+    }
+    if (calm == 0 || better(calm_worst, next)) calm_worst = next;
+    if (++calm < VECT_GOV_HOLD_FRAMES) return false;
+    calm = 0;
+    restores++;
+    return apply(calm_worst);
+#else
+    (void)points;
+    (void)wanted;
+    return false;
+#endif
+}
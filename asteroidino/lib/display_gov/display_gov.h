@@ -0,0 +1,80 @@
+/*
+ * display_gov.h - Regler für Bildrate, Punktdichte und Verweildauer
+ *
+ * Misst pro Anzeige-Frame die Ausgabezeit und schätzt daraus die Kosten
+ * pro Punkt. Passt ein Frame nicht mehr in VECT_GOV_LOAD_PCT der
+ * Periode, wird zuerst das Punktbudget des Rasterizers verkleinert
+ * (größerer Punktabstand), dann die Verweildauer verkürzt und erst
+ * zuletzt die Bildrate gesenkt, jeweils nur bis zu den Grenzen aus
+ * config.h. Hochgeregelt wird in umgekehrter Reihenfolge, sobald es
+ * VECT_GOV_HOLD_FRAMES Frames lang wieder reicht. So läuft die Röhre mit
+ * stabiler Rate, egal wie voll der Bildschirm ist.
+ */
+
+#ifndef DISPLAY_GOV_H
+#define DISPLAY_GOV_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef VECT_GOV_ENABLE
+#error "config.h must be included before display_gov.h"
+#endif
+
+class DisplayGovernor {
+public:
+    // Limits of the output path: point budget, and dwell range in us
+    // (0/0 when the DMA engine paces the points by itself)
+    void begin(int max_points, uint8_t dwell_max, uint8_t dwell_min);
+
+    // New limits at runtime (console), within those of begin(); starts
+    // again from the best level, so the frame has to be rasterized again
+    void setLimits(uint16_t hz_min, uint16_t hz_max, int max_points,
+                   uint8_t dwell_min, uint8_t dwell_max);
+
+    // A frame was output: its draw time, the points drawn and the points
+    // the rasterizer wanted at full density. Returns true if the point
+    // budget changed (the frame has to be rasterized again).
+    bool update(uint32_t draw_us, int points, int wanted);
+
+    // Current settings
+    uint16_t hz = VECT_REFRESH_HZ;
+    uint32_t period_us = 1000000 / VECT_REFRESH_HZ;
+    int      max_points = VECT_POINTS_PER_FRAME;  // Rasterizer budget
+    uint8_t  dwell_us = VECT_DWELL_US;
+
+    // Limits (set through begin() / setLimits())
+    uint16_t hz_min = VECT_REFRESH_MIN_HZ;
+    uint16_t hz_max = VECT_REFRESH_HZ;
+    int      points_limit = VECT_POINTS_PER_FRAME;
+    uint8_t  dwell_max = VECT_DWELL_US;
+    uint8_t  dwell_min = VECT_DWELL_MIN_US;
+
+    // Metrics
+    uint32_t frames = 0;
+    uint32_t overloads = 0;     // Frames that took longer than their period
+    uint32_t degrades = 0;      // Settings lowered
+    uint32_t restores = 0;      // Settings raised again
+    uint32_t last_draw_us = 0;
+    uint32_t peak_draw_us = 0;  // Since the last status report (reset by caller)
+
+private:
+    struct Level {
+        uint16_t hz;
+        uint8_t  dwell;
+        int      points;
+    };
+
+    int      path_points = VECT_POINTS_PER_FRAME;  // Limits of the output path
+    bool     path_dwell = true;
+    uint32_t cost_q8 = 0;       // Output time per point without dwell (us, 8.8)
+    uint32_t calm = 0;          // Frames in a row that planned a better level
+    Level    calm_worst;        // Worst of those plans
+
+    Level plan(int wanted) const;
+    uint32_t predict(const Level& l, int wanted) const;
+    bool apply(const Level& l);
+    static bool better(const Level& a, const Level& b);
+};
+
+#endif // DISPLAY_GOV_H
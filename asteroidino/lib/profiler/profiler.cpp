@@ -0,0 +1,207 @@
+/*
+ * profiler.cpp - Per-frame section histograms and the cross-core report
+ *
+ * Everything a core measures stays with that core: the accumulators,
+ * the histograms and the overrun counters are only touched by the core
+ * that owns the section. When a core has collected PROFILE_WINDOW_MS
+ * worth of frames it condenses its histograms into a small summary and
+ * publishes it through a double buffer, so prof_report() never reads a
+ * histogram that is being written.
+ */
+
+#include "../../src/config.h"  // MUST be first for PROFILE_*
+#include "profiler.h"
+
+#if PROFILE_ENABLE
+
+#include <atomic>
+
+// Log-linear buckets: values below 8 exactly, above that 8 sub-buckets
+// per power of two (at most 12.5% above the true value)
+#define PROF_SUB_BITS  3
+#define PROF_SUB       (1 << PROF_SUB_BITS)
+#define PROF_BUCKETS   ((32 - PROF_SUB_BITS + 1) * PROF_SUB)
+
+struct prof_hist {
+    uint16_t count[PROF_BUCKETS];
+    uint32_t min, max;
+    uint64_t sum;
+};
+
+struct prof_stats {
+    uint32_t min, avg, p99, max;
+};
+
+struct prof_summary {
+    uint32_t frames;
+    uint32_t overruns;        // This window
+    uint32_t overruns_total;  // Since prof_begin()
+    prof_stats section[PROF_SECTIONS];
+    uint32_t count[PROF_COUNTERS];
+};
+
+struct prof_core {
+    prof_section first, last;  // Owned sections, last is the core total
+    uint8_t counter_first;     // Owned counters [counter_first, counter_end)
+    uint8_t counter_end;
+    uint32_t budget;           // Cycles per frame
+    uint32_t window;           // Frames per summary
+    uint32_t frames;
+    uint32_t overruns;
+    uint32_t overruns_total;
+    prof_summary published[2];
+    std::atomic<uint32_t> seq{0};  // published[seq & 1] is the newest
+};
+
+uint32_t prof_acc[PROF_SECTIONS];
+uint32_t prof_counts[PROF_COUNTERS];
+
+static prof_hist prof_hists[PROF_SECTIONS];
+
+static prof_core prof_cores[2] = {
+    { PROF_CPU, PROF_CORE0, 0, 0 },
+    { PROF_DVG, PROF_CORE1, PROF_DVG_DECODED, PROF_COUNTERS },
+};
+
+static const char* const prof_names[PROF_SECTIONS] = {
+    "cpu", "bus", "idle", "core0", "dvg", "render", "core1"
+};
+
+static const char* const prof_counter_names[PROF_COUNTERS] = {
+    "dvg decoded", "dvg reused"
+};
+
+static inline int prof_bucket(uint32_t v) {
+    if (v < PROF_SUB) return v;
+    int e = 31 - __builtin_clz(v);
+    return (e - PROF_SUB_BITS + 1) * PROF_SUB + ((v >> (e - PROF_SUB_BITS)) & (PROF_SUB - 1));
+}
+
+// Largest value that falls into a bucket
+static inline uint32_t prof_bucket_top(int b) {
+    if (b < PROF_SUB) return b;
+    int e = b / PROF_SUB + PROF_SUB_BITS - 1;
+    uint32_t low = (uint32_t)(PROF_SUB + b % PROF_SUB) << (e - PROF_SUB_BITS);
+    return low + ((1u << (e - PROF_SUB_BITS)) - 1);
+}
+
+static void prof_hist_reset(prof_hist& h) {
+    memset(h.count, 0, sizeof(h.count));
+    h.min = UINT32_MAX;
+    h.max = 0;
+    h.sum = 0;
+}
+
+static prof_stats prof_hist_stats(const prof_hist& h, uint32_t frames) {
+    prof_stats s = { 0, 0, 0, 0 };
+    if (!frames) return s;
+
+    uint32_t rank = frames - frames / 100;  // 99th percentile, nearest rank
+    uint32_t seen = 0;
+    int b = 0;
+    while (b < PROF_BUCKETS - 1 && (seen += h.count[b]) < rank) b++;
+
+    s.min = h.min;
+    s.avg = (uint32_t)(h.sum / frames);
+    s.p99 = min(prof_bucket_top(b), h.max);
+    s.max = h.max;
+    return s;
+}
+
+void prof_begin() {
+    uint32_t hz = getCpuFrequencyMhz() * 1000000u;
+    prof_cores[0].budget = hz / CPU_NMI_HZ;
+    prof_cores[0].window = PROFILE_WINDOW_MS * CPU_NMI_HZ / 1000;
+    prof_cores[1].budget = hz / VECT_REFRESH_HZ;
+    prof_cores[1].window = PROFILE_WINDOW_MS * VECT_REFRESH_HZ / 1000;
+
+    for (int s = 0; s < PROF_SECTIONS; s++) {
+        prof_acc[s] = 0;
+        prof_hist_reset(prof_hists[s]);
+    }
+    for (int n = 0; n < PROF_COUNTERS; n++) prof_counts[n] = 0;
+
+    Serial.printf("Profiler: budget %u cycles (core 0), %u cycles (core 1), %d ms windows\n",
+                  prof_cores[0].budget, prof_cores[1].budget, PROFILE_WINDOW_MS);
+}
+
+void prof_frame(int core) {
+    prof_core& c = prof_cores[core];
+
+    for (int s = c.first; s <= c.last; s++) {
+        uint32_t v = prof_acc[s];
+        prof_acc[s] = 0;
+
+        prof_hist& h = prof_hists[s];
+        h.count[prof_bucket(v)]++;
+        if (v < h.min) h.min = v;
+        if (v > h.max) h.max = v;
+        h.sum += v;
+
+        if (s == c.last && v > c.budget) {
+            c.overruns++;
+            c.overruns_total++;
+        }
+    }
+
+    if (++c.frames < c.window) return;
+
+    // Window full: publish into the buffer the reader is not using
+    uint32_t seq = c.seq.load(std::memory_order_relaxed);
+    prof_summary& p = c.published[(seq + 1) & 1];
+    p.frames = c.frames;
+    p.overruns = c.overruns;
+    p.overruns_total = c.overruns_total;
+    for (int s = c.first; s <= c.last; s++) {
+        p.section[s] = prof_hist_stats(prof_hists[s], c.frames);
+        prof_hist_reset(prof_hists[s]);
+    }
+    for (int n = c.counter_first; n < c.counter_end; n++) {
+        p.count[n] = prof_counts[n];
+        prof_counts[n] = 0;
+    }
+    c.seq.store(seq + 1, std::memory_order_release);
+
+    c.frames = 0;
+    c.overruns = 0;
+}
+
+size_t prof_report(char* buf, size_t cap) {
+    uint32_t mhz = getCpuFrequencyMhz();
+    size_t len = 0;
+    buf[0] = 0;
+
+    for (int core = 0; core < 2; core++) {
+        prof_core& c = prof_cores[core];
+        uint32_t seq = c.seq.load(std::memory_order_acquire);
+        if (!seq) continue;  // No window finished yet
+        prof_summary p = c.published[seq & 1];
+
+        const prof_stats& total = p.section[c.last];
+        if (len < cap) {
+            len += snprintf(buf + len, cap - len,
+                            "[prof] core %d: %u frames, budget %u us, p99 %u%% of budget, %u overruns (%u total)\n",
+                            core, p.frames, c.budget / mhz,
+                            (uint32_t)(100ull * total.p99 / c.budget), p.overruns, p.overruns_total);
+        }
+        for (int s = c.first; s <= c.last && len < cap; s++) {
+            const prof_stats& t = p.section[s];
+            len += snprintf(buf + len, cap - len,
+                            "[prof]   %-6s min %6u avg %6u p99 %6u max %6u us\n",
+                            prof_names[s], t.min / mhz, t.avg / mhz, t.p99 / mhz, t.max / mhz);
+        }
+
+        // Counters in pairs of (miss, hit) get a hit rate
+        for (int n = c.counter_first; n + 1 < c.counter_end && len < cap; n += 2) {
+            uint32_t events = p.count[n] + p.count[n + 1];
+            len += snprintf(buf + len, cap - len,
+                            "[prof]   %s %u, %s %u (%u%% hit)\n",
+                            prof_counter_names[n], p.count[n],
+                            prof_counter_names[n + 1], p.count[n + 1],
+                            events ? (uint32_t)(100ull * p.count[n + 1] / events) : 0);
+        }
+    }
+    return len < cap ? len : cap - 1;
+}
+
+#endif // PROFILE_ENABLE
@@ -0,0 +1,93 @@
+/*
+ * profiler.h - Zyklengenaues Profiling der Subsysteme (CCOUNT)
+ *
+ * Misst pro Frame, wie viele CPU-Takte des ESP32 jedes Subsystem braucht:
+ * Core 0 die 6502-Emulation, die Bus-Callbacks (I/O), die Leerlaufzeit
+ * der Drosselung und die Gesamtlast; Core 1 die DVG-Dekodierung,
+ * render_vectors() (SPI/DMA) und seine Gesamtlast. Jeder Core faltet
+ * seine Frames in eigene Histogramme (min/avg/p99/max) und zählt
+ * Überschreitungen des Frame-Budgets (Core 0: eine NMI-Periode, Core 1:
+ * ein Anzeige-Frame). Dazu kommen Ereigniszähler pro Fenster (z.B.
+ * dekodierte / wiederverwendete DVG-Listen). Mit PROFILE_ENABLE 0
+ * verschwindet alles.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef PROFILE_ENABLE
+#error "config.h must be included before profiler.h"
+#endif
+
+// Sections; each is written by one core only
+enum prof_section : uint8_t {
+    PROF_CPU,      // Core 0: 6502 execution (includes PROF_BUS)
+    PROF_BUS,      // Core 0: memory callbacks (I/O pages, unmapped space)
+    PROF_IDLE,     // Core 0: throttle sleep until the next frame
+    PROF_CORE0,    // Core 0: everything but the throttle sleep
+    PROF_DVG,      // Core 1: DVG list decode
+    PROF_RENDER,   // Core 1: optimizer, rasterizer and DAC output
+    PROF_CORE1,    // Core 1: all of loop() between two display frames
+    PROF_SECTIONS
+};
+
+// Event counters as (miss, hit) pairs, the report adds the hit rate;
+// each is counted by one core
+enum prof_counter : uint8_t {
+    PROF_DVG_DECODED,  // Core 1: GOs whose list was decoded
+    PROF_DVG_REUSED,   // Core 1: GOs that kept the previous list (unchanged)
+    PROF_COUNTERS
+};
+
+#if PROFILE_ENABLE
+
+// Events of this counter in the current window of its core
+extern uint32_t prof_counts[PROF_COUNTERS];
+
+// Cycles of this section in the current frame of its core
+extern uint32_t prof_acc[PROF_SECTIONS];
+
+// Compute the frame budgets (call once from setup)
+void prof_begin();
+
+// Close the current frame of a core (0 = emulation, 1 = display)
+void prof_frame(int core);
+
+// Format the last finished window of both cores; callable from any core
+size_t prof_report(char* buf, size_t cap);
+
+inline uint32_t prof_ccount() { return ESP.getCycleCount(); }
+
+inline void prof_add(prof_section s, uint32_t cycles) { prof_acc[s] += cycles; }
+
+inline void prof_count(prof_counter c) { prof_counts[c]++; }
+
+struct ProfScope {
+    prof_section section;
+    uint32_t start;
+    explicit ProfScope(prof_section s) : section(s), start(prof_ccount()) {}
+    ~ProfScope() { prof_add(section, prof_ccount() - start); }
+};
+
+#define PROF_SCOPE(s)  ProfScope prof_scope_(s)
+#define PROF_BEGIN(s)  uint32_t prof_start_##s = prof_ccount()
+#define PROF_END(s)    prof_add(s, prof_ccount() - prof_start_##s)
+#define PROF_COUNT(c)  prof_count(c)
+
+#else
+
+inline void prof_begin() {}
+inline void prof_frame(int) {}
+inline size_t prof_report(char* buf, size_t cap) { if (cap) buf[0] = 0; return 0; }
+
+#define PROF_SCOPE(s)  do { } while (0)
+#define PROF_BEGIN(s)  do { } while (0)
+#define PROF_END(s)    do { } while (0)
+#define PROF_COUNT(c)  do { } while (0)
+
+#endif
+
+#endif // PROFILER_H
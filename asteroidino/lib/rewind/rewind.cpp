@@ -0,0 +1,324 @@
+/*
+ * rewind.cpp - Rewind ring
+ *
+ * Records lie back to back in one byte ring, each a 12-byte header and
+ * its payload, padded to 4 bytes. A record that does not fit before the
+ * end of the buffer starts at offset 0 again, behind a WRAP marker (or
+ * none, if not even a header fits). Space for a new record is made by
+ * dropping the oldest ones, always up to the next key image, so the
+ * oldest record is a key image and every delta has its reference.
+ *
+ * A delta is the XOR of the image against the previous snapshot as runs
+ * of a 16-bit header (bit 15 = literal, low 15 bits = length; the same
+ * scheme as the vector logger's frame encoding): zero runs skip
+ * unchanged bytes, literal runs carry the XOR bytes. Zero runs shorter
+ * than RUN_MIN stay inside a literal, so a delta is never more than a
+ * few bytes larger than the image, and an unchanged tail is left out.
+ * Key images use the same runs against an all-zero image (raw when
+ * that is not shorter), which leaves out the unused parts of RAM.
+ */
+
+#include "../../src/config.h"  // MUST be first for REWIND_*
+#include "rewind.h"
+#include <stddef.h>
+
+#ifndef ASTEROIDINO_NATIVE
+#include <esp_heap_caps.h>
+#endif
+
+#define REC_KEY    1
+#define REC_DELTA  2
+#define REC_INPUT  3
+#define REC_WRAP   4
+
+#define RUN_LITERAL  0x8000
+#define RUN_MAX      0x7FFF
+#define RUN_MIN      4        // Shortest zero run worth its header
+
+struct rewind_record {
+    uint32_t frame;
+    uint32_t aux;             // Input ports
+    uint16_t len;             // Payload bytes
+    uint8_t  type;
+    uint8_t  reserved;
+};
+
+#define REC_HEADER  sizeof(rewind_record)
+
+static inline size_t rec_bytes(size_t len) {
+    return (REC_HEADER + len + 3) & ~(size_t)3;
+}
+
+// Largest delta for an image of n bytes
+static inline size_t delta_bound(size_t n) {
+    return n + 2 * (n / RUN_MAX + 1);
+}
+
+static size_t put_run(uint8_t* out, uint16_t run) {
+    memcpy(out, &run, 2);
+    return 2;
+}
+
+// XOR of 'image' against 'prev' (nullptr: all zero) as runs; returns
+// the encoded length
+static size_t rewind_encode(const uint8_t* prev, const uint8_t* image, size_t n, uint8_t* out) {
+    auto ref = [prev](size_t i) -> uint8_t { return prev ? prev[i] : 0; };
+    size_t o = 0, i = 0;
+    while (i < n) {
+        size_t z = i;
+        while (z < n && ref(z) == image[z]) z++;
+        if (z == n) break;                 // Unchanged tail: left out
+        if (z - i >= RUN_MIN) {
+            for (size_t left = z - i; left; ) {
+                size_t run = (left > RUN_MAX) ? RUN_MAX : left;
+                o += put_run(out + o, run);
+                left -= run;
+            }
+            i = z;
+            continue;
+        }
+
+        // Literal up to the next zero run of RUN_MIN (or the end)
+        size_t l = i;
+        while (l < n) {
+            if (ref(l) != image[l]) {
+                l++;
+                continue;
+            }
+            size_t e = l;
+            while (e < n && ref(e) == image[e] && e - l < RUN_MIN) e++;
+            if (e - l >= RUN_MIN || e == n) break;
+            l = e;
+        }
+        while (i < l) {
+            size_t run = (l - i > RUN_MAX) ? RUN_MAX : l - i;
+            o += put_run(out + o, RUN_LITERAL | run);
+            for (size_t k = 0; k < run; k++) out[o + k] = ref(i + k) ^ image[i + k];
+            o += run;
+            i += run;
+        }
+    }
+    return o;
+}
+
+// Turn the previous image into the next one
+static void rewind_apply(uint8_t* image, const uint8_t* d, size_t len) {
+    size_t pos = 0;
+    for (size_t i = 0; i + 2 <= len; ) {
+        uint16_t run;
+        memcpy(&run, d + i, 2);
+        i += 2;
+        size_t n = run & RUN_MAX;
+        if (run & RUN_LITERAL) {
+            for (size_t k = 0; k < n; k++) image[pos + k] ^= d[i + k];
+            i += n;
+        }
+        pos += n;
+    }
+}
+
+bool RewindRing::begin(size_t heap_bytes, size_t psram_bytes, size_t image_size_,
+                       uint16_t key_interval_) {
+    if (delta_bound(image_size_) > 0xFFFF) return false;  // Record lengths are 16 bits
+    image_size = image_size_;
+    key_interval = key_interval_ ? key_interval_ : 1;
+    size_t bytes = heap_bytes;
+    in_psram = false;
+#ifndef ASTEROIDINO_NATIVE
+    if (psram_bytes && psramFound()) {
+        data = (uint8_t*)heap_caps_malloc(psram_bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (data) {
+            bytes = psram_bytes;
+            in_psram = true;
+        }
+    }
+#else
+    (void)psram_bytes;
+#endif
+    if (!data) data = (uint8_t*)malloc(bytes);
+    prev = (uint8_t*)malloc(image_size);
+    if (!data || !prev) {
+        free(data);
+        free(prev);
+        data = prev = nullptr;
+        return false;
+    }
+    capacity = bytes & ~(size_t)3;
+    clear();
+    return true;
+}
+
+void RewindRing::clear() {
+    head = tail = cursor = 0;
+    cursor_left = 0;
+    records = snapshots = keys = 0;
+    first_frame = last_frame = 0;
+    since_key = 0;
+    have_prev = false;
+}
+
+size_t RewindRing::used() const {
+    if (!records) return 0;
+    if (head > tail) return head - tail;
+    return capacity - tail + head;
+}
+
+// Position of the record at or after a read position
+size_t RewindRing::at(size_t pos) const {
+    if (capacity - pos < REC_HEADER) return 0;
+    if (data[pos + offsetof(rewind_record, type)] == REC_WRAP) return 0;
+    return pos;
+}
+
+void RewindRing::drop_oldest() {
+    // Deltas without their key image are of no use, and neither are
+    // inputs before the first snapshot
+    do {
+        tail = at(tail);
+        rewind_record h;
+        memcpy(&h, data + tail, REC_HEADER);
+        if (h.type == REC_KEY) keys--;
+        if (h.type == REC_KEY || h.type == REC_DELTA) snapshots--;
+        tail += rec_bytes(h.len);
+        records--;
+    } while (records && data[at(tail) + offsetof(rewind_record, type)] != REC_KEY);
+
+    if (!records) {
+        head = tail = 0;
+        return;
+    }
+    tail = at(tail);
+    memcpy(&first_frame, data + tail, sizeof(first_frame));
+}
+
+// Contiguous space for a record of 'bytes', dropping old ones as needed
+uint8_t* RewindRing::reserve(size_t bytes) {
+    if (bytes > capacity) return nullptr;
+    while (true) {
+        if (!records) {
+            head = tail = 0;
+            return data;
+        }
+        if (head > tail) {
+            if (capacity - head >= bytes) return data + head;
+            if (tail >= bytes) {
+                if (capacity - head >= REC_HEADER) data[head + offsetof(rewind_record, type)] = REC_WRAP;
+                head = 0;
+                return data;
+            }
+        } else if (head < tail && tail - head >= bytes) {
+            return data + head;
+        }
+        drop_oldest();
+    }
+}
+
+void RewindRing::commit(uint8_t type, uint32_t frame, uint32_t aux, size_t len) {
+    rewind_record h = { frame, aux, (uint16_t)len, type, 0 };
+    memcpy(data + head, &h, REC_HEADER);
+    head += rec_bytes(len);
+    records++;
+    last_frame = frame;
+}
+
+void RewindRing::input(uint32_t frame, uint32_t ports) {
+    if (!data || !snapshots) return;
+    if (!reserve(rec_bytes(0)) || !snapshots) return;
+    commit(REC_INPUT, frame, ports, 0);
+}
+
+void RewindRing::push(uint32_t frame, uint32_t ports, const uint8_t* image) {
+    if (!data) return;
+    uint8_t* p = reserve(rec_bytes(delta_bound(image_size)));
+    if (!p) return;
+    uint8_t* payload = p + REC_HEADER;
+
+    // A key image when due, or when making room took the reference
+    bool key = !have_prev || !snapshots || since_key + 1 >= key_interval;
+    size_t len = image_size;
+    if (!key) {
+        len = rewind_encode(prev, image, image_size, payload);
+        if (len >= image_size) key = true;
+    }
+    if (key) {
+        // Most of RAM is zero: as runs against an empty image, raw if
+        // that is not shorter
+        len = rewind_encode(nullptr, image, image_size, payload);
+        if (len >= image_size) {
+            memcpy(payload, image, image_size);
+            len = image_size;
+        }
+        since_key = 0;
+        keys++;
+    } else {
+        since_key++;
+        delta_count++;
+        delta_bytes += len;
+    }
+
+    commit(key ? REC_KEY : REC_DELTA, frame, ports, len);
+    if (++snapshots == 1) first_frame = frame;
+    memcpy(prev, image, image_size);
+    have_prev = true;
+}
+
+bool RewindRing::restore(uint32_t frame, uint8_t* image, uint32_t* at_frame, uint32_t* ports) {
+    if (!data || !snapshots) return false;
+
+    // Find the last key image at or before 'frame'
+    size_t pos = tail, key_pos = 0;
+    uint32_t left = records, key_left = 0;
+    bool found = false;
+    for (; left; left--) {
+        pos = at(pos);
+        rewind_record h;
+        memcpy(&h, data + pos, REC_HEADER);
+        if (h.frame > frame) break;
+        if (h.type == REC_KEY) {
+            key_pos = pos;
+            key_left = left;
+            found = true;
+        }
+        pos += rec_bytes(h.len);
+    }
+    if (!found) return false;
+
+    // Apply the deltas after it up to 'frame'
+    pos = key_pos;
+    for (left = key_left; left; left--) {
+        pos = at(pos);
+        rewind_record h;
+        memcpy(&h, data + pos, REC_HEADER);
+        if (h.frame > frame) break;
+        const uint8_t* payload = data + pos + REC_HEADER;
+        if (h.type == REC_KEY && h.len == image_size) {
+            memcpy(image, payload, image_size);
+        } else if (h.type == REC_KEY) {
+            memset(image, 0, image_size);
+            rewind_apply(image, payload, h.len);
+        } else if (h.type == REC_DELTA) {
+            rewind_apply(image, payload, h.len);
+        }
+        pos += rec_bytes(h.len);
+        if (h.type == REC_KEY || h.type == REC_DELTA) {
+            *at_frame = h.frame;
+            *ports = h.aux;
+            cursor = pos;
+            cursor_left = left - 1;
+        }
+    }
+    return true;
+}
+
+bool RewindRing::replay(uint32_t frame, uint32_t* ports) {
+    while (cursor_left) {
+        size_t pos = at(cursor);
+        rewind_record h;
+        memcpy(&h, data + pos, REC_HEADER);
+        if (h.frame > frame) return true;
+        if (h.type == REC_INPUT) *ports = h.aux;
+        cursor = pos + rec_bytes(h.len);
+        cursor_left--;
+    }
+    return frame <= last_frame;
+}
@@ -0,0 +1,81 @@
+/*
+ * rewind.h - Ringpuffer für Zustände der letzten Sekunden
+ *
+ * Speichert Savestate-Abbilder in festen Abständen: jedes
+ * REWIND_KEY_INTERVAL-te vollständig (Key-Frame), dazwischen nur
+ * XOR gegen das vorige Abbild, lauflängenkodiert (fast nur Nullen, da
+ * sich von RAM und Vector-RAM pro Snapshot wenig ändert). Dazwischen
+ * liegen die Eingabe-Änderungen, so dass ab jedem Snapshot Frame für
+ * Frame nachgespielt werden kann. Ist der Speicher voll, fallen die
+ * ältesten Einträge heraus, immer bis zum nächsten Key-Frame. Der
+ * Speicher kommt aus dem PSRAM, wenn vorhanden, sonst aus dem Heap.
+ */
+
+#ifndef REWIND_H
+#define REWIND_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef REWIND_ENABLE
+#error "config.h must be included before rewind.h"
+#endif
+
+class RewindRing {
+public:
+    // Ring for images of 'image_size' bytes, a key image every
+    // 'key_interval' snapshots: 'psram_bytes' in PSRAM if the board has
+    // it (0 = never), 'heap_bytes' of internal heap otherwise. False if
+    // the memory is not available.
+    bool begin(size_t heap_bytes, size_t psram_bytes, size_t image_size, uint16_t key_interval);
+
+    // Drop everything; the next snapshot is a key image
+    void clear();
+
+    // Record the input ports in effect from 'frame' on
+    void input(uint32_t frame, uint32_t ports);
+
+    // Record the snapshot taken at 'frame' (ports: inputs in effect)
+    void push(uint32_t frame, uint32_t ports, const uint8_t* image);
+
+    // Rebuild the newest snapshot at or before 'frame' into 'image'
+    // (image_size bytes). Gives its frame and input ports, and starts the
+    // replay after it. False if 'frame' is older than the ring.
+    bool restore(uint32_t frame, uint8_t* image, uint32_t* at, uint32_t* ports);
+
+    // During a replay: the recorded inputs up to and including 'frame'
+    // go to 'ports'. Returns false once 'frame' is past the newest
+    // record, i.e. recording can take over again.
+    bool replay(uint32_t frame, uint32_t* ports);
+
+    // Statistics
+    size_t   capacity = 0;       // Ring bytes
+    bool     in_psram = false;
+    uint16_t key_interval = 0;
+    size_t   used() const;       // Bytes taken by records
+    uint32_t records = 0;        // Records in the ring
+    uint32_t snapshots = 0;      // Snapshots in the ring (key + delta)
+    uint32_t keys = 0;           // Key images in the ring
+    uint32_t first_frame = 0;    // Oldest snapshot
+    uint32_t last_frame = 0;     // Newest record
+    uint32_t delta_count = 0;    // Deltas pushed since begin()
+    uint64_t delta_bytes = 0;    // Their encoded size
+
+private:
+    uint8_t* data = nullptr;
+    uint8_t* prev = nullptr;     // Last pushed image (delta reference)
+    size_t   image_size = 0;
+    size_t   head = 0;           // Next record goes here
+    size_t   tail = 0;           // Oldest record
+    size_t   cursor = 0;         // Replay position
+    uint32_t cursor_left = 0;    // Records after the cursor
+    uint16_t since_key = 0;
+    bool     have_prev = false;
+
+    size_t   at(size_t pos) const;
+    uint8_t* reserve(size_t bytes);
+    void     commit(uint8_t type, uint32_t frame, uint32_t aux, size_t len);
+    void     drop_oldest();
+};
+
+#endif // REWIND_H
@@ -0,0 +1,395 @@
+/*
+ * sound.cpp - Latch queue and fixed-point synthesis of the Asteroids
+ *             discrete sound circuits
+ *
+ * Core 0 (the emulation task) is the only producer: each latch write is
+ * queued with its master cycle and the emulation publishes how far it has
+ * run after every slice. The render task on core 1 is the only consumer:
+ * it plays the machine clock back SOUND_LATENCY_CYCLES behind the
+ * emulation and applies every event at the sample it falls on, so sound
+ * timing follows emulated time and not how the emulation was sliced.
+ * i2s_write() blocks on free DMA buffers, which paces the task; running
+ * above loop() on core 1, it is never starved by the display.
+ *
+ * The circuits are approximated, not modelled component by component:
+ *   explosion  16-bit LFSR noise, sample-and-hold at a pitch-selected
+ *              rate, 4-bit volume, low-passed
+ *   thump      square wave, 4-bit frequency, heavily low-passed
+ *   saucer     square wave warbled by a triangle LFO (big/small select)
+ *   fire       ship and saucer: square wave sweeping down in pitch with
+ *              a decaying envelope, restarted on each enable
+ *   thrust     low-passed noise with an attack/release envelope
+ *   life       3 kHz square wave while enabled
+ * Everything per sample is integer: phase accumulators, Q15 filters and
+ * Q16 decay factors. Floats are only used once to build the constants.
+ */
+
+#include "../../src/config.h"  // MUST be first for AUDIO_*
+#include "sound.h"
+
+#if AUDIO_ENABLE
+
+#include <atomic>
+#include <math.h>
+#include <driver/i2s.h>
+
+static_assert((AUDIO_QUEUE_SIZE & (AUDIO_QUEUE_SIZE - 1)) == 0,
+              "AUDIO_QUEUE_SIZE must be a power of two");
+
+// I2S0 belongs to the vector DMA output (vector_dac_dma.cpp)
+#define SOUND_I2S_PORT  I2S_NUM_1
+
+#define SOUND_LATENCY_CYCLES  ((uint32_t)CPU_CLOCK_HZ / 1000 * AUDIO_LATENCY_MS)
+
+// Master cycles per output sample, 16.16 fixed point
+#define SOUND_CYCLES_PER_SAMPLE  (((uint64_t)CPU_CLOCK_HZ << 16) / AUDIO_SAMPLE_RATE)
+
+// Board clock (12.096 MHz) dividers feeding the sound circuits
+#define SOUND_MASTER_HZ  (CPU_CLOCK_HZ * 8.0f)
+#define SOUND_NOISE_HZ   (SOUND_MASTER_HZ / 1024)  // ~12 kHz noise clock
+#define SOUND_LIFE_HZ    (SOUND_MASTER_HZ / 4096)  // ~3 kHz
+
+#define SOUND_LFSR_SEED  0xFFFF
+
+// Outputs of the LS259 latch at 0x3C00-0x3C07 (bit = offset)
+#define SOUND_SAUCER      0x01
+#define SOUND_SAUCER_FIRE 0x02
+#define SOUND_SAUCER_SEL  0x04   // 1 = small saucer
+#define SOUND_THRUST      0x08
+#define SOUND_SHIP_FIRE   0x10
+#define SOUND_LIFE        0x20
+
+// Mixer levels (peak sample value per voice)
+#define SOUND_EXPLODE_GAIN  1100   // per volume step (15 steps)
+#define SOUND_THUMP_GAIN    7000
+#define SOUND_SAUCER_GAIN   3000
+#define SOUND_FIRE_GAIN     4000
+#define SOUND_THRUST_GAIN   9000
+#define SOUND_LIFE_GAIN     2500
+
+struct sound_event {
+    uint32_t cycle;   // Master cycle (low 32 bits) of the write
+    uint16_t addr;
+    uint8_t  value;
+};
+
+static sound_event sound_queue[AUDIO_QUEUE_SIZE];
+static std::atomic<uint32_t> sound_head(0);        // Written by core 0
+static std::atomic<uint32_t> sound_tail(0);        // Written by the render task
+static std::atomic<uint32_t> sound_drop_count(0);  // Written by core 0
+static std::atomic<uint32_t> sound_clock(0);       // Emulated master cycle, core 0
+static std::atomic<uint32_t> sound_resync_count(0);
+
+// Constants built by sound_init_tables()
+static struct {
+    uint32_t noise_inc;
+    uint32_t explode_inc[4];   // Sample-and-hold rate per pitch select
+    int32_t  explode_lp;       // Q15 filter coefficients
+    uint32_t thump_inc[16];
+    int32_t  thump_lp;
+    uint32_t saucer_inc[2], saucer_depth[2], saucer_lfo_inc[2];
+    uint32_t fire_start_inc[2];
+    uint32_t fire_sweep;       // Q16 decay factors per sample
+    uint32_t fire_decay;
+    int32_t  thrust_lp;
+    uint32_t life_inc;
+} sc;
+
+// Synthesis state, owned by the render task
+static struct {
+    uint8_t  explode;          // 0x3600: pitch << 6 | volume << 2
+    uint8_t  thump;            // 0x3A00: enable << 4 | frequency
+    uint8_t  latch;            // 0x3C00-0x3C07
+    uint16_t lfsr;
+    uint32_t noise_phase;
+    uint32_t explode_phase;
+    bool     explode_bit;
+    int32_t  explode_out;
+    uint32_t thump_phase;
+    int32_t  thump_out;
+    uint32_t saucer_phase, saucer_lfo;
+    uint32_t fire_phase[2], fire_inc[2];
+    int32_t  fire_env[2];      // Q15
+    int32_t  thrust_env;       // Q15
+    int32_t  thrust_out;
+    uint32_t life_phase;
+    uint64_t pos;              // Master cycle << 16 of the next sample
+    bool     started;
+} snd;
+
+static uint32_t sound_phase_inc(float hz) {
+    return (uint32_t)(hz * (4294967296.0f / AUDIO_SAMPLE_RATE));
+}
+
+// One-pole low-pass coefficient for cutoff 'hz' (Q15)
+static int32_t sound_lp_alpha(float hz) {
+    return (int32_t)(32768.0f * (1.0f - expf(-6.2831853f * hz / AUDIO_SAMPLE_RATE)));
+}
+
+// Per-sample factor for an exponential decay with time constant 'tau' (Q16)
+static uint32_t sound_decay(float tau) {
+    return (uint32_t)(65536.0f * expf(-1.0f / (tau * AUDIO_SAMPLE_RATE)));
+}
+
+static void sound_init_tables() {
+    sc.noise_inc = sound_phase_inc(SOUND_NOISE_HZ);
+
+    // The pitch bits preset the divider in front of the sample-and-hold
+    for (int p = 0; p < 4; p++) {
+        sc.explode_inc[p] = sound_phase_inc(SOUND_NOISE_HZ / (16 - 4 * p));
+    }
+    sc.explode_lp = sound_lp_alpha(3000);
+
+    // Thump oscillator: ~40 Hz at frequency 0 up to ~115 Hz at 15
+    for (int f = 0; f < 16; f++) {
+        sc.thump_inc[f] = sound_phase_inc(40 + 5 * f);
+    }
+    sc.thump_lp = sound_lp_alpha(150);
+
+    // Saucer warble: [0] big, [1] small
+    sc.saucer_inc[0] = sound_phase_inc(560);
+    sc.saucer_depth[0] = sound_phase_inc(160);
+    sc.saucer_lfo_inc[0] = sound_phase_inc(5);
+    sc.saucer_inc[1] = sound_phase_inc(900);
+    sc.saucer_depth[1] = sound_phase_inc(240);
+    sc.saucer_lfo_inc[1] = sound_phase_inc(8);
+
+    // Fire: [0] ship, [1] saucer
+    sc.fire_start_inc[0] = sound_phase_inc(1800);
+    sc.fire_start_inc[1] = sound_phase_inc(1300);
+    sc.fire_sweep = sound_decay(0.12f);
+    sc.fire_decay = sound_decay(0.10f);
+
+    sc.thrust_lp = sound_lp_alpha(250);
+    sc.life_inc = sound_phase_inc(SOUND_LIFE_HZ);
+}
+
+static void sound_reset_state() {
+    memset(&snd, 0, sizeof(snd));
+    snd.lfsr = SOUND_LFSR_SEED;
+}
+
+// Apply one latch write
+static void sound_apply(const sound_event& e) {
+    if (e.addr == 0x3600) {
+        snd.explode = e.value;
+    } else if (e.addr == 0x3A00) {
+        snd.thump = e.value;
+    } else if (e.addr == 0x3E00) {
+        snd.lfsr = SOUND_LFSR_SEED;
+    } else if ((e.addr & 0xFFF8) == 0x3C00) {
+        // LS259: data bit 7 goes to the output selected by the offset
+        uint8_t bit = 1 << (e.addr & 7);
+        uint8_t old = snd.latch;
+        snd.latch = (e.value & 0x80) ? (old | bit) : (old & ~bit);
+
+        uint8_t rising = snd.latch & ~old;
+        if (rising & SOUND_SHIP_FIRE) {
+            snd.fire_inc[0] = sc.fire_start_inc[0];
+            snd.fire_env[0] = 32767;
+        }
+        if (rising & SOUND_SAUCER_FIRE) {
+            snd.fire_inc[1] = sc.fire_start_inc[1];
+            snd.fire_env[1] = 32767;
+        }
+    }
+}
+
+// Square wave from the top bit of a phase accumulator
+static inline int32_t sound_square(uint32_t phase, int32_t gain) {
+    return (phase & 0x80000000u) ? gain : -gain;
+}
+
+static inline int16_t sound_next_sample() {
+    // Noise clock: at most one LFSR step per sample (12 kHz < sample rate)
+    uint32_t p = snd.noise_phase + sc.noise_inc;
+    if (p < snd.noise_phase) {
+        snd.lfsr = (snd.lfsr >> 1) ^ ((snd.lfsr & 1) ? 0xB400 : 0);
+    }
+    snd.noise_phase = p;
+    bool noise = snd.lfsr & 1;
+
+    int32_t mix = 0;
+
+    // Explosion
+    p = snd.explode_phase + sc.explode_inc[snd.explode >> 6];
+    if (p < snd.explode_phase) snd.explode_bit = noise;
+    snd.explode_phase = p;
+    int32_t vol = (snd.explode >> 2) & 0x0F;
+    int32_t x = snd.explode_bit ? vol * SOUND_EXPLODE_GAIN : -vol * SOUND_EXPLODE_GAIN;
+    snd.explode_out += ((x - snd.explode_out) * sc.explode_lp) >> 15;
+    mix += snd.explode_out;
+
+    // Thump
+    x = 0;
+    if (snd.thump & 0x10) {
+        snd.thump_phase += sc.thump_inc[snd.thump & 0x0F];
+        x = sound_square(snd.thump_phase, SOUND_THUMP_GAIN);
+    }
+    snd.thump_out += ((x - snd.thump_out) * sc.thump_lp) >> 15;
+    mix += snd.thump_out;
+
+    // Saucer
+    if (snd.latch & SOUND_SAUCER) {
+        int s = (snd.latch & SOUND_SAUCER_SEL) ? 1 : 0;
+        snd.saucer_lfo += sc.saucer_lfo_inc[s];
+        uint32_t tri = snd.saucer_lfo >> 16;
+        if (tri & 0x8000) tri ^= 0xFFFF;               // 0..0x7FFF and back
+        snd.saucer_phase += sc.saucer_inc[s] + (uint32_t)(((uint64_t)sc.saucer_depth[s] * tri) >> 15);
+        mix += sound_square(snd.saucer_phase, SOUND_SAUCER_GAIN);
+    }
+
+    // Ship and saucer fire
+    for (int f = 0; f < 2; f++) {
+        if (snd.fire_env[f] == 0) continue;
+        snd.fire_phase[f] += snd.fire_inc[f];
+        mix += (sound_square(snd.fire_phase[f], SOUND_FIRE_GAIN) * snd.fire_env[f]) >> 15;
+        snd.fire_inc[f] = (uint32_t)(((uint64_t)snd.fire_inc[f] * sc.fire_sweep) >> 16);
+        snd.fire_env[f] = (int32_t)(((uint32_t)snd.fire_env[f] * sc.fire_decay) >> 16);
+    }
+
+    // Thrust: ~20 ms attack and release
+    int32_t target = (snd.latch & SOUND_THRUST) ? 32767 : 0;
+    snd.thrust_env += (target - snd.thrust_env) >> 9;
+    if (snd.thrust_env) {
+        x = noise ? SOUND_THRUST_GAIN : -SOUND_THRUST_GAIN;
+        snd.thrust_out += ((x - snd.thrust_out) * sc.thrust_lp) >> 15;
+        mix += (snd.thrust_out * snd.thrust_env) >> 15;
+    }
+
+    // Extra life
+    if (snd.latch & SOUND_LIFE) {
+        snd.life_phase += sc.life_inc;
+        mix += sound_square(snd.life_phase, SOUND_LIFE_GAIN);
+    }
+
+    if (mix > 32767) mix = 32767;
+    if (mix < -32768) mix = -32768;
+    return (int16_t)mix;
+}
+
+// Render 'samples' stereo frames, applying each queued write at the
+// sample its cycle falls on
+static void sound_render(int16_t* out, int samples) {
+    uint32_t clock = sound_clock.load(std::memory_order_acquire);
+
+    if (!snd.started) {
+        if (clock == 0) {
+            memset(out, 0, samples * 2 * sizeof(int16_t));
+            return;
+        }
+        snd.pos = (uint64_t)(clock - SOUND_LATENCY_CYCLES) << 16;
+        snd.started = true;
+    }
+
+    // Far behind (emulation unthrottled, or the task was held up) or
+    // caught up with a stalled emulation: back to the target latency.
+    // Writes that were skipped still apply, late.
+    int32_t lag = (int32_t)(clock - (uint32_t)(snd.pos >> 16));
+    if (lag > (int32_t)(4 * SOUND_LATENCY_CYCLES) || lag < (int32_t)(SOUND_LATENCY_CYCLES / 4)) {
+        snd.pos = (uint64_t)(clock - SOUND_LATENCY_CYCLES) << 16;
+        sound_resync_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t tail = sound_tail.load(std::memory_order_relaxed);
+    uint32_t head = sound_head.load(std::memory_order_acquire);
+
+    for (int i = 0; i < samples; i++) {
+        uint32_t now = (uint32_t)(snd.pos >> 16);
+        while (tail != head) {
+            const sound_event& e = sound_queue[tail & (AUDIO_QUEUE_SIZE - 1)];
+            if ((int32_t)(e.cycle - now) > 0) break;
+            sound_apply(e);
+            tail++;
+        }
+
+        int16_t s = sound_next_sample();
+        out[2 * i] = s;
+        out[2 * i + 1] = s;
+
+        // Never play past the emulation: if it stalls, hold the clock
+        if ((int32_t)(clock - now) > 0) snd.pos += SOUND_CYCLES_PER_SAMPLE;
+    }
+
+    sound_tail.store(tail, std::memory_order_release);
+}
+
+void sound_write(uint16_t addr, uint8_t value, uint32_t cycle) {
+    uint32_t head = sound_head.load(std::memory_order_relaxed);
+    if (head - sound_tail.load(std::memory_order_acquire) >= AUDIO_QUEUE_SIZE) {
+        sound_drop_count.store(sound_drop_count.load(std::memory_order_relaxed) + 1,
+                               std::memory_order_relaxed);
+        return;
+    }
+
+    sound_event& e = sound_queue[head & (AUDIO_QUEUE_SIZE - 1)];
+    e.cycle = cycle;
+    e.addr = addr;
+    e.value = value;
+    sound_head.store(head + 1, std::memory_order_release);
+}
+
+void sound_sync(uint32_t cycle) {
+    sound_clock.store(cycle, std::memory_order_release);
+}
+
+uint32_t sound_dropped() {
+    return sound_drop_count.load(std::memory_order_relaxed);
+}
+
+uint32_t sound_resyncs() {
+    return sound_resync_count.load(std::memory_order_relaxed);
+}
+
+// Render one DMA buffer at a time; i2s_write() blocks until one is free
+static void sound_task(void* parameter) {
+    static int16_t buffer[AUDIO_BUFFER_SIZE * 2];
+
+    while (true) {
+        sound_render(buffer, AUDIO_BUFFER_SIZE);
+        size_t written;
+        i2s_write(SOUND_I2S_PORT, buffer, sizeof(buffer), &written, portMAX_DELAY);
+    }
+}
+
+bool sound_begin() {
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
+    config.sample_rate = AUDIO_SAMPLE_RATE;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    config.dma_buf_count = AUDIO_DMA_BUFFERS;
+    config.dma_buf_len = AUDIO_BUFFER_SIZE;
+    config.tx_desc_auto_clear = true;  // Underrun plays silence, not the old buffer
+
+    if (i2s_driver_install(SOUND_I2S_PORT, &config, 0, NULL) != ESP_OK) {
+        Serial.println("Sound: I2S driver install failed");
+        return false;
+    }
+
+    i2s_pin_config_t pins = {};
+    pins.bck_io_num = AUDIO_I2S_BCK;
+    pins.ws_io_num = AUDIO_I2S_WS;
+    pins.data_out_num = AUDIO_I2S_DATA;
+    pins.data_in_num = I2S_PIN_NO_CHANGE;
+    if (i2s_set_pin(SOUND_I2S_PORT, &pins) != ESP_OK) {
+        Serial.println("Sound: I2S pin setup failed");
+        i2s_driver_uninstall(SOUND_I2S_PORT);
+        return false;
+    }
+
+    sound_init_tables();
+    sound_reset_state();
+
+    Serial.printf("Sound: I2S%d %d Hz, %d x %d samples DMA, %d ms behind emulation\n",
+                  SOUND_I2S_PORT, AUDIO_SAMPLE_RATE, AUDIO_DMA_BUFFERS,
+                  AUDIO_BUFFER_SIZE, AUDIO_LATENCY_MS);
+
+    // Core 1 above loop(): preempts the display whenever a DMA buffer
+    // is free, then blocks in i2s_write()
+    xTaskCreatePinnedToCore(sound_task, "sound", 4096, NULL, 3, NULL, 1);
+    return true;
+}
+
+#endif // AUDIO_ENABLE
@@ -0,0 +1,51 @@
+/*
+ * sound.h - Sound der Asteroids-Platine über I2S
+ *
+ * Die CPU schreibt nur Latches (0x3600 Explosion, 0x3A00 Thump,
+ * 0x3C00-0x3C07 Saucer/Schub/Feuer/Extraleben, 0x3E00 Rauschen-Reset).
+ * Jeder Schreibzugriff wird mit seinem Master-Zyklus in eine lock-freie
+ * Queue gelegt; ein eigener Task auf Core 1 setzt die Ereignisse
+ * sample-genau um und synthetisiert die diskreten Schaltungen in
+ * Festkomma (Phasenakkumulatoren, LFSR-Rauschen, einpolige Filter)
+ * direkt in die DMA-Buffer des I2S-DACs.
+ */
+
+#ifndef SOUND_H
+#define SOUND_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef AUDIO_ENABLE
+#error "config.h must be included before sound.h"
+#endif
+
+#if AUDIO_ENABLE
+
+// Install the I2S driver and start the render task (call once from setup)
+bool sound_begin();
+
+// Core 0: queue a write to a sound latch at master cycle 'cycle';
+// never blocks (full queue drops and counts)
+void sound_write(uint16_t addr, uint8_t value, uint32_t cycle);
+
+// Core 0: the emulation has run up to master cycle 'cycle'
+void sound_sync(uint32_t cycle);
+
+// Latch writes dropped because the queue was full
+uint32_t sound_dropped();
+
+// Times the renderer lost track of the emulation clock and jumped
+uint32_t sound_resyncs();
+
+#else
+
+inline bool sound_begin() { return false; }
+inline void sound_write(uint16_t, uint8_t, uint32_t) {}
+inline void sound_sync(uint32_t) {}
+inline uint32_t sound_dropped() { return 0; }
+inline uint32_t sound_resyncs() { return 0; }
+
+#endif
+
+#endif // SOUND_H
@@ -0,0 +1,112 @@
+/*
+ * trace.cpp - Lock-free trace rings and drain task
+ *
+ * Each core has its own single-producer ring: core 0 is the emulation
+ * task (CPU, ZP, VRAM, IO, DVG GO), core 1 is loop() decoding the DVG.
+ * The producer owns head, the drain task owns tail, so neither side
+ * takes a lock. A full ring drops the new record and counts it; the
+ * drain task reports the count, which keeps the emulator timing
+ * independent of the UART.
+ */
+
+#include "../../src/config.h"  // MUST be first for TRACE_*
+#include "trace.h"
+
+#if TRACE_CATEGORIES
+
+#include <atomic>
+
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0,
+              "TRACE_RING_SIZE must be a power of two");
+static_assert(sizeof(trace_record) == 12, "trace_record must stay 12 bytes");
+
+struct trace_ring {
+    trace_record          records[TRACE_RING_SIZE];
+    std::atomic<uint32_t> head{0};     // Written by the producer core
+    std::atomic<uint32_t> tail{0};     // Written by the drain task
+    std::atomic<uint32_t> dropped{0};  // Written by the producer core
+};
+
+static trace_ring trace_rings[2];
+
+std::atomic<uint8_t> trace_mask{TRACE_CATEGORIES};
+
+static const char* const trace_category_names[] = {
+    "CPU", "ZP", "VRAM", "DVG", "IO"
+};
+
+static const char* const trace_event_names[TRACE_EV_COUNT] = {
+    "insn", "zp_write", "zp_reset", "vram_write",
+    "go", "prom", "handler", "vector", "point", "done",
+    "read", "write"
+};
+
+void trace_write(uint8_t category, uint8_t event, uint16_t pc, uint16_t addr, uint16_t value) {
+    trace_ring& r = trace_rings[xPortGetCoreID()];
+    uint32_t head = r.head.load(std::memory_order_relaxed);
+    if (head - r.tail.load(std::memory_order_acquire) >= TRACE_RING_SIZE) {
+        r.dropped.store(r.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    
+    trace_record& t = r.records[head & (TRACE_RING_SIZE - 1)];
+    t.time = ESP.getCycleCount();
+    t.category = category;
+    t.event = event;
+    t.pc = pc;
+    t.addr = addr;
+    t.value = value;
+    r.head.store(head + 1, std::memory_order_release);
+}
+
+uint32_t trace_dropped() {
+    return trace_rings[0].dropped.load(std::memory_order_relaxed) +
+           trace_rings[1].dropped.load(std::memory_order_relaxed);
+}
+
+static void trace_print(int core, const trace_record& t) {
+    const char* cat = "?";
+    for (int i = 0; i < 5; i++) {
+        if (t.category == (1 << i)) cat = trace_category_names[i];
+    }
+    const char* ev = (t.event < TRACE_EV_COUNT) ? trace_event_names[t.event] : "?";
+    Serial.printf("[trace] %d %08X %-4s %-10s pc=%04X addr=%04X value=%04X\n",
+                  core, t.time, cat, ev, t.pc, t.addr, t.value);
+}
+
+// Drain both rings in small batches; when they are empty, sleep a tick
+static void trace_task(void* parameter) {
+    uint32_t reported[2] = { 0, 0 };
+    
+    while (true) {
+        int drained = 0;
+        for (int core = 0; core < 2; core++) {
+            trace_ring& r = trace_rings[core];
+            uint32_t tail = r.tail.load(std::memory_order_relaxed);
+            uint32_t head = r.head.load(std::memory_order_acquire);
+            for (int n = 0; tail != head && n < TRACE_DRAIN_BATCH; n++) {
+                trace_print(core, r.records[tail & (TRACE_RING_SIZE - 1)]);
+                r.tail.store(++tail, std::memory_order_release);
+                drained++;
+            }
+            
+            uint32_t dropped = r.dropped.load(std::memory_order_relaxed);
+            if (dropped != reported[core]) {
+                Serial.printf("[trace] %d dropped %u records\n", core, dropped - reported[core]);
+                reported[core] = dropped;
+            }
+        }
+        if (drained == 0) vTaskDelay(1);
+    }
+}
+
+void trace_begin() {
+    Serial.printf("Trace: categories 0x%02X, %d records per core\n",
+                  TRACE_CATEGORIES, TRACE_RING_SIZE);
+    
+    // Core 1 at loop() priority: time-sliced with the display, never
+    // ahead of the emulation task on core 0
+    xTaskCreatePinnedToCore(trace_task, "trace", 4096, NULL, 1, NULL, 1);
+}
+
+#endif // TRACE_CATEGORIES
@@ -0,0 +1,96 @@
+/*
+ * trace.h - Binär-Trace für die Hot Paths des Emulators
+ *
+ * Kategorien werden in config.h über TRACE_CATEGORIES gewählt. Nicht
+ * gewählte Kategorien kompilieren zu nichts, mit TRACE_CATEGORIES 0
+ * verschwindet der ganze Trace. Aktive Kategorien schreiben Records
+ * fester Größe in einen lock-freien Ring pro Core; ein Task niedriger
+ * Priorität gibt sie über Serial aus, damit die UART das Timing der
+ * Emulation nicht bestimmt. Volle Ringe verwerfen Records (gezählt).
+ * Zur Laufzeit lassen sich einkompilierte Kategorien über trace_mask
+ * (Konsole: "trace") an- und abschalten.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef TRACE_CATEGORIES
+#error "config.h must be included before trace.h"
+#endif
+
+// Categories (bit mask for TRACE_CATEGORIES)
+#define TRACE_CPU   0x01   // Every instruction (PC, registers)
+#define TRACE_ZP    0x02   // Writes to the watched zero page cell TRACE_ZP_ADDR
+#define TRACE_VRAM  0x04   // CPU writes to vector RAM
+#define TRACE_DVG   0x08   // DVG GO, PROM steps, vectors, end of list
+#define TRACE_IO    0x10   // I/O port reads and writes
+
+// Events; field use per event:
+//                        pc        addr           value
+enum TraceEvent : uint8_t {
+    TRACE_EV_INSN,        // CPU PC    X << 8 | A     Y << 8 | P
+    TRACE_EV_ZP_WRITE,    // CPU PC    ZP address     old << 8 | new
+    TRACE_EV_ZP_RESET,    // CPU PC    ZP address     value replaced by 0
+    TRACE_EV_VRAM_WRITE,  // CPU PC    VRAM offset    value
+    TRACE_EV_DVG_GO,      // CPU PC    DVG frame      GO value
+    TRACE_EV_DVG_PROM,    // DVG PC    PROM address   old latch << 8 | new latch
+    TRACE_EV_DVG_HANDLER, // DVG PC    handler        op << 8 | data
+    TRACE_EV_DVG_VECTOR,  // DVG PC    X              intensity << 12 | Y
+    TRACE_EV_DVG_POINT,   // DVG PC    X              intensity << 12 | Y
+    TRACE_EV_DVG_DONE,    // DVG PC    points         halt
+    TRACE_EV_IO_READ,     // CPU PC    port address   value returned
+    TRACE_EV_IO_WRITE,    // CPU PC    port address   value
+    TRACE_EV_COUNT
+};
+
+// One record; time is the CCOUNT of the writing core
+struct trace_record {
+    uint32_t time;
+    uint8_t  category;
+    uint8_t  event;
+    uint16_t pc;
+    uint16_t addr;
+    uint16_t value;
+};
+
+#if TRACE_CATEGORIES
+
+#include <atomic>
+
+// Categories recorded right now: a runtime subset of TRACE_CATEGORIES
+// (console "trace"), all of them after start
+extern std::atomic<uint8_t> trace_mask;
+
+// Start the drain task (call once from setup)
+void trace_begin();
+
+// Append a record to the ring of the calling core; never blocks
+void trace_write(uint8_t category, uint8_t event, uint16_t pc, uint16_t addr, uint16_t value);
+
+// Records dropped so far because a ring was full
+uint32_t trace_dropped();
+
+inline uint8_t trace_get_mask() { return trace_mask.load(std::memory_order_relaxed); }
+inline void trace_set_mask(uint8_t mask) { trace_mask.store(mask & (TRACE_CATEGORIES), std::memory_order_relaxed); }
+
+#define TRACE(cat, ev, pc, addr, value) \
+    do { \
+        if (((TRACE_CATEGORIES) & (cat)) && (trace_get_mask() & (cat))) \
+            trace_write((cat), (ev), (pc), (addr), (value)); \
+    } while (0)
+
+#else
+
+inline void trace_begin() {}
+inline uint32_t trace_dropped() { return 0; }
+inline uint8_t trace_get_mask() { return 0; }
+inline void trace_set_mask(uint8_t) {}
+
+#define TRACE(cat, ev, pc, addr, value) do { } while (0)
+
+#endif
+
+#endif // TRACE_H
@@ -0,0 +1,166 @@
+/*
+ * dac_internal.cpp - VectorDAC backend: ESP32 DAC1/DAC2 (8 bit, X/Y)
+ *
+ * For boards without external DACs: X on DAC1 (GPIO25), Y on DAC2
+ * (GPIO26), Z is the digital VECT_BLANK_PIN. Blocking mode writes the
+ * two DAC registers directly. The stream puts I2S0 into built-in DAC
+ * mode, where each 32-bit stereo sample is one point; a task on core 1
+ * replays the current frame into the I2S DMA ring. The blank pin is not
+ * in step with the samples, so while streaming the beam stays on and
+ * blanked points are left out: a move is a single sample, which the
+ * slow DAC output turns into a short, faint jump.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_DAC_*
+#include "vector_dac.h"
+
+#if VECT_DAC_BACKEND == VECT_DAC_INTERNAL
+
+#include <driver/dac.h>
+
+void VectorDAC::begin() {
+    dac_output_enable(DAC_CHANNEL_1);    // GPIO25 = X
+    dac_output_enable(DAC_CHANNEL_2);    // GPIO26 = Y
+    pinMode(VECT_BLANK_PIN, OUTPUT);
+    digitalWrite(VECT_BLANK_PIN, LOW);   // Start blanked
+
+    // Initialize DAC to center position, beam off
+    setXY(2048, 2048);
+    setIntensity(0);
+
+    measure_point_rate();
+    Serial.printf("Vector DAC initialized: ESP32 DAC1/DAC2 (X, Y 8-bit, Z digital), "
+                 "%u points/s max\n", measured_rate);
+}
+
+void VectorDAC::setXYPacked(uint32_t xy) {
+    dac_output_voltage(DAC_CHANNEL_1, (xy >> 8) & 0xFF);
+    dac_output_voltage(DAC_CHANNEL_2, xy >> 24);
+}
+
+void VectorDAC::setIntensity(uint8_t intensity) {
+    // Digital blanking: 0 = off, >0 = on
+    digitalWrite(VECT_BLANK_PIN, intensity ? HIGH : LOW);
+}
+
+#if VECT_USE_DMA
+
+#include <driver/i2s.h>
+
+#define DAC_I2S_PORT        I2S_NUM_0    // Only I2S0 can drive the built-in DACs
+#define DAC_I2S_BUFFERS     8
+#define DAC_I2S_BUFFER_LEN  256          // Samples per DMA buffer
+
+struct dac_frame {
+    uint32_t* samples;
+    int count;
+};
+
+static dac_frame dac_frames[2];
+static volatile int dac_playing = 0;     // Frame the feed task replays
+static volatile int dac_queued = -1;     // Frame handed over, not picked up yet
+static volatile uint32_t dac_refreshes = 0;
+static int dac_fill = 0;                 // Frame between beginFrame/endFrame
+static uint32_t dac_point_rate = 0;
+
+// One pass of the current frame per i2s_write(); it blocks on free DMA
+// buffers, which paces the task. New frames start at a pass boundary.
+static void dac_feed_task(void*) {
+    while (true) {
+        const dac_frame& f = dac_frames[dac_playing];
+        size_t written;
+        i2s_write(DAC_I2S_PORT, f.samples, f.count * sizeof(uint32_t), &written, portMAX_DELAY);
+        dac_refreshes++;
+        int queued = dac_queued;
+        if (queued >= 0) {
+            dac_playing = queued;
+            dac_queued = -1;
+        }
+    }
+}
+
+bool VectorDAC::beginStream() {
+    for (int f = 0; f < 2; f++) {
+        dac_frames[f].samples = (uint32_t*)malloc(VECT_DMA_MAX_POINTS * sizeof(uint32_t));
+        dac_frames[f].count = 1;
+        if (!dac_frames[f].samples) {
+            for (int i = 0; i <= f; i++) free(dac_frames[i].samples);
+            Serial.println("Vector DAC stream: out of memory");
+            return false;
+        }
+        dac_frames[f].samples[0] = packXY(2048, 2048);
+    }
+
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+    config.sample_rate = VECT_DMA_POINT_RATE;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+    config.dma_buf_count = DAC_I2S_BUFFERS;
+    config.dma_buf_len = DAC_I2S_BUFFER_LEN;
+
+    if (i2s_driver_install(DAC_I2S_PORT, &config, 0, NULL) != ESP_OK) {
+        Serial.println("Vector DAC stream: I2S driver install failed");
+        for (int f = 0; f < 2; f++) free(dac_frames[f].samples);
+        return false;
+    }
+    i2s_set_pin(DAC_I2S_PORT, NULL);     // Built-in DACs, no pins to route
+    i2s_set_dac_mode(I2S_DAC_CHANNEL_BOTH_EN);
+    dac_point_rate = (uint32_t)i2s_get_clk(DAC_I2S_PORT);
+
+    // The stream cannot blank, see the top of this file
+    setIntensity(255);
+    streaming = true;
+
+    dac_playing = 0;
+    dac_queued = -1;
+    dac_fill = 0;
+    // Core 1 above loop(), below the sound task
+    xTaskCreatePinnedToCore(dac_feed_task, "dac", 2048, NULL, 2, NULL, 1);
+
+    Serial.printf("Vector DAC stream: I2S0 built-in DAC, %u points/s, %d points/frame max\n",
+                 dac_point_rate, VECT_DMA_MAX_POINTS);
+    return true;
+}
+
+bool VectorDAC::beginFrame() {
+    if (dac_queued >= 0) return false;
+    dac_fill = dac_playing ^ 1;
+    dac_frames[dac_fill].count = 0;
+    return true;
+}
+
+void VectorDAC::addPoint(uint16_t x, uint16_t y, uint8_t intensity) {
+    addPacked(packXY(x, y), intensity);
+}
+
+void VectorDAC::addPacked(uint32_t xy, uint8_t intensity) {
+    dac_frame& f = dac_frames[dac_fill];
+    if (!intensity || f.count >= VECT_DMA_MAX_POINTS) return;
+#if VECT_DAC_INT_SWAP
+    xy = (xy >> 16) | (xy << 16);
+#endif
+    f.samples[f.count++] = xy;
+}
+
+void VectorDAC::endFrame() {
+    // The feed loop needs at least one sample
+    dac_frame& f = dac_frames[dac_fill];
+    if (f.count == 0) f.samples[f.count++] = packXY(2048, 2048);
+
+    __sync_synchronize();
+    dac_queued = dac_fill;
+}
+
+uint32_t VectorDAC::pointRate() {
+    return dac_point_rate;
+}
+
+uint32_t VectorDAC::frameRefreshes() {
+    return dac_refreshes;
+}
+
+#endif  // VECT_USE_DMA
+
+#endif  // VECT_DAC_BACKEND == VECT_DAC_INTERNAL
@@ -0,0 +1,75 @@
+/*
+ * dac_mcp4821.cpp - VectorDAC backend: 3x MCP4821 (X, Y, Z analog)
+ *
+ * One CS per chip on a shared SCK/SDI. Without LDAC (VECT_SPI_LDAC -1,
+ * pin tied to GND) each output moves on its CS rising edge; with LDAC
+ * wired to all three chips X and Y latch together after both words.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_DAC_*
+#include "vector_dac.h"
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+
+void VectorDAC::begin() {
+    spi = &SPI;
+    spi_settings = SPISettings(VECT_SPI_SPEED, MSBFIRST, SPI_MODE0);
+
+    pinMode(VECT_SPI_CS_X, OUTPUT);
+    pinMode(VECT_SPI_CS_Y, OUTPUT);
+    pinMode(VECT_SPI_CS_Z, OUTPUT);
+    digitalWrite(VECT_SPI_CS_X, HIGH);
+    digitalWrite(VECT_SPI_CS_Y, HIGH);
+    digitalWrite(VECT_SPI_CS_Z, HIGH);
+#if VECT_SPI_LDAC >= 0
+    pinMode(VECT_SPI_LDAC, OUTPUT);
+    digitalWrite(VECT_SPI_LDAC, HIGH);
+#endif
+
+    spi->begin(VECT_SPI_CLK, -1, VECT_SPI_MOSI, VECT_SPI_CS_X);
+
+    // Initialize DAC to center position, beam off
+    setXY(2048, 2048);
+    setIntensity(0);
+
+    measure_point_rate();
+    Serial.printf("Vector DAC initialized: 3x MCP4821 (X, Y, Z analog), %u points/s max\n",
+                 measured_rate);
+}
+
+// MCP4821: 16-bit command
+// Bit 15: /SHDN (0=shutdown, 1=active)
+// Bit 14: unused
+// Bit 13: GA (1=1x, 0=2x gain)
+// Bit 12: /BUF (1=unbuffered, 0=buffered)
+// Bit 11-0: Data (12-bit value)
+void VectorDAC::write_word(uint8_t cs_pin, uint16_t word) {
+    digitalWrite(cs_pin, LOW);
+    spi->write16(word);
+    digitalWrite(cs_pin, HIGH);  // Rising edge latches the word
+}
+
+void VectorDAC::setXYPacked(uint32_t xy) {
+    spi->beginTransaction(spi_settings);
+    write_word(VECT_SPI_CS_X, xy & 0xFFFF);  // X-Achse (MCP4821 #1)
+    write_word(VECT_SPI_CS_Y, xy >> 16);     // Y-Achse (MCP4821 #2)
+    spi->endTransaction();
+#if VECT_SPI_LDAC >= 0
+    digitalWrite(VECT_SPI_LDAC, LOW);        // Both outputs move now
+    digitalWrite(VECT_SPI_LDAC, HIGH);
+#endif
+}
+
+void VectorDAC::setIntensity(uint8_t intensity) {
+    // Z-Achse: 8-bit -> 12-bit conversion (0-255 -> 0-4095)
+    uint16_t z_value = (intensity > 0) ? ((uint16_t)intensity << 4) | (intensity >> 4) : 0;
+    spi->beginTransaction(spi_settings);
+    write_word(VECT_SPI_CS_Z, DAC_CMD_SINGLE | (z_value & 0x0FFF));  // MCP4821 #3
+    spi->endTransaction();
+#if VECT_SPI_LDAC >= 0
+    digitalWrite(VECT_SPI_LDAC, LOW);
+    digitalWrite(VECT_SPI_LDAC, HIGH);
+#endif
+}
+
+#endif  // VECT_DAC_BACKEND == VECT_DAC_MCP4821
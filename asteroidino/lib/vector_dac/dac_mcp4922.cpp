@@ -0,0 +1,63 @@
+/*
+ * dac_mcp4922.cpp - VectorDAC backend: 1x MCP4922 (X, Y analog, Z digital)
+ *
+ * Both command words go out in one SPI transaction with only the CS
+ * pulse between them (the MCP4922 takes one 16-bit word per CS frame),
+ * into the input registers while LDAC is high. The LDAC pulse after the
+ * Y word moves both outputs at the same instant, so the beam goes
+ * straight to the new point instead of skewing along X first.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_DAC_*
+#include "vector_dac.h"
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4922
+
+void VectorDAC::begin() {
+    spi = &SPI;
+    spi_settings = SPISettings(VECT_SPI_SPEED, MSBFIRST, SPI_MODE0);
+
+    pinMode(VECT_SPI_CS, OUTPUT);
+    pinMode(VECT_SPI_LDAC, OUTPUT);
+    pinMode(VECT_BLANK_PIN, OUTPUT);
+    digitalWrite(VECT_SPI_CS, HIGH);
+    digitalWrite(VECT_SPI_LDAC, HIGH);   // Hold the outputs while loading
+    digitalWrite(VECT_BLANK_PIN, LOW);   // Start blanked
+
+    spi->begin(VECT_SPI_CLK, -1, VECT_SPI_MOSI, VECT_SPI_CS);
+
+    // Initialize DAC to center position, beam off
+    setXY(2048, 2048);
+    setIntensity(0);
+
+    measure_point_rate();
+    Serial.printf("Vector DAC initialized: 1x MCP4922 (X, Y analog, LDAC, Z digital), "
+                 "%u points/s max\n", measured_rate);
+}
+
+// MCP4922: 16-bit command
+// Bit 15: Channel (0=A, 1=B)
+// Bit 14: Buffered (0=unbuffered)
+// Bit 13: Gain (1=1x, 0=2x)
+// Bit 12: Shutdown (1=active, 0=shutdown)
+// Bit 11-0: Data (12-bit value)
+void VectorDAC::setXYPacked(uint32_t xy) {
+    spi->beginTransaction(spi_settings);
+    digitalWrite(VECT_SPI_CS, LOW);
+    spi->write16(xy & 0xFFFF);           // Channel A = X
+    digitalWrite(VECT_SPI_CS, HIGH);     // Into input register A
+    digitalWrite(VECT_SPI_CS, LOW);
+    spi->write16(xy >> 16);              // Channel B = Y
+    digitalWrite(VECT_SPI_CS, HIGH);     // Into input register B
+    spi->endTransaction();
+
+    digitalWrite(VECT_SPI_LDAC, LOW);    // Both outputs move now
+    digitalWrite(VECT_SPI_LDAC, HIGH);
+}
+
+void VectorDAC::setIntensity(uint8_t intensity) {
+    // Digital blanking: 0 = off, >0 = on
+    digitalWrite(VECT_BLANK_PIN, intensity ? HIGH : LOW);
+}
+
+#endif  // VECT_DAC_BACKEND == VECT_DAC_MCP4922
@@ -1,116 +1,27 @@
 /*
- * vector_dac.cpp - SPI DAC Implementation
- * Supports: MCP4922 (Dual) and MCP4821 (Single)
+ * vector_dac.cpp - Backend-independent part of VectorDAC
+ * The backends (dac_*.cpp) provide begin(), setXYPacked() and
+ * setIntensity(); everything here is built on those.
  */
 
-#include "../../src/config.h"  // MUST be first for VECT_USE_MCP4821
+#include "../../src/config.h"  // MUST be first for VECT_DAC_*
 #include "vector_dac.h"
 
-void VectorDAC::begin() {
-    spi = &SPI;
-    spi_settings = SPISettings(VECT_SPI_SPEED, MSBFIRST, SPI_MODE0);
-    
-#if VECT_USE_MCP4821
-    // 3x MCP4821 (X, Y, Z)
-    cs_x_pin = VECT_SPI_CS_X;
-    cs_y_pin = VECT_SPI_CS_Y;
-    cs_z_pin = VECT_SPI_CS_Z;
-    
-    pinMode(cs_x_pin, OUTPUT);
-    pinMode(cs_y_pin, OUTPUT);
-    pinMode(cs_z_pin, OUTPUT);
-    digitalWrite(cs_x_pin, HIGH);
-    digitalWrite(cs_y_pin, HIGH);
-    digitalWrite(cs_z_pin, HIGH);
-    
-    spi->begin(VECT_SPI_CLK, -1, VECT_SPI_MOSI, cs_x_pin);
-    
-    Serial.println("Vector DAC initialized: 3x MCP4821 (X, Y, Z analog)");
-#else
-    // 1x MCP4922 (Dual DAC) + digital Z
-    cs_pin = VECT_SPI_CS;
-    blank_pin = VECT_BLANK_PIN;
-    
-    pinMode(cs_pin, OUTPUT);
-    pinMode(blank_pin, OUTPUT);
-    digitalWrite(cs_pin, HIGH);
-    digitalWrite(blank_pin, LOW);  // Start blanked
-    
-    spi->begin(VECT_SPI_CLK, -1, VECT_SPI_MOSI, cs_pin);
-    
-    Serial.println("Vector DAC initialized: 1x MCP4922 (X, Y analog, Z digital)");
-#endif
-    
-    // Initialize DAC to center position, beam off
-    setXY(2048, 2048);
-    setIntensity(0);  // Beam off
-}
-
-
-#if VECT_USE_MCP4821
-// MCP4821: Single DAC (3 chips for X, Y, Z)
-void VectorDAC::write_dac_single(uint8_t cs_pin, uint16_t value) {
-    // MCP4821: 16-bit command
-    // Bit 15: /SHDN (0=shutdown, 1=active)
-    // Bit 14: unused
-    // Bit 13: GA (1=1x, 0=2x gain)
-    // Bit 12: /BUF (1=unbuffered, 0=buffered)
-    // Bit 11-0: Data (12-bit value)
-    
-    uint16_t cmd = DAC_CMD_SINGLE | (value & 0x0FFF);
-    
-    spi->beginTransaction(spi_settings);
-    digitalWrite(cs_pin, LOW);
-    spi->write16(cmd);
-    digitalWrite(cs_pin, HIGH);
-    spi->endTransaction();
-}
-
-void VectorDAC::setXY(uint16_t x, uint16_t y) {
-    x &= 0x0FFF;  // Clamp to 12-bit
-    y &= 0x0FFF;
-    
-    write_dac_single(cs_x_pin, x);  // X-Achse (MCP4821 #1)
-    delayMicroseconds(1);
-    write_dac_single(cs_y_pin, y);  // Y-Achse (MCP4821 #2)
-}
-
-void VectorDAC::setIntensity(uint8_t intensity) {
-    // Z-Achse: 8-bit -> 12-bit conversion (0-255 -> 0-4095)
-    // Scale: intensity * 16 (with slight adjustment)
-    uint16_t z_value = (intensity > 0) ? ((uint16_t)intensity << 4) | (intensity >> 4) : 0;
-    write_dac_single(cs_z_pin, z_value);  // Z-Achse (MCP4821 #3)
-}
+#define DAC_MEASURE_POINTS  256   // Points timed for maxPointRate()
 
+const char* VectorDAC::name() {
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+    return "3x MCP4821";
+#elif VECT_DAC_BACKEND == VECT_DAC_MCP4922
+    return "MCP4922 + LDAC";
 #else
-// MCP4922: Dual DAC (1 chip, 2 channels)
-void VectorDAC::write_dac(uint8_t channel, uint16_t value) {
-    // MCP4922: 16-bit command
-    // Bit 15: Channel (0=A, 1=B)
-    // Bit 14: Buffered (0=unbuffered)
-    // Bit 13: Gain (1=1x, 0=2x)
-    // Bit 12: Shutdown (1=active, 0=shutdown)
-    // Bit 11-0: Data (12-bit value)
-    
-    uint16_t cmd = (channel ? DAC_CMD_B : DAC_CMD_A) | (value & 0x0FFF);
-    
-    spi->beginTransaction(spi_settings);
-    digitalWrite(VECT_SPI_CS, LOW);
-    spi->write16(cmd);
-    digitalWrite(VECT_SPI_CS, HIGH);
-    spi->endTransaction();
+    return "ESP32 DAC1/DAC2";
+#endif
 }
 
 void VectorDAC::setXY(uint16_t x, uint16_t y) {
-    // Clamp to 12-bit range
-    x &= 0x0FFF;
-    y &= 0x0FFF;
-    
-    write_dac(0, x);  // Channel A = X
-    delayMicroseconds(1);  // Short settling time
-    write_dac(1, y);  // Channel B = Y
+    setXYPacked(packXY(x, y));  // Clamps to 12-bit
 }
-#endif  // VECT_USE_MCP4821
 
 void VectorDAC::blank() {
     // Beam off: Z = 0
@@ -122,17 +33,27 @@ void VectorDAC::unblank() {
     setIntensity(255);
 }
 
-#if !VECT_USE_MCP4821
-// Only needed for MCP4922 (digital Z fallback)
-void VectorDAC::setIntensity(uint8_t intensity) {
-    // Digital blanking: 0 = off, >0 = on
-    if (intensity > 0) {
-        digitalWrite(blank_pin, HIGH);
-    } else {
-        digitalWrite(blank_pin, LOW);
+// Time back-to-back positions with the beam off, the way render_vectors
+// sends them (dwell not included); called by the backends' begin()
+uint32_t VectorDAC::measure_point_rate() {
+    uint32_t xy[2] = { packXY(2032, 2048), packXY(2064, 2048) };
+    setIntensity(0);
+    unsigned long start = micros();
+    for (int i = 0; i < DAC_MEASURE_POINTS; i++) {
+        setXYPacked(xy[i & 1]);
     }
+    unsigned long us = micros() - start;
+    setXY(2048, 2048);
+    measured_rate = (uint32_t)((uint64_t)DAC_MEASURE_POINTS * 1000000 / max(us, 1UL));
+    return measured_rate;
 }
+
+uint32_t VectorDAC::maxPointRate() {
+#if VECT_USE_DMA
+    if (streaming) return pointRate();
 #endif
+    return measured_rate;
+}
 
 void VectorDAC::setXYZ(uint16_t x, uint16_t y, uint8_t intensity) {
     setXY(x, y);
@@ -140,7 +61,7 @@ void VectorDAC::setXYZ(uint16_t x, uint16_t y, uint8_t intensity) {
 }
 
 void VectorDAC::test_pattern() {
-    Serial.println("Vector DAC test pattern (3x MCP4821: X, Y, Z)...");
+    Serial.printf("Vector DAC test pattern (%s)...\n", name());
     
     // Test 1: Square with varying intensity
     Serial.println("  - Square with intensity ramp");
@@ -1,9 +1,14 @@
 /*
- * vector_dac.h - SPI DAC Treiber für Vektor-Ausgabe
- * 
- * Unterstützt:
- * - MCP4922 (Dual 12-bit DAC) - Channel A = X, Channel B = Y
- * - MCP4821 (Single 12-bit DAC) - 3 Chips für X, Y, Z
+ * vector_dac.h - DAC Treiber für Vektor-Ausgabe
+ *
+ * Eine Schnittstelle, das Backend wählt VECT_DAC_BACKEND (config.h):
+ * - MCP4821  (Single 12-bit DAC) - 3 Chips für X, Y, Z   (dac_mcp4821.cpp)
+ * - MCP4922  (Dual 12-bit DAC) - Channel A = X, Channel B = Y, LDAC
+ *            übernimmt beide Kanäle gleichzeitig          (dac_mcp4922.cpp)
+ * - INTERNAL (ESP32 DAC1/DAC2, 8 bit) - GPIO25 = X, GPIO26 = Y,
+ *            Stream über I2S0 im DAC-Modus               (dac_internal.cpp)
+ * Gemeinsame Teile (Testbild, Punktrate messen) in vector_dac.cpp, der
+ * DMA-Stream der SPI-DACs in vector_dac_dma.cpp.
  */
 
 #ifndef VECTOR_DAC_H
@@ -11,46 +16,83 @@
 
 #include <Arduino.h>
 #include <SPI.h>
+#include "vector_point.h"
 
 // MCP4922 Commands (Dual DAC)
 #define DAC_CMD_A     0x3000  // Channel A, unbuffered, 1x gain, active
 #define DAC_CMD_B     0xB000  // Channel B, unbuffered, 1x gain, active
 
-// MCP4821 Commands (Single DAC) 
+// MCP4821 Commands (Single DAC)
 #define DAC_CMD_SINGLE 0x3000  // Unbuffered, 1x gain, active
 
 #define DAC_SHUTDOWN  0x0000  // Shutdown
 
 // Forward-declare config - must be included in .cpp before this header
-#ifndef VECT_USE_MCP4821
+#ifndef VECT_DAC_BACKEND
 #error "config.h must be included before vector_dac.h"
 #endif
 
 class VectorDAC {
 public:
+    // Backend part: implemented once per backend
     void begin();
+    void setXYPacked(uint32_t xy);  // Send words from packXY()
+    void setIntensity(uint8_t intensity);  // 0=off, 1-255=brightness
+
+    // Ready-to-send words for a 12-bit X/Y position:
+    // X word in bits 0-15, Y word in bits 16-31
+    static inline uint32_t packXY(uint16_t x, uint16_t y) {
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+        return (uint32_t)(DAC_CMD_SINGLE | (x & 0x0FFF)) |
+               ((uint32_t)(DAC_CMD_SINGLE | (y & 0x0FFF)) << 16);
+#elif VECT_DAC_BACKEND == VECT_DAC_MCP4922
+        return (uint32_t)(DAC_CMD_A | (x & 0x0FFF)) |
+               ((uint32_t)(DAC_CMD_B | (y & 0x0FFF)) << 16);
+#else
+        // Built-in DAC: I2S sample, the DAC takes the upper 8 bits
+        return ((uint32_t)(x & 0x0FF0) << 4) | ((uint32_t)(y & 0x0FF0) << 20);
+#endif
+    }
+
+    // Shared part (vector_dac.cpp)
     void setXY(uint16_t x, uint16_t y);  // 12-bit values (0-4095)
     void setXYZ(uint16_t x, uint16_t y, uint8_t intensity);  // X, Y, Z
     void blank();     // Turn off beam (Z=0)
     void unblank();   // Turn on beam (Z=1)
-    void setIntensity(uint8_t intensity);  // 0=off, 1-15=brightness
     void test_pattern();  // Generate test pattern for oscilloscope
-    
+    const char* name();   // Backend name for reports
+
+    // Points per second the output can take without dwell: measured with
+    // setXYPacked() in begin(), the stream rate once streaming
+    uint32_t maxPointRate();
+
+#if VECT_USE_DMA
+    // DMA streaming (vector_dac_dma.cpp, dac_internal.cpp): the current
+    // frame is replayed continuously at a fixed point rate without CPU
+    // involvement. setXY/setIntensity no longer apply.
+    bool beginStream();   // false if DMA memory is not available
+    bool beginFrame();    // false while the previous frame is not on screen yet
+    void addPoint(uint16_t x, uint16_t y, uint8_t intensity);  // 12-bit X/Y, 8-bit Z
+    void addPacked(uint32_t xy, uint8_t intensity);  // Words from packXY(), 8-bit Z
+    void endFrame();      // Replace the replayed frame at its next boundary
+    uint32_t pointRate();       // Actual points per second
+    uint32_t frameRefreshes();  // Frames replayed since beginStream
+#endif
+
 private:
+    uint32_t measured_rate = 0;  // Blocking points/s from begin()
+    bool streaming = false;
+    uint32_t measure_point_rate();
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+    // 3x MCP4821: separate CS pins for X, Y, Z
+    SPIClass *spi;
+    SPISettings spi_settings;
+    void write_word(uint8_t cs_pin, uint16_t word);
+#elif VECT_DAC_BACKEND == VECT_DAC_MCP4922
+    // 1x MCP4922: one CS, two channels, LDAC + digital Z pin
     SPIClass *spi;
     SPISettings spi_settings;
-    
-#if VECT_USE_MCP4821
-    // 3x MCP4821: separate CS pins for X, Y, Z
-    uint8_t cs_x_pin;
-    uint8_t cs_y_pin;
-    uint8_t cs_z_pin;
-    void write_dac_single(uint8_t cs_pin, uint16_t value);
-#else
-    // 1x MCP4922: one CS, two channels + digital Z pin
-    uint8_t cs_pin;
-    uint8_t blank_pin;
-    void write_dac(uint8_t channel, uint16_t value);
 #endif
 };
 
@@ -0,0 +1,295 @@
+/*
+ * vector_dac_dma.cpp - DMA-Ausgabe der SPI-DACs (I2S0 Parallel-Modus)
+ *
+ * I2S0 runs in LCD (parallel) mode and clocks 16-bit samples out via
+ * DMA. Each sample bit drives one DAC line and the I2S WS output is the
+ * shared SCK, so one sample is one SPI bit. A frame of DAC command words
+ * becomes a plain sample buffer that the DMA replays in a loop at a fixed
+ * point rate; the CPU only touches it when a new frame is built.
+ *
+ * 3x MCP4821: SDI X/Y/Z on separate lines, CS shared -> 18 samples/point
+ * 1x MCP4922: X and Y share SDI/CS, BLANK and LDAC are sample bits
+ *             -> 36 samples/point
+ *
+ * The built-in DACs have their own stream in dac_internal.cpp.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_DAC_*
+#include "vector_dac.h"
+
+#if VECT_USE_DMA && VECT_DAC_BACKEND != VECT_DAC_INTERNAL
+
+#include <esp_heap_caps.h>
+#include <esp_intr_alloc.h>
+#include <driver/gpio.h>
+#include <driver/periph_ctrl.h>
+#include <esp32/rom/gpio.h>
+#include <esp32/rom/lldesc.h>
+#include <soc/gpio_sig_map.h>
+#include <soc/i2s_reg.h>
+#include <soc/i2s_struct.h>
+
+// Sample bits = I2S0 data lines (16-bit mode: DATA_OUT8..23)
+#define DMA_BIT_SDI    0x0001   // SDI (MCP4922) or SDI X (MCP4821)
+#define DMA_BIT_SDI_Y  0x0002   // MCP4821 only
+#define DMA_BIT_SDI_Z  0x0004   // MCP4821 only
+#define DMA_BIT_CS     0x0008   // Low while a command word is shifted in
+#define DMA_BIT_BLANK  0x0010   // MCP4922 only: beam on when set
+#define DMA_BIT_LDAC   0x0020   // MCP4922 only: LDAC low when set (pin inverted)
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+  // 16 data bits, CS high (latch), one pad sample for 32-bit alignment
+  #define DMA_SAMPLES_PER_POINT  18
+#else
+  // 2x (16 data bits + CS high), LDAC pulse, one pad sample
+  #define DMA_SAMPLES_PER_POINT  36
+#endif
+
+#define DMA_DESC_MAX_BYTES  4092   // lldesc length limit, multiple of 4
+#define DMA_FRAME_BYTES     (VECT_DMA_MAX_POINTS * DMA_SAMPLES_PER_POINT * 2)
+#define DMA_DESC_COUNT      ((DMA_FRAME_BYTES + DMA_DESC_MAX_BYTES - 1) / DMA_DESC_MAX_BYTES)
+
+// I2S clock source is PLL_D2 (80 MHz); sample rate = 80 MHz / (div * 2)
+#define DMA_BASE_CLOCK_HZ   80000000
+#define DMA_BCK_DIV         2
+
+// In 16-bit mode I2S0 sends the two halves of each 32-bit FIFO word
+// in swapped order
+#define DMA_SAMPLE_INDEX(i)  ((i) ^ 1)
+
+struct dma_frame {
+    uint16_t* samples;
+    lldesc_t* desc;
+    lldesc_t* last;    // Descriptor with EOF, links back to desc[0]
+};
+
+static dma_frame dma_frames[2];
+static volatile int dma_playing = -1;      // Frame the DMA is looping over
+static volatile int dma_queued = -1;       // Frame linked in, not reached yet
+static volatile uint32_t dma_refreshes = 0;
+static int dma_fill = 0;                   // Frame between beginFrame/endFrame
+static int dma_fill_points = 0;
+static uint32_t dma_point_rate = 0;
+static intr_handle_t dma_intr;
+
+// EOF of a frame's last descriptor: count the refresh, and once the
+// queued frame has played through, the DMA is off the old frame
+static void IRAM_ATTR dma_eof_isr(void*) {
+    uint32_t status = I2S0.int_st.val;
+    I2S0.int_clr.val = status;
+    if (!(status & I2S_OUT_EOF_INT_ST)) return;
+
+    dma_refreshes++;
+    int queued = dma_queued;
+    if (queued >= 0 && (lldesc_t*)I2S0.out_eof_des_addr == dma_frames[queued].last) {
+        dma_playing = queued;
+        dma_queued = -1;
+    }
+}
+
+static void dma_pin(int pin, uint32_t signal, bool invert) {
+    gpio_pad_select_gpio(pin);
+    gpio_set_direction((gpio_num_t)pin, GPIO_MODE_OUTPUT);
+    gpio_matrix_out(pin, signal, invert, false);
+}
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4922
+// One MCP4922 command word: 16 bits with CS low, then CS high to latch
+static inline void dma_encode_word(uint16_t* s, int at, uint16_t word, uint16_t beam) {
+    for (int b = 0; b < 16; b++) {
+        s[DMA_SAMPLE_INDEX(at + b)] = ((word >> (15 - b)) & 1) | beam;
+    }
+    s[DMA_SAMPLE_INDEX(at + 16)] = DMA_BIT_CS | beam;
+}
+#endif
+
+bool VectorDAC::beginStream() {
+    for (int f = 0; f < 2; f++) {
+        dma_frames[f].samples = (uint16_t*)heap_caps_malloc(DMA_FRAME_BYTES, MALLOC_CAP_DMA);
+        dma_frames[f].desc = (lldesc_t*)heap_caps_malloc(DMA_DESC_COUNT * sizeof(lldesc_t), MALLOC_CAP_DMA);
+        if (!dma_frames[f].samples || !dma_frames[f].desc) {
+            for (int i = 0; i <= f; i++) {
+                heap_caps_free(dma_frames[i].samples);
+                heap_caps_free(dma_frames[i].desc);
+            }
+            Serial.printf("Vector DAC DMA: cannot allocate %u bytes of DMA memory\n",
+                         2 * (unsigned)DMA_FRAME_BYTES);
+            return false;
+        }
+    }
+
+    // Release the pins from the SPI peripheral and route I2S0 instead
+    spi->end();
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+    dma_pin(VECT_SPI_MOSI,   I2S0O_DATA_OUT8_IDX + 0, false);
+    dma_pin(VECT_SPI_MOSI_Y, I2S0O_DATA_OUT8_IDX + 1, false);
+    dma_pin(VECT_SPI_MOSI_Z, I2S0O_DATA_OUT8_IDX + 2, false);
+    dma_pin(VECT_SPI_CS_X,   I2S0O_DATA_OUT8_IDX + 3, false);
+    dma_pin(VECT_SPI_CS_Y,   I2S0O_DATA_OUT8_IDX + 3, false);
+    dma_pin(VECT_SPI_CS_Z,   I2S0O_DATA_OUT8_IDX + 3, false);
+#if VECT_SPI_LDAC >= 0
+    digitalWrite(VECT_SPI_LDAC, LOW);  // Outputs follow the shared CS edge
+#endif
+#else
+    dma_pin(VECT_SPI_MOSI,   I2S0O_DATA_OUT8_IDX + 0, false);
+    dma_pin(VECT_SPI_CS,     I2S0O_DATA_OUT8_IDX + 3, false);
+    dma_pin(VECT_BLANK_PIN,  I2S0O_DATA_OUT8_IDX + 4, false);
+    dma_pin(VECT_SPI_LDAC,   I2S0O_DATA_OUT8_IDX + 5, true);
+#endif
+    dma_pin(VECT_SPI_CLK, I2S0O_WS_OUT_IDX, VECT_DMA_CLK_INVERT);
+
+    // Clock divider for the configured point rate
+    uint32_t div = DMA_BASE_CLOCK_HZ / (DMA_BCK_DIV * DMA_SAMPLES_PER_POINT * VECT_DMA_POINT_RATE);
+    if (div < 2) div = 2;
+    if (div > 255) div = 255;
+    dma_point_rate = DMA_BASE_CLOCK_HZ / (DMA_BCK_DIV * DMA_SAMPLES_PER_POINT * div);
+
+    periph_module_enable(PERIPH_I2S0_MODULE);
+
+    I2S0.conf.tx_reset = 1;
+    I2S0.conf.tx_reset = 0;
+    I2S0.conf.tx_fifo_reset = 1;
+    I2S0.conf.tx_fifo_reset = 0;
+    I2S0.lc_conf.out_rst = 1;
+    I2S0.lc_conf.out_rst = 0;
+    I2S0.lc_conf.ahbm_rst = 1;
+    I2S0.lc_conf.ahbm_rst = 0;
+
+    // LCD mode, 16-bit samples, one channel
+    I2S0.conf2.val = 0;
+    I2S0.conf2.lcd_en = 1;
+    I2S0.sample_rate_conf.val = 0;
+    I2S0.sample_rate_conf.tx_bits_mod = 16;
+    I2S0.sample_rate_conf.tx_bck_div_num = DMA_BCK_DIV;
+    I2S0.clkm_conf.val = 0;
+    I2S0.clkm_conf.clka_en = 0;       // PLL_D2_CLK
+    I2S0.clkm_conf.clkm_div_a = 1;
+    I2S0.clkm_conf.clkm_div_b = 0;
+    I2S0.clkm_conf.clkm_div_num = div;
+    I2S0.fifo_conf.val = 0;
+    I2S0.fifo_conf.tx_fifo_mod_force_en = 1;
+    I2S0.fifo_conf.tx_fifo_mod = 1;   // 16-bit single channel
+    I2S0.fifo_conf.tx_data_num = 32;
+    I2S0.fifo_conf.dscr_en = 1;
+    I2S0.conf1.val = 0;
+    I2S0.conf1.tx_stop_en = 0;
+    I2S0.conf1.tx_pcm_bypass = 1;
+    I2S0.conf_chan.val = 0;
+    I2S0.conf_chan.tx_chan_mod = 1;
+    I2S0.timing.val = 0;
+    I2S0.lc_conf.val = 0;
+    I2S0.lc_conf.out_data_burst_en = 1;
+    I2S0.lc_conf.outdscr_burst_en = 1;
+
+    I2S0.int_ena.val = 0;
+    I2S0.int_clr.val = 0xFFFFFFFF;
+    esp_intr_alloc(ETS_I2S0_INTR_SOURCE, ESP_INTR_FLAG_IRAM, dma_eof_isr, nullptr, &dma_intr);
+    I2S0.int_ena.out_eof = 1;
+
+    // Start with a single blanked point at the center
+    dma_playing = -1;
+    dma_queued = -1;
+    dma_fill = 0;
+    dma_fill_points = 0;
+    addPoint(2048, 2048, 0);
+    endFrame();
+    streaming = true;
+
+    Serial.printf("Vector DAC DMA stream: %u points/s, %d points/frame max\n",
+                 dma_point_rate, VECT_DMA_MAX_POINTS);
+    return true;
+}
+
+bool VectorDAC::beginFrame() {
+    if (dma_queued >= 0) return false;
+    dma_fill = dma_playing ^ 1;
+    dma_fill_points = 0;
+    return true;
+}
+
+void VectorDAC::addPoint(uint16_t x, uint16_t y, uint8_t intensity) {
+    addPacked(packXY(x, y), intensity);
+}
+
+void VectorDAC::addPacked(uint32_t xy, uint8_t intensity) {
+    if (dma_fill_points >= VECT_DMA_MAX_POINTS) return;
+    uint16_t* s = dma_frames[dma_fill].samples + dma_fill_points * DMA_SAMPLES_PER_POINT;
+
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
+    // All three DACs shift in parallel and latch on the shared CS edge
+    uint16_t z = (intensity > 0) ? ((uint16_t)intensity << 4) | (intensity >> 4) : 0;
+    uint16_t wx = xy & 0xFFFF;
+    uint16_t wy = xy >> 16;
+    uint16_t wz = DAC_CMD_SINGLE | (z & 0x0FFF);
+    for (int b = 0; b < 16; b++) {
+        int shift = 15 - b;
+        s[DMA_SAMPLE_INDEX(b)] = ((wx >> shift) & 1) |
+                                 (((wy >> shift) & 1) << 1) |
+                                 (((wz >> shift) & 1) << 2);
+    }
+    s[DMA_SAMPLE_INDEX(16)] = DMA_BIT_CS;
+    s[DMA_SAMPLE_INDEX(17)] = DMA_BIT_CS;
+#else
+    uint16_t beam = intensity ? DMA_BIT_BLANK : 0;
+    dma_encode_word(s, 0,  xy & 0xFFFF, beam);
+    dma_encode_word(s, 17, xy >> 16, beam);
+    s[DMA_SAMPLE_INDEX(34)] = DMA_BIT_CS | DMA_BIT_LDAC | beam;  // Both outputs move
+    s[DMA_SAMPLE_INDEX(35)] = DMA_BIT_CS | beam;
+#endif
+
+    dma_fill_points++;
+}
+
+void VectorDAC::endFrame() {
+    // The DMA loop needs at least one point
+    if (dma_fill_points == 0) addPoint(2048, 2048, 0);
+
+    dma_frame& f = dma_frames[dma_fill];
+    uint8_t* buf = (uint8_t*)f.samples;
+    int bytes = dma_fill_points * DMA_SAMPLES_PER_POINT * 2;
+    int n = 0;
+    while (bytes > 0) {
+        int len = (bytes > DMA_DESC_MAX_BYTES) ? DMA_DESC_MAX_BYTES : bytes;
+        lldesc_t* d = &f.desc[n++];
+        d->size = len;
+        d->length = len;
+        d->offset = 0;
+        d->sosf = 0;
+        d->eof = 0;
+        d->owner = 1;
+        d->buf = buf;
+        d->qe.stqe_next = &f.desc[n];
+        buf += len;
+        bytes -= len;
+    }
+    f.last = &f.desc[n - 1];
+    f.last->eof = 1;
+    f.last->qe.stqe_next = &f.desc[0];  // Replay until the next frame
+
+    // Samples and descriptors must be in memory before the DMA can see them
+    __sync_synchronize();
+
+    if (dma_playing < 0) {
+        dma_playing = dma_fill;
+        I2S0.out_link.addr = (uint32_t)&f.desc[0];
+        I2S0.out_link.start = 1;
+        I2S0.conf.tx_start = 1;
+        return;
+    }
+
+    // Link the new frame behind the one on screen; the DMA switches at
+    // the end of the current pass, so a frame is never torn
+    dma_queued = dma_fill;
+    dma_frames[dma_playing].last->qe.stqe_next = &f.desc[0];
+}
+
+uint32_t VectorDAC::pointRate() {
+    return dma_point_rate;
+}
+
+uint32_t VectorDAC::frameRefreshes() {
+    return dma_refreshes;
+}
+
+#endif  // VECT_USE_DMA && VECT_DAC_BACKEND != VECT_DAC_INTERNAL
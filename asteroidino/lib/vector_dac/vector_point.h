@@ -0,0 +1,28 @@
+/*
+ * vector_point.h - Gepacktes Punktformat der Vektorlisten
+ *
+ * One DVG point per 32-bit word, in the DVG's native resolution:
+ *   bits  0-9   X (0-1023)
+ *   bits 10-19  Y (0-1023)
+ *   bits 20-23  Z, intensity of the segment ending here (0 = blanked)
+ */
+
+#ifndef VECTOR_POINT_H
+#define VECTOR_POINT_H
+
+#include <stdint.h>
+
+static inline uint32_t vpoint_pack(uint16_t x, uint16_t y, uint8_t z) {
+    return (uint32_t)(x & 0x3FF) | ((uint32_t)(y & 0x3FF) << 10) | ((uint32_t)(z & 0x0F) << 20);
+}
+
+static inline uint16_t vpoint_x(uint32_t p) { return p & 0x3FF; }
+static inline uint16_t vpoint_y(uint32_t p) { return (p >> 10) & 0x3FF; }
+static inline uint8_t  vpoint_z(uint32_t p) { return (p >> 20) & 0x0F; }
+
+// Same position with a different intensity (0 = blanked move)
+static inline uint32_t vpoint_with_z(uint32_t p, uint8_t z) {
+    return (p & 0xFFFFF) | ((uint32_t)(z & 0x0F) << 20);
+}
+
+#endif // VECTOR_POINT_H
@@ -0,0 +1,105 @@
+/*
+ * vcap_format.h - Indiziertes Aufnahmeformat (LOG_BINARY, .vci)
+ *
+ * Gemeinsam für den Vector Logger (schreibt), das Replay von SD-Karte
+ * (lib/vector_logger/vector_replay.cpp) und tools/vcap_tool.cpp (liest
+ * per mmap). Nur <stdint.h>, damit der Host-Build ohne Arduino auskommt.
+ */
+
+#ifndef VCAP_FORMAT_H
+#define VCAP_FORMAT_H
+
+#include <stdint.h>
+
+/*
+ * Layout (little endian, everything 4-byte aligned):
+ *
+ *   vcap_file_header
+ *   records: u32 magic, u32 payload length, payload
+ *     VFRM  vcap_frame, then 'count' points (u32, vector_point.h)
+ *     VIDX  vcap_index, then 'count' vcap_index_entry (one per frame
+ *           since the previous VIDX, every index_interval frames)
+ *     VEND  vcap_end (written by VectorLogger::end())
+ *   vcap_tail (after VEND)
+ *
+ * Offsets count from the first byte of the file header, so a capture
+ * over Serial that has boot messages in front of the header still
+ * indexes correctly once the reader found the header. Status text that
+ * got in between records shifts everything after it: readers check each
+ * index entry (magic, frame number) against the record it points to,
+ * follow the shift, and otherwise scan for records. Only frames whose
+ * check word matches are taken.
+ */
+#define VCAP_MAGIC        0x31494356   // "VCI1" file header
+#define VCAP_REC_FRAME    0x4D524656   // "VFRM"
+#define VCAP_REC_INDEX    0x58444956   // "VIDX"
+#define VCAP_REC_END      0x444E4556   // "VEND"
+#define VCAP_TAIL_MAGIC   0x4C544356   // "VCTL"
+#define VCAP_VERSION      1
+#define VCAP_NONE         0xFFFFFFFF   // No record (offsets)
+
+#define VCAP_FRAME_REDRAW 0x01         // Same list as the frame before (same cycle)
+
+// Largest payload a reader accepts before it treats a record as garbage
+#define VCAP_MAX_POINTS   16384
+
+struct vcap_file_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t header_size;     // sizeof(vcap_file_header), records follow
+    uint32_t cpu_hz;          // Clock of the frame cycle stamps
+    uint16_t refresh_hz;      // Display rate the frames were taken at
+    uint16_t index_interval;  // Frames per VIDX record
+    uint32_t max_points;      // Point limit of the recording build
+    uint32_t reserved;
+};
+
+struct vcap_record {
+    uint32_t magic;
+    uint32_t length;          // Payload bytes that follow
+};
+
+struct vcap_frame {
+    uint32_t frame;           // Display frame number
+    uint32_t cycle;           // CPU master cycle of the DVG GO that drew the list, 0 = unknown
+    uint16_t count;           // Points that follow
+    uint8_t  flags;           // VCAP_FRAME_*
+    uint8_t  reserved;
+    uint32_t check;           // vcap_check() over the fields above and the points
+};
+
+struct vcap_index {
+    uint32_t prev;            // Offset of the previous VIDX record, VCAP_NONE for the first
+    uint32_t count;           // Entries that follow
+};
+
+struct vcap_index_entry {
+    uint32_t offset;          // Offset of the VFRM record
+    uint32_t frame;
+};
+
+struct vcap_end {
+    uint32_t frames;
+    uint32_t points;
+    uint32_t dropped;         // Frames the logger could not write
+    uint32_t last_index;      // Offset of the last VIDX record, VCAP_NONE without index
+};
+
+struct vcap_tail {
+    uint32_t end;             // Offset of the VEND record
+    uint32_t magic;           // VCAP_TAIL_MAGIC
+};
+
+// FNV-1a over the frame header fields and the points
+static inline uint32_t vcap_check(const vcap_frame& f, const uint32_t* points) {
+    uint32_t h = 2166136261u;
+    h = (h ^ f.frame) * 16777619u;
+    h = (h ^ f.cycle) * 16777619u;
+    h = (h ^ ((uint32_t)f.count | ((uint32_t)f.flags << 16))) * 16777619u;
+    for (uint32_t i = 0; i < f.count; i++) {
+        h = (h ^ points[i]) * 16777619u;
+    }
+    return h;
+}
+
+#endif // VCAP_FORMAT_H
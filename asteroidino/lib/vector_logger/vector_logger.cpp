@@ -1,12 +1,51 @@
 /*
  * vector_logger.cpp - Vector Output Logger Implementation
- * Ausgabe direkt über Serial.write()
+ * Ausgabe direkt über Serial.write(), LOG_UDP über einen Sende-Task,
+ * LOG_BINARY als Frame-Records mit Index (vcap_format.h)
  */
 
+#include "../../src/config.h"  // MUST be first for VECTOR_LOG_*
 #include "vector_logger.h"
+#include <vector_point.h>
+
+#if VECTOR_LOG_UDP
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <freertos/message_buffer.h>
+#endif
 
 VectorLogger vectorLog;  // Globale Instanz
 
+// Worst case of encodeFrame(): header, then a copy run and a one-point
+// literal run for every point
+#define VLOG_ENCODED_MAX  (8 + VECT_POINTS_PER_FRAME * 8)
+
+#if VECTOR_LOG_UDP
+
+/*
+ * The encoder runs in the caller (loop() on core 1) and only queues the
+ * finished datagrams; the Wi-Fi stack is left to this task, so a slow
+ * or missing link costs dropped frames, never display time.
+ */
+
+static MessageBufferHandle_t vlog_udp_buffer = nullptr;
+static WiFiUDP vlog_udp;
+
+static void vlog_udp_task(void* parameter) {
+    static uint8_t dgram[sizeof(vlog_udp_header) + VLOG_UDP_PAYLOAD];
+    
+    while (true) {
+        size_t len = xMessageBufferReceive(vlog_udp_buffer, dgram, sizeof(dgram), portMAX_DELAY);
+        if (len == 0 || WiFi.status() != WL_CONNECTED) continue;  // Receiver resyncs on a key frame
+        
+        vlog_udp.beginPacket(VECTOR_LOG_UDP_HOST, VECTOR_LOG_UDP_PORT);
+        vlog_udp.write(dgram, len);
+        vlog_udp.endPacket();
+    }
+}
+
+#endif // VECTOR_LOG_UDP
+
 VectorLogger::VectorLogger() 
     : logging_active(false)
     , mode(LOG_DISABLED)
@@ -14,6 +53,19 @@ VectorLogger::VectorLogger()
     , frame_count(0)
     , current_frame(0)
     , bytes_written(0)
+    , frames_dropped(0)
+    , prev_points(nullptr)
+    , prev_count(0)
+    , encoded(nullptr)
+    , frames_since_key(0)
+    , force_key(true)
+    , current_cycle(0)
+    , prev_cycle(0)
+    , frame_points(nullptr)
+    , frame_fill(0)
+    , index(nullptr)
+    , index_fill(0)
+    , last_index(VCAP_NONE)
     , min_x(4095), max_x(0)
     , min_y(4095), max_y(0)
     , min_z(4095), max_z(0)
@@ -41,6 +93,15 @@ void VectorLogger::begin(LogMode log_mode) {
         return;
     }
     
+    if (mode == LOG_UDP && !beginUdp()) {
+        mode = LOG_DISABLED;
+        return;
+    }
+    if (mode == LOG_BINARY && !beginBinary()) {
+        mode = LOG_DISABLED;
+        return;
+    }
+    
     logging_active = true;
     resetStats();
     
@@ -58,20 +119,111 @@ void VectorLogger::begin(LogMode log_mode) {
             writeSerial("===========================\n");
             break;
             
-        case LOG_BINARY:
-            // Binary header: Magic "VEC1" + mode byte
-            writeSerial('V');
-            writeSerial('E');
-            writeSerial('C');
-            writeSerial('1');
-            writeSerial((uint8_t)mode);
+        case LOG_BINARY: {
+            // Offsets in the index count from here
+            vcap_file_header h = {};
+            h.magic = VCAP_MAGIC;
+            h.version = VCAP_VERSION;
+            h.header_size = sizeof(h);
+            h.cpu_hz = CPU_CLOCK_HZ;
+            h.refresh_hz = VECT_REFRESH_HZ;
+            h.index_interval = VECTOR_LOG_INDEX;
+            h.max_points = VECT_POINTS_PER_FRAME;
+            writeBytes(&h, sizeof(h));
             break;
+        }
             
         default:
             break;
     }
     
-    Serial.flush();  // Stelle sicher, dass Header gesendet wird
+    if (mode != LOG_UDP) {
+        Serial.flush();  // Stelle sicher, dass Header gesendet wird
+    }
+}
+
+bool VectorLogger::beginUdp() {
+#if VECTOR_LOG_UDP
+    if (!prev_points) {
+        prev_points = (uint32_t*)malloc(VECT_POINTS_PER_FRAME * sizeof(uint32_t));
+        encoded = (uint8_t*)malloc(VLOG_ENCODED_MAX);
+        vlog_udp_buffer = xMessageBufferCreate(VECTOR_LOG_UDP_BUFFER);
+        if (!prev_points || !encoded || !vlog_udp_buffer) {
+            Serial.println("[vlog] UDP capture: out of memory");
+            return false;
+        }
+        
+        WiFi.mode(WIFI_STA);
+        WiFi.begin(VECTOR_LOG_WIFI_SSID, VECTOR_LOG_WIFI_PASS);
+        xTaskCreatePinnedToCore(vlog_udp_task, "vlog_udp", 4096, NULL, 1, NULL, 1);
+    }
+    
+    prev_count = 0;
+    force_key = true;
+    Serial.printf("[vlog] UDP capture to %s:%u (SSID %s)\n",
+                  VECTOR_LOG_UDP_HOST, VECTOR_LOG_UDP_PORT, VECTOR_LOG_WIFI_SSID);
+    return true;
+#else
+    Serial.println("[vlog] UDP capture not available in this build (VECTOR_LOG_UDP)");
+    return false;
+#endif
+}
+
+bool VectorLogger::beginBinary() {
+    if (!frame_points) {
+        frame_points = (uint32_t*)malloc(VECT_POINTS_PER_FRAME * sizeof(uint32_t));
+        index = (vcap_index_entry*)malloc(VECTOR_LOG_INDEX * sizeof(vcap_index_entry));
+        if (!frame_points || !index) {
+            Serial.println("[vlog] Binary capture: out of memory");
+            return false;
+        }
+    }
+    
+    frame_fill = 0;
+    index_fill = 0;
+    last_index = VCAP_NONE;
+    prev_cycle = 0;
+    return true;
+}
+
+void VectorLogger::writeBytes(const void* data, size_t len) {
+    Serial.write((const uint8_t*)data, len);
+    bytes_written += len;
+}
+
+void VectorLogger::writeFrameRecord(const uint32_t* points, int count) {
+    vcap_frame f = {};
+    f.frame = current_frame;
+    f.cycle = current_cycle;
+    f.count = count;
+    f.flags = (current_cycle && current_cycle == prev_cycle) ? VCAP_FRAME_REDRAW : 0;
+    f.check = vcap_check(f, points);
+    prev_cycle = current_cycle;
+    
+    index[index_fill].offset = bytes_written;
+    index[index_fill].frame = current_frame;
+    
+    vcap_record r = { VCAP_REC_FRAME, (uint32_t)(sizeof(f) + count * sizeof(uint32_t)) };
+    writeBytes(&r, sizeof(r));
+    writeBytes(&f, sizeof(f));
+    writeBytes(points, count * sizeof(uint32_t));
+    
+    if (++index_fill == VECTOR_LOG_INDEX) writeIndex();
+}
+
+// Index record for the frames since the last one, chained backwards so
+// a reader gets from the trailer to every frame without scanning
+void VectorLogger::writeIndex() {
+    if (index_fill == 0) return;
+    
+    uint32_t offset = bytes_written;
+    vcap_record r = { VCAP_REC_INDEX, (uint32_t)(sizeof(vcap_index) + index_fill * sizeof(vcap_index_entry)) };
+    vcap_index x = { last_index, (uint32_t)index_fill };
+    writeBytes(&r, sizeof(r));
+    writeBytes(&x, sizeof(x));
+    writeBytes(index, index_fill * sizeof(vcap_index_entry));
+    last_index = offset;
+    index_fill = 0;
 }
 
 void VectorLogger::end() {
@@ -81,6 +233,20 @@ void VectorLogger::end() {
     char buffer[128];
     
     switch (mode) {
+        case LOG_BINARY: {
+            writeIndex();
+            uint32_t offset = bytes_written;
+            vcap_record r = { VCAP_REC_END, sizeof(vcap_end) };
+            vcap_end e = { (uint32_t)frame_count, (uint32_t)point_count,
+                           (uint32_t)frames_dropped, last_index };
+            vcap_tail t = { offset, VCAP_TAIL_MAGIC };
+            writeBytes(&r, sizeof(r));
+            writeBytes(&e, sizeof(e));
+            writeBytes(&t, sizeof(t));
+            break;
+        }
+            
+
         case LOG_TEXT:
             writeSerial("=== Vector Logger End ===\n");
             snprintf(buffer, sizeof(buffer), "Total Points: %u\n", point_count);
@@ -100,7 +266,9 @@ void VectorLogger::end() {
             break;
     }
     
-    Serial.flush();  // Stelle sicher, dass alles gesendet wird
+    if (mode != LOG_UDP) {
+        Serial.flush();  // Stelle sicher, dass alles gesendet wird
+    }
     logging_active = false;
 }
 
@@ -123,13 +291,10 @@ void VectorLogger::logXYZ(uint16_t x, uint16_t y, uint16_t z) {
             break;
             
         case LOG_BINARY:
-            // 6 bytes: X(2) + Y(2) + Z(2), Little Endian
-            writeSerial((uint8_t)(x & 0xFF));
-            writeSerial((uint8_t)(x >> 8));
-            writeSerial((uint8_t)(y & 0xFF));
-            writeSerial((uint8_t)(y >> 8));
-            writeSerial((uint8_t)(z & 0xFF));
-            writeSerial((uint8_t)(z >> 8));
+            // Back to DVG resolution, written with the frame by endFrame()
+            if (frame_fill < VECT_POINTS_PER_FRAME) {
+                frame_points[frame_fill++] = vpoint_pack(x >> 2, y >> 2, z >> 8);
+            }
             break;
             
         case LOG_TEXT:
@@ -145,7 +310,7 @@ void VectorLogger::logXYZ(uint16_t x, uint16_t y, uint16_t z) {
 }
 
 void VectorLogger::logXYZ(uint16_t x, uint16_t y, uint8_t intensity) {
-    // 8-bit -> 12-bit conversion (same as vector_dac.cpp)
+    // 8-bit -> 12-bit conversion (same as the MCP4821 DAC backend)
     uint16_t z = (intensity > 0) ? ((uint16_t)intensity << 4) | (intensity >> 4) : 0;
     logXYZ(x, y, z);
 }
@@ -166,16 +331,6 @@ void VectorLogger::logBlank() {
             writeSerial(buffer);
             break;
             
-        case LOG_BINARY:
-            // Special marker: X=0xFFFF, Y=0xFFFF, Z=0
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0x00);
-            writeSerial((uint8_t)0x00);
-            break;
-            
         default:
             break;
     }
@@ -197,16 +352,6 @@ void VectorLogger::logUnblank() {
             writeSerial(buffer);
             break;
             
-        case LOG_BINARY:
-            // Special marker: X=0xFFFF, Y=0xFFFF, Z=0xFFFF
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            writeSerial((uint8_t)0xFF);
-            break;
-            
         default:
             break;
     }
@@ -234,15 +379,132 @@ void VectorLogger::logComment(const char* comment) {
     }
 }
 
-void VectorLogger::beginFrame(uint32_t frame_number) {
+static inline uint8_t* put16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+// Encode one frame against prev_points into 'encoded' (format in
+// vector_logger.h). Points at the same index as in the previous frame
+// become copy runs, everything else literal runs: Asteroids redraws its
+// objects in a fixed order, so a static scene encodes to a few bytes.
+size_t VectorLogger::encodeFrame(const uint32_t* points, int count) {
+    bool key = force_key || frames_since_key + 1 >= VECTOR_LOG_KEYFRAME;
+    int ref = key ? 0 : prev_count;
+    uint8_t* p = encoded;
+    
+    memcpy(p, &current_frame, 4);
+    p = put16(p + 4, count);
+    *p++ = key ? VLOG_FRAME_KEY : 0;
+    *p++ = 0;
+    
+    int i = 0;
+    while (i < count) {
+        int n = 0;
+        while (i + n < ref && i + n < count && n < 0x7FFF && points[i + n] == prev_points[i + n]) n++;
+        if (n) {
+            p = put16(p, n);
+            i += n;
+            continue;
+        }
+        
+        // Literal run up to the next point that matches again
+        while (i + n < count && n < 0x7FFF && !(i + n < ref && points[i + n] == prev_points[i + n])) n++;
+        p = put16(p, VLOG_RUN_LITERAL | n);
+        memcpy(p, points + i, n * sizeof(uint32_t));
+        p += n * sizeof(uint32_t);
+        i += n;
+    }
+    
+    memcpy(prev_points, points, count * sizeof(uint32_t));
+    prev_count = count;
+    frames_since_key = key ? 0 : frames_since_key + 1;
+    force_key = false;
+    return p - encoded;
+}
+
+void VectorLogger::logFrame(const uint32_t* points, int count) {
+    if (!logging_active) return;
+    if (count > VECT_POINTS_PER_FRAME) count = VECT_POINTS_PER_FRAME;
+    
+    if (mode == LOG_BINARY) {
+        frame_fill = 0;  // The frame replaces points from logXYZ()
+        writeFrameRecord(points, count);
+        point_count += count;
+        return;
+    }
+    
+    if (mode != LOG_UDP) {
+        // 10-bit DVG coordinates and 4-bit intensity to the 12-bit scale
+        for (int i = 0; i < count; i++) {
+            uint16_t x = vpoint_x(points[i]) << 2;
+            uint16_t y = vpoint_y(points[i]) << 2;
+            uint16_t z = vpoint_z(points[i]) * 0x111;
+            logXYZ(x, y, z);
+        }
+        return;
+    }
+    
+#if VECTOR_LOG_UDP
+    size_t len = encodeFrame(points, count);
+    int fragments = (len + VLOG_UDP_PAYLOAD - 1) / VLOG_UDP_PAYLOAD;
+    
+    // All or nothing: each message costs its length word in the buffer
+    size_t need = len + fragments * (sizeof(vlog_udp_header) + sizeof(size_t));
+    if (xMessageBufferSpacesAvailable(vlog_udp_buffer) < need) {
+        frames_dropped++;
+        force_key = true;  // The receiver has no reference for a delta now
+        return;
+    }
+    
+    static uint8_t dgram[sizeof(vlog_udp_header) + VLOG_UDP_PAYLOAD];
+    vlog_udp_header h = { VLOG_UDP_MAGIC, current_frame, (uint16_t)len, 0, (uint8_t)fragments };
+    for (int f = 0; f < fragments; f++) {
+        size_t offset = f * VLOG_UDP_PAYLOAD;
+        size_t chunk = (len - offset < VLOG_UDP_PAYLOAD) ? len - offset : VLOG_UDP_PAYLOAD;
+        h.fragment = f;
+        memcpy(dgram, &h, sizeof(h));
+        memcpy(dgram + sizeof(h), encoded + offset, chunk);
+        xMessageBufferSend(vlog_udp_buffer, dgram, sizeof(h) + chunk, 0);
+    }
+    
+    point_count += count;
+    bytes_written += len;
+#endif
+}
+
+void VectorLogger::logText(const char* text) {
+    if (!logging_active || mode != LOG_UDP) return;
+    
+#if VECTOR_LOG_UDP
+    static uint8_t dgram[sizeof(vlog_udp_header) + VLOG_UDP_PAYLOAD];
+    size_t len = strlen(text);
+    if (len > sizeof(dgram) - 4) len = sizeof(dgram) - 4;
+    if (xMessageBufferSpacesAvailable(vlog_udp_buffer) < len + 4 + sizeof(size_t)) return;
+    
+    uint32_t magic = VLOG_TEXT_MAGIC;
+    memcpy(dgram, &magic, 4);
+    memcpy(dgram + 4, text, len);
+    xMessageBufferSend(vlog_udp_buffer, dgram, len + 4, 0);
+#endif
+}
+
+void VectorLogger::beginFrame(uint32_t frame_number, uint32_t cycle) {
     current_frame = frame_number;
+    current_cycle = cycle;
+    frame_fill = 0;
 }
 
 void VectorLogger::endFrame() {
+    if (logging_active && mode == LOG_BINARY && frame_fill) {
+        writeFrameRecord(frame_points, frame_fill);
+        frame_fill = 0;
+    }
     frame_count++;
     
     // Periodisches Flush alle 10 Frames
-    if (logging_active && (frame_count % 10 == 0)) {
+    if (logging_active && mode != LOG_UDP && (frame_count % 10 == 0)) {
         Serial.flush();
     }
 }
@@ -267,6 +529,9 @@ void VectorLogger::printStats() {
     Serial.printf("Y range: %u - %u\n", min_y, max_y);
     Serial.printf("Z range: %u - %u\n", min_z, max_z);
     Serial.printf("Bytes written: %u\n", bytes_written);
+    if (mode == LOG_UDP) {
+        Serial.printf("Frames dropped: %u (send buffer full)\n", frames_dropped);
+    }
     Serial.println("================================");
 }
 
@@ -275,6 +540,7 @@ void VectorLogger::resetStats() {
     frame_count = 0;
     current_frame = 0;
     bytes_written = 0;
+    frames_dropped = 0;
     min_x = 4095; max_x = 0;
     min_y = 4095; max_y = 0;
     min_z = 4095; max_z = 0;
@@ -3,23 +3,56 @@
  * 
  * Loggt X/Y/Z-Werte direkt über Serial in verschiedene Formate:
  * - CSV für Analyse in Excel/Python
- * - Raw Binary für Oszilloskop-Replay
+ * - Binary: ganze Frames im indizierten Format (vcap_format.h) mit
+ *   Frame-Nummer, CPU-Takt und Punktzahl, für tools/vcap_tool und das
+ *   Replay von SD-Karte (VECTOR_REPLAY)
  * - Text-Format für menschenlesbare Debug-Ausgabe
+ * - UDP: ganze Frames als gepackte 32-Bit-Punkte (vector_point.h),
+ *   Delta zum Vorframe, per WLAN an tools/vector_capture.py
  * 
- * Output geht direkt an Serial, kein SPIFFS benötigt!
+ * CSV/Binary/Text gehen direkt an Serial, kein SPIFFS benötigt!
+ * UDP verschickt ein Task auf Core 1 aus einem Puffer; ist der voll,
+ * fällt ein Frame aus, statt die Emulation auszubremsen.
  */
 
 #ifndef VECTOR_LOGGER_H
 #define VECTOR_LOGGER_H
 
 #include <Arduino.h>
+#include "vcap_format.h"
 
 // Log-Modi
 enum LogMode {
     LOG_DISABLED = 0,
     LOG_CSV,         // X,Y,Z CSV format über Serial
-    LOG_BINARY,      // Raw binary (6 bytes pro Punkt: X:2, Y:2, Z:2)
-    LOG_TEXT         // Human-readable text
+    LOG_BINARY,      // Indexed frame records (vcap_format.h) über Serial
+    LOG_TEXT,        // Human-readable text
+    LOG_UDP          // Whole frames, delta-encoded, over Wi-Fi/UDP
+};
+
+/*
+ * UDP capture format (little endian). A frame is encoded as
+ *   u32 frame number, u16 point count, u8 flags (VLOG_FRAME_KEY), u8 0
+ * followed by runs until 'count' points are covered:
+ *   u16 n            copy n points from the previous frame (same index)
+ *   u16 0x8000 | n   n literal points follow, u32 each
+ * A key frame never copies. The encoded frame is split into datagrams
+ * of at most VLOG_UDP_PAYLOAD bytes, each with a vlog_udp_header. A
+ * receiver that lost a datagram drops deltas until the next key frame
+ * (every VECTOR_LOG_KEYFRAME frames, and after every dropped frame).
+ */
+#define VLOG_UDP_MAGIC    0x31504356   // "VCP1"
+#define VLOG_TEXT_MAGIC   0x31585456   // "VTX1": u32 magic, then text (no header)
+#define VLOG_UDP_PAYLOAD  1400         // Fits one Ethernet MTU
+#define VLOG_FRAME_KEY    0x01
+#define VLOG_RUN_LITERAL  0x8000
+
+struct vlog_udp_header {
+    uint32_t magic;
+    uint32_t frame;
+    uint16_t length;     // Encoded frame bytes (all fragments)
+    uint8_t  fragment;   // Index of this datagram
+    uint8_t  fragments;  // Datagrams of this frame
 };
 
 class VectorLogger {
@@ -38,14 +71,27 @@ public:
     void logUnblank();   // Beam on event
     void logComment(const char* comment);  // Text comment (nur bei LOG_TEXT/CSV)
     
-    // Frame-Tracking
-    void beginFrame(uint32_t frame_number);
+    // Whole frame of packed points (vector_point.h); UDP encodes it as
+    // one delta frame, LOG_BINARY writes it as one frame record, the
+    // text modes log every point
+    void logFrame(const uint32_t* points, int count);
+    
+    // Status text (profiler report) as one datagram next to the frames;
+    // LOG_UDP only, dropped like a frame when the send buffer is full
+    void logText(const char* text);
+    
+    // Frame-Tracking; 'cycle' is the CPU master cycle the frame's list was
+    // drawn at (LOG_BINARY frame header, pacing of the replay). In
+    // LOG_BINARY, points from logXYZ() are collected and written by
+    // endFrame() as one record.
+    void beginFrame(uint32_t frame_number, uint32_t cycle = 0);
     void endFrame();
     
     // Status
     bool isLogging() const { return logging_active; }
     size_t getPointCount() const { return point_count; }
     size_t getBytesWritten() const { return bytes_written; }
+    size_t getFramesDropped() const { return frames_dropped; }
     
     // Statistik
     void printStats();
@@ -60,6 +106,24 @@ private:
     size_t frame_count;
     uint32_t current_frame;
     size_t bytes_written;
+    size_t frames_dropped;   // UDP: send buffer full
+    
+    // UDP: previous frame (delta reference) and encoder output
+    uint32_t* prev_points;
+    int prev_count;
+    uint8_t* encoded;
+    uint32_t frames_since_key;
+    bool force_key;
+    
+    // LOG_BINARY: points collected by logXYZ(), the index entries since
+    // the last VIDX record and the offsets for the next one
+    uint32_t current_cycle;
+    uint32_t prev_cycle;
+    uint32_t* frame_points;
+    int frame_fill;
+    vcap_index_entry* index;
+    int index_fill;
+    uint32_t last_index;
     
     // Min/Max für Analyse
     uint16_t min_x, max_x;
@@ -70,6 +134,12 @@ private:
     void updateStats(uint16_t x, uint16_t y, uint16_t z);
     void writeSerial(const char* str);
     void writeSerial(uint8_t byte);
+    size_t encodeFrame(const uint32_t* points, int count);
+    bool beginUdp();
+    bool beginBinary();
+    void writeBytes(const void* data, size_t len);
+    void writeFrameRecord(const uint32_t* points, int count);
+    void writeIndex();
 };
 
 // Globale Instanz (optional, kann auch lokal erstellt werden)
@@ -0,0 +1,105 @@
+/*
+ * vector_replay.cpp - Sequential reader for indexed captures
+ *
+ * Replay only ever moves forward, so the index records are passed over
+ * like any other record; tools/vcap_tool uses them for random access.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECTOR_REPLAY
+#include "vector_replay.h"
+
+#define REPLAY_SCAN_BYTES  65536   // Boot text before the header, at most
+
+bool VectorReplay::begin(fs::FS& fs, const char* path) {
+    file = fs.open(path, "r");
+    if (!file) return false;
+    size = file.size();
+    frames = redraws = skipped = loops = 0;
+    if (!find_header()) {
+        file.close();
+        return false;
+    }
+    return true;
+}
+
+void VectorReplay::end() {
+    if (file) file.close();
+}
+
+// A capture over Serial starts with whatever was printed before
+// VectorLogger::begin(), the header is the first VCAP_MAGIC after it
+bool VectorReplay::find_header() {
+    uint8_t buf[256];
+    uint32_t pos = 0;
+
+    while (pos < REPLAY_SCAN_BYTES && pos + sizeof(hdr) <= size) {
+        file.seek(pos);
+        size_t n = file.read(buf, sizeof(buf));
+        if (n < 4) return false;
+        for (size_t i = 0; i + 4 <= n; i++) {
+            uint32_t magic;
+            memcpy(&magic, buf + i, 4);
+            if (magic != VCAP_MAGIC) continue;
+
+            file.seek(pos + i);
+            if (file.read((uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+                hdr.version == VCAP_VERSION && hdr.header_size >= sizeof(hdr)) {
+                base = pos + i;
+                rewind();
+                loops = 0;
+                return true;
+            }
+        }
+        pos += n - 3;  // A magic may straddle two reads
+    }
+    return false;
+}
+
+void VectorReplay::rewind() {
+    file.seek(base + hdr.header_size);
+    loops++;
+}
+
+bool VectorReplay::next(uint32_t* points, int max_points, int* count, uint32_t* frame, uint32_t* cycle) {
+    while (true) {
+        uint32_t pos = file.position();
+        vcap_record r;
+        if (file.read((uint8_t*)&r, sizeof(r)) != sizeof(r)) return false;
+        uint64_t end = (uint64_t)pos + sizeof(r) + r.length;  // Garbage lengths must not wrap
+
+        if (r.magic == VCAP_REC_FRAME && end <= size &&
+            r.length >= sizeof(vcap_frame) &&
+            r.length <= sizeof(vcap_frame) + VCAP_MAX_POINTS * sizeof(uint32_t)) {
+            vcap_frame f;
+            bool ok = file.read((uint8_t*)&f, sizeof(f)) == sizeof(f) &&
+                      r.length == sizeof(f) + f.count * sizeof(uint32_t);
+            if (ok && f.count > max_points) {
+                file.seek(end);  // Valid for all we know, but too big for the caller
+                skipped += end - pos;
+                continue;
+            }
+            size_t bytes = f.count * sizeof(uint32_t);
+            if (ok && file.read((uint8_t*)points, bytes) == bytes && vcap_check(f, points) == f.check) {
+                if (f.flags & VCAP_FRAME_REDRAW) {
+                    redraws++;
+                    continue;
+                }
+                *count = f.count;
+                *frame = f.frame;
+                *cycle = f.cycle;
+                frames++;
+                return true;
+            }
+        } else if (r.magic == VCAP_REC_INDEX && end <= size) {
+            file.seek(end);
+            continue;
+        } else if (r.magic == VCAP_REC_END && end + sizeof(vcap_tail) <= size) {
+            file.seek(end + sizeof(vcap_tail));
+            continue;
+        }
+
+        // Not a record: try again one byte further
+        skipped++;
+        file.seek(pos + 1);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * vector_replay.h - Aufnahme (.vci) von SD-Karte abspielen
+ *
+ * Liest die Frame-Records einer Aufnahme im Format von vcap_format.h der
+ * Reihe nach. Wiederholte Frames (VCAP_FRAME_REDRAW) fallen weg, die
+ * Anzeige zeichnet die letzte Liste ohnehin neu. Liegt Text zwischen den
+ * Records (Mitschnitt über Serial), sucht der Leser den nächsten Record,
+ * dessen Prüfsumme stimmt. Das Timing (CPU-Takt pro Frame) bleibt dem
+ * Aufrufer (VECTOR_REPLAY in main.cpp).
+ */
+
+#ifndef VECTOR_REPLAY_H
+#define VECTOR_REPLAY_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "vcap_format.h"
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef VECTOR_REPLAY
+#error "config.h must be included before vector_replay.h"
+#endif
+
+class VectorReplay {
+public:
+    // Open a capture; false if the file is missing or has no header
+    bool begin(fs::FS& fs, const char* path);
+    void end();
+
+    // Next frame that is not a redraw, at most 'max_points' points
+    // (vector_point.h). False at the end of the file.
+    bool next(uint32_t* points, int max_points, int* count, uint32_t* frame, uint32_t* cycle);
+
+    // Back to the first frame
+    void rewind();
+
+    const vcap_file_header& header() const { return hdr; }
+
+    // Statistics
+    uint32_t frames = 0;    // Frames returned by next()
+    uint32_t redraws = 0;   // VCAP_FRAME_REDRAW frames passed over
+    uint32_t skipped = 0;   // Bytes that were not part of a valid record
+    uint32_t loops = 0;     // rewind() calls
+
+private:
+    fs::File file;
+    vcap_file_header hdr;
+    uint32_t base = 0;      // File position of the header
+    uint32_t size = 0;
+
+    bool find_header();
+};
+
+#endif // VECTOR_REPLAY_H
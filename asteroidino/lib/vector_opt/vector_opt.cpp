@@ -0,0 +1,142 @@
+/*
+ * vector_opt.cpp - Per-frame vector list optimizer
+ *
+ * A draw group is a blank move target followed by the lit points drawn
+ * from it. Groups are independent, so they can be drawn in any order and
+ * in either direction: starting at the beam, the nearest group start or
+ * end (Chebyshev distance, which is what the deflection has to travel)
+ * is drawn next. Blank moves that go nowhere and groups without a lit
+ * segment are dropped; consecutive collinear segments of the same
+ * intensity are merged into one.
+ *
+ * Most frames repeat (attract mode, score screen, pauses): if the input
+ * list hashes the same as last frame, the previous output is kept and
+ * nothing is recomputed.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_OPT_*
+#include "vector_opt.h"
+
+static inline uint16_t opt_distance(uint32_t a, uint32_t b) {
+    int32_t dx = (int32_t)vpoint_x(a) - vpoint_x(b);
+    int32_t dy = (int32_t)vpoint_y(a) - vpoint_y(b);
+    if (dx < 0) dx = -dx;
+    if (dy < 0) dy = -dy;
+    return (dx > dy) ? dx : dy;
+}
+
+// Append a point; a lit point continuing the previous lit segment in
+// the same direction with the same intensity replaces its end point
+void VectorOptimizer::append(uint32_t p) {
+    if (count >= VECT_POINTS_PER_FRAME) return;
+
+    uint8_t z = vpoint_z(p);
+    if (z && count >= 2 && vpoint_z(points[count - 1]) == z) {
+        uint32_t a = points[count - 2], b = points[count - 1];
+        int32_t ax = (int32_t)vpoint_x(b) - vpoint_x(a);
+        int32_t ay = (int32_t)vpoint_y(b) - vpoint_y(a);
+        int32_t bx = (int32_t)vpoint_x(p) - vpoint_x(b);
+        int32_t by = (int32_t)vpoint_y(p) - vpoint_y(b);
+        if ((ax || ay) && (bx || by) && ax * by == ay * bx && ax * bx + ay * by > 0) {
+            points[count - 1] = p;
+            return;
+        }
+    }
+
+    points[count++] = p;
+}
+
+void VectorOptimizer::optimize(const uint32_t* in, int in_count) {
+    frames++;
+
+    // Unchanged frame: keep the previous output
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < in_count; i++) {
+        hash = (hash ^ in[i]) * 16777619u;
+    }
+    if (hash == last_hash && in_count == last_in_count) {
+        cached = true;
+        cache_hits++;
+        return;
+    }
+    last_hash = hash;
+    last_in_count = in_count;
+    cached = false;
+    points_in = in_count;
+
+    // Split into groups at blank moves
+    groups = 0;
+    jumps_in = 0;
+    bool overflow = false;
+    for (int i = 0; i < in_count; i++) {
+        if (vpoint_z(in[i]) == 0) {
+            jumps_in++;
+            continue;
+        }
+        // First lit point: its predecessor is the group start
+        if (i == 0 || vpoint_z(in[i - 1]) == 0) {
+            if (groups == VECT_OPT_MAX_GROUPS) {
+                overflow = true;
+                break;
+            }
+            group[groups].first = (i > 0) ? i - 1 : 0;
+            groups++;
+        }
+        group[groups - 1].last = i;
+    }
+
+    count = 0;
+    jumps_out = 0;
+
+    if (overflow) {
+        // Too many groups to sort: keep the DVG order, still merge
+        for (int i = 0; i < in_count; i++) {
+            append(in[i]);
+            if (vpoint_z(in[i]) == 0) jumps_out++;
+        }
+        if (count > 0) beam = points[count - 1];
+        return;
+    }
+
+    // Nearest neighbour over group starts and ends
+    uint32_t at = beam;
+    for (int done = 0; done < groups; done++) {
+        int best = done;
+        bool best_rev = false;
+        uint16_t best_d = 0xFFFF;
+        for (int g = done; g < groups; g++) {
+            uint16_t ds = opt_distance(in[group[g].first], at);
+            uint16_t de = opt_distance(in[group[g].last], at);
+            if (ds < best_d) { best_d = ds; best = g; best_rev = false; }
+            if (de < best_d) { best_d = de; best = g; best_rev = true; }
+        }
+        Group g = group[best];
+        group[best] = group[done];
+        group[done] = g;
+
+        // The first move is always kept: replaying the frame re-enters it
+        // from the frame's own end point
+        if (!best_rev) {
+            if (best_d || done == 0) {
+                append(vpoint_with_z(in[g.first], 0));
+                jumps_out++;
+            }
+            for (int i = g.first + 1; i <= g.last; i++) {
+                append(in[i]);
+            }
+            at = in[g.last];
+        } else {
+            // Reversed: segment k-1 -> k keeps the intensity stored at k
+            if (best_d || done == 0) {
+                append(vpoint_with_z(in[g.last], 0));
+                jumps_out++;
+            }
+            for (int i = g.last - 1; i >= g.first; i--) {
+                append(vpoint_with_z(in[i], vpoint_z(in[i + 1])));
+            }
+            at = in[g.first];
+        }
+    }
+
+    beam = at;
+}
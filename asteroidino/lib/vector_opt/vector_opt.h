@@ -0,0 +1,52 @@
+/*
+ * vector_opt.h - Optimierung der DVG-Vektorliste pro Frame
+ *
+ * Zerlegt die Liste an dunklen Sprüngen in Zeichengruppen, sortiert
+ * diese nach nächstem Nachbarn (auch rückwärts gezeichnet), entfernt
+ * überflüssige Sprünge und fasst kollineare Segmente zusammen.
+ * Weniger Strahlweg und Einschwingzeit = höhere Bildrate.
+ */
+
+#ifndef VECTOR_OPT_H
+#define VECTOR_OPT_H
+
+#include <Arduino.h>
+#include <vector_point.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef VECT_OPT_MAX_GROUPS
+#error "config.h must be included before vector_opt.h"
+#endif
+
+class VectorOptimizer {
+public:
+    // Optimize a list of packed DVG points (vector_point.h) into
+    // points/count
+    void optimize(const uint32_t* in, int in_count);
+    
+    uint32_t points[VECT_POINTS_PER_FRAME];
+    int      count = 0;
+    
+    // Statistics of the last frame
+    int  groups = 0;         // Draw groups found
+    int  jumps_in = 0;       // Blank moves before / after
+    int  jumps_out = 0;
+    int  points_in = 0;
+    bool cached = false;     // Output reused from the previous frame
+    uint32_t cache_hits = 0;
+    uint32_t frames = 0;
+    
+private:
+    struct Group {
+        uint16_t first;      // Input index of the start point (blank target)
+        uint16_t last;       // Input index of the last lit point
+    };
+    Group    group[VECT_OPT_MAX_GROUPS];
+    uint32_t last_hash = 0;
+    int      last_in_count = -1;
+    uint32_t beam = vpoint_pack(512, 512, 0);  // Beam at the end of the last frame
+    
+    void append(uint32_t p);
+};
+
+#endif // VECTOR_OPT_H
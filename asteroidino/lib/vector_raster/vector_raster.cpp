@@ -0,0 +1,120 @@
+/*
+ * vector_raster.cpp - Constant-velocity line rasterizer
+ *
+ * Lit segments are split into points VECT_RASTER_STEP DAC units apart
+ * (16.16 fixed-point DDA, one divide per segment, none per point), so
+ * every line gets the same beam time per unit of length. Blanked moves
+ * jump straight to the target and hold there for VECT_RASTER_SETTLE
+ * points while the deflection settles. If a frame would overflow the
+ * point budget (VECT_POINTS_PER_FRAME, or less when the refresh governor
+ * asks for it), the spacing grows for the whole frame, keeping bright-
+ * ness even across lines.
+ */
+
+#include "../../src/config.h"  // MUST be first for VECT_RASTER_*
+#include "vector_raster.h"
+#include <vector_dac.h>
+
+// Approximate Euclidean length: max + 3/8 min (within ~7%, no sqrt)
+static inline uint32_t raster_length(int32_t dx, int32_t dy) {
+    uint32_t ax = (dx < 0) ? -dx : dx;
+    uint32_t ay = (dy < 0) ? -dy : dy;
+    uint32_t hi = (ax > ay) ? ax : ay;
+    uint32_t lo = (ax > ay) ? ay : ax;
+    return hi + (lo >> 2) + (lo >> 3);
+}
+
+// DVG 4-bit intensity -> 8-bit Z (15 -> 255)
+static inline uint8_t raster_z(uint8_t intensity) {
+    intensity &= 0x0F;
+    return (intensity << 4) | intensity;
+}
+
+void VectorRaster::emit(uint16_t x, uint16_t y, uint8_t z) {
+    if (frame.count >= VECT_POINTS_PER_FRAME) return;
+    frame.xy[frame.count] = VectorDAC::packXY(x, y);
+    frame.z[frame.count] = z;
+    frame.count++;
+}
+
+int VectorRaster::rasterize(const uint32_t* points, int count, int max_points) {
+    // The frame is replayed, so the beam enters it from its own end point
+    int32_t start_x = 2048, start_y = 2048;
+    if (count > 0) {
+        start_x = vpoint_x(points[count - 1]) << 2;
+        start_y = vpoint_y(points[count - 1]) << 2;
+    }
+
+    // Pass 1: lit length, jumps and dots decide the spacing
+    uint32_t length = 0;
+    int jumps = 0;
+    int dots = 0;
+    int32_t cx = start_x, cy = start_y;
+    for (int i = 0; i < count; i++) {
+        int32_t x = vpoint_x(points[i]) << 2;  // 10-bit DVG -> 12-bit DAC
+        int32_t y = vpoint_y(points[i]) << 2;
+        int32_t dx = x - cx, dy = y - cy;
+        if (vpoint_z(points[i]) == 0) {
+            if (dx || dy) jumps++;
+        } else if (dx == 0 && dy == 0) {
+            dots++;
+        } else {
+            length += raster_length(dx, dy);
+        }
+        cx = x;
+        cy = y;
+    }
+
+    if (max_points > VECT_POINTS_PER_FRAME) max_points = VECT_POINTS_PER_FRAME;
+    int32_t budget = max_points - jumps * VECT_RASTER_SETTLE - dots * VECT_RASTER_DOT;
+    if (budget < 1) budget = 1;
+    uint32_t step = VECT_RASTER_STEP;
+    if (length > (uint32_t)budget * step) {
+        step = (length + budget - 1) / budget;
+    }
+
+    // Pass 2: emit points
+    frame.count = 0;
+    frame.drawn = 0;
+    frame.blanked = 0;
+    frame.step = step;
+    frame.wanted = jumps * VECT_RASTER_SETTLE + dots * VECT_RASTER_DOT + length / VECT_RASTER_STEP;
+
+    cx = start_x;
+    cy = start_y;
+    for (int i = 0; i < count; i++) {
+        int32_t x = vpoint_x(points[i]) << 2;
+        int32_t y = vpoint_y(points[i]) << 2;
+        int32_t dx = x - cx, dy = y - cy;
+        uint8_t z = raster_z(vpoint_z(points[i]));
+
+        if (z == 0) {
+            // Blanked move: only a real jump needs settling time
+            if (dx || dy) {
+                for (int s = 0; s < VECT_RASTER_SETTLE; s++) emit(x, y, 0);
+                frame.blanked += VECT_RASTER_SETTLE;
+            }
+        } else if (dx == 0 && dy == 0) {
+            // Dot (shots, stars): fixed dwell
+            for (int s = 0; s < VECT_RASTER_DOT; s++) emit(x, y, z);
+            frame.drawn += VECT_RASTER_DOT;
+        } else {
+            uint32_t n = (raster_length(dx, dy) + step - 1) / step;
+            int32_t ix = (dx << 16) / (int32_t)n;
+            int32_t iy = (dy << 16) / (int32_t)n;
+            int32_t fx = (cx << 16) + 0x8000;
+            int32_t fy = (cy << 16) + 0x8000;
+            for (uint32_t k = 1; k < n; k++) {
+                fx += ix;
+                fy += iy;
+                emit(fx >> 16, fy >> 16, z);
+            }
+            emit(x, y, z);  // Land exactly on the endpoint
+            frame.drawn += n;
+        }
+        cx = x;
+        cy = y;
+    }
+
+    return frame.count;
+}
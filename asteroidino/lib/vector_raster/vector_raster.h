@@ -0,0 +1,44 @@
+/*
+ * vector_raster.h - Linien-Rasterizer für die Vektor-Ausgabe
+ *
+ * Zerlegt die DVG-Vektorliste in Punkte mit konstantem Abstand, damit
+ * der Strahl mit konstanter Geschwindigkeit läuft (gleiche Helligkeit
+ * für kurze und lange Linien). Dunkle Sprünge bekommen Einschwingpunkte.
+ */
+
+#ifndef VECTOR_RASTER_H
+#define VECTOR_RASTER_H
+
+#include <Arduino.h>
+#include <vector_point.h>
+
+// Forward-declare config - must be included in .cpp before this header
+#ifndef VECT_RASTER_STEP
+#error "config.h must be included before vector_raster.h"
+#endif
+
+// One rasterized frame, ready to send: X/Y as DAC command words
+// (VectorDAC::packXY) and Z separately
+struct RasterFrame {
+    uint32_t xy[VECT_POINTS_PER_FRAME];  // X word bits 0-15, Y word bits 16-31
+    uint8_t  z[VECT_POINTS_PER_FRAME];   // 8-bit intensity, 0 = blanked
+    int      count;     // Points in this frame
+    int      drawn;     // ...of which on lit lines and dots
+    int      blanked;   // ...of which settle points after jumps
+    int      wanted;    // Points at VECT_RASTER_STEP spacing (before the budget)
+    uint16_t step;      // Point spacing used (DAC units)
+};
+
+class VectorRaster {
+public:
+    // Rasterize a list of packed DVG points (vector_point.h) into at
+    // most max_points points. Returns the number of points.
+    int rasterize(const uint32_t* points, int count, int max_points = VECT_POINTS_PER_FRAME);
+    
+    RasterFrame frame;
+    
+private:
+    void emit(uint16_t x, uint16_t y, uint8_t z);
+};
+
+#endif // VECTOR_RASTER_H
@@ -0,0 +1,120 @@
+/*
+ * Arduino.h - Dünne Plattform-Schicht für den Host-Build (env:native)
+ *
+ * Bildet genau die Arduino-, ESP32- und FreeRTOS-Aufrufe nach, die
+ * src/main.cpp und die Libraries benutzen: Serial geht auf stdout, Zeit
+ * kommt von CLOCK_MONOTONIC, GPIO und Tasks sind Attrappen. Tasks werden
+ * nicht gestartet; native_main.cpp treibt die Emulation selbst.
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+
+#define PI 3.1415926535897932384626433832795
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define INPUT_PULLUP 0x05
+
+// ----------------------------------------------------------------------------
+// Time
+// ----------------------------------------------------------------------------
+
+inline uint64_t native_nanos() {
+    timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+inline unsigned long micros() { return (unsigned long)(native_nanos() / 1000); }
+inline unsigned long millis() { return (unsigned long)(native_nanos() / 1000000); }
+
+// Headless: nothing waits for a beam or a DAC
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+inline void yield() {}
+
+// ----------------------------------------------------------------------------
+// GPIO: inputs read from native_pins (1 = released, pull-up)
+// ----------------------------------------------------------------------------
+
+extern uint8_t native_pins[64];
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t pin) { return pin < 64 ? native_pins[pin] : HIGH; }
+
+// ----------------------------------------------------------------------------
+// ESP32 system
+// ----------------------------------------------------------------------------
+
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+
+struct NativeEsp {
+    // CCOUNT at 240 MHz
+    uint32_t getCycleCount() { return (uint32_t)(native_nanos() * 240 / 1000); }
+    uint32_t getFreeHeap() { return 0; }
+    uint8_t getChipRevision() { return 0; }
+};
+extern NativeEsp ESP;
+
+// ----------------------------------------------------------------------------
+// Serial -> stdout
+// ----------------------------------------------------------------------------
+
+struct NativeSerial {
+    void begin(unsigned long) {}
+    template <typename... Args>
+    int printf(const char* format, Args... args) { return ::printf(format, args...); }
+    size_t print(const char* s) { return fputs(s, stdout) < 0 ? 0 : strlen(s); }
+    size_t println(const char* s = "") { return print(s) + (fputc('\n', stdout) != EOF); }
+    size_t write(uint8_t b) { return fputc(b, stdout) != EOF; }
+    size_t write(const uint8_t* b, size_t n) { return fwrite(b, 1, n, stdout); }
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+};
+extern NativeSerial Serial;
+
+// ----------------------------------------------------------------------------
+// FreeRTOS: single-threaded, tasks are never started
+// ----------------------------------------------------------------------------
+
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+
+#define configTICK_RATE_HZ 1000
+#define portMAX_DELAY      0xffffffffu
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+#define pdPASS             1
+
+inline void vTaskDelay(TickType_t) {}
+inline int xPortGetCoreID() { return 0; }
+inline void disableCore0WDT() {}
+
+inline BaseType_t xTaskCreatePinnedToCore(void (*)(void*), const char*, uint32_t, void*,
+                                          unsigned, TaskHandle_t* handle, int) {
+    if (handle) *handle = nullptr;
+    return pdPASS;
+}
+
+#endif // NATIVE_ARDUINO_H
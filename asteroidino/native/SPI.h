@@ -0,0 +1,28 @@
+/*
+ * SPI.h - SPI-Attrappe für den Host-Build (Transfers werden verworfen)
+ */
+
+#ifndef NATIVE_SPI_H
+#define NATIVE_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST  1
+#define SPI_MODE0 0
+
+struct SPISettings {
+    SPISettings() {}
+    SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+struct SPIClass {
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void beginTransaction(SPISettings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t) { return 0; }
+    void write(uint8_t) {}
+    void write16(uint16_t) {}
+};
+extern SPIClass SPI;
+
+#endif // NATIVE_SPI_H
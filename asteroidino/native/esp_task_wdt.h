@@ -0,0 +1,8 @@
+/*
+ * esp_task_wdt.h - Task-Watchdog gibt es im Host-Build nicht
+ */
+
+#ifndef NATIVE_ESP_TASK_WDT_H
+#define NATIVE_ESP_TASK_WDT_H
+
+#endif // NATIVE_ESP_TASK_WDT_H
@@ -0,0 +1,314 @@
+/*
+ * native_main.cpp - Host-Benchmark für Asteroidino (env:native)
+ *
+ * Läuft mit den echten ROMs ohne Hardware: setup() aus src/main.cpp
+ * initialisiert die Maschine, danach wird die Arbeit beider Cores hier
+ * nacheinander ausgeführt (CPU-Zeitscheibe, DVG-Dekodierung, Anzeige
+ * im 60-Hz-Takt der emulierten Zeit). Ausgabe: Befehle/s, DVG-Listen/s,
+ * Punkte pro Liste und Frame, Zeit pro Subsystem und ein Hash über
+ * RAM und Vector-RAM, um Builds auf identisches Verhalten zu prüfen.
+ *
+ *   pio run -e native
+ *   .pio/build/native/program [frames] [--play]
+ *   .pio/build/native/program --golden
+ *   .pio/build/native/program --record test/golden/regress.inc
+ *   .pio/build/native/program [frames] --save mid.state / --load mid.state
+ *   .pio/build/native/program [frames] --rewind 2500
+ *   .pio/build/native/program --record-vram test/test_bench/attract_vram.inc
+ *   .pio/build/native/program [frames] --soak 32 [--jobs 8] [--seed 1]
+ *
+ * frames = NMI-Perioden (4 ms emulierte Zeit), Standard 15000 = 60 s.
+ * --play wirft eine Münze ein, startet ein Spiel und feuert/schubt
+ * nach festem Skript (regress_input), statt nur den Attract-Modus zu
+ * messen. --golden prüft gegen die Golden-Frames (Exit-Code = Anzahl
+ * Abweichungen), --record schreibt sie nach einer gewollten Änderung
+ * neu. --save schreibt am Ende einen Savestate, --load startet aus
+ * einem statt aus dem Reset (auch für --golden/--record). --record-vram
+ * schreibt Vektor-RAM-Abbilder aus dem Attract-Modus für den
+ * DVG-Benchmark (test/test_bench). --rewind N
+ * springt am Ende über den Rewind-Ring N Frames zurück, spielt sie mit
+ * den aufgezeichneten Eingaben nach und vergleicht den Zustand. --soak N
+ * lässt N Instanzen parallel mit Zufallseingaben gegen Invarianten laufen
+ * (native_soak.cpp, --jobs Worker, --seed Startwert). Mit
+ * PROFILE_ENABLE folgt der Profiler-Report des letzten Fensters.
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "../src/config.h"
+#include <cpu6502.h>
+#include <vector_raster.h>
+#include <display_gov.h>
+#include <profiler.h>
+#include <rewind.h>
+#include <atomic>
+#include <vector>
+
+// Platform objects of the shim
+uint8_t native_pins[64];
+NativeEsp ESP;
+NativeSerial Serial;
+SPIClass SPI;
+
+// src/main.cpp
+extern mos6502* cpu;
+extern uint8_t ram[MEM_SIZE_RAM];
+extern uint8_t vector_ram[MEM_SIZE_VECTOR];
+extern uint64_t total_cpu_cycles;
+extern uint32_t watchdog_resets;
+extern int dvg_list_points;
+extern VectorRaster vector_raster;
+extern DisplayGovernor display_gov;
+extern uint32_t dvg_memo_hits, dvg_memo_misses;
+extern uint32_t dvg_reuse_hits, dvg_reuse_misses;
+extern bool savestate_booted;
+#if REWIND_ENABLE
+extern RewindRing rewind_ring;
+extern std::atomic<uint32_t> rewind_request;
+extern uint32_t rewind_frames;
+#endif
+void setup();
+void sched_init();
+void sched_run(uint64_t until);
+bool dvg_service();
+void vector_flip();
+void render_vectors();
+void read_buttons();
+void regress_input(uint32_t frame);
+int regress_run(bool record);
+void regress_record_vram(int images, uint32_t every);
+int soak_run(uint32_t instances, uint32_t frames, int jobs, uint32_t seed_base);
+size_t savestate_size();
+size_t savestate_save(uint8_t* buf, size_t cap);
+bool savestate_load(const uint8_t* buf, size_t len);
+bool rewind_frame();
+
+#define FRAMES_PER_SECOND  (CPU_CLOCK_HZ / CPU_CYCLES_PER_FRAME)
+
+static bool load_state(const char* path) {
+    std::vector<uint8_t> buf(savestate_size());
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    size_t len = fread(buf.data(), 1, buf.size(), f);
+    fclose(f);
+    return savestate_load(buf.data(), len);
+}
+
+static bool save_state(const char* path) {
+    std::vector<uint8_t> buf(savestate_size());
+    size_t len = savestate_save(buf.data(), buf.size());
+    FILE* f = fopen(path, "wb");
+    bool ok = f && fwrite(buf.data(), 1, len, f) == len;
+    if (f) fclose(f);
+    if (!ok) perror(path);
+    return ok;
+}
+
+static uint32_t state_hash() {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < MEM_SIZE_RAM; i++) h = (h ^ ram[i]) * 16777619u;
+    for (int i = 0; i < MEM_SIZE_VECTOR; i++) h = (h ^ vector_ram[i]) * 16777619u;
+    return h;
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = 15000;
+    uint32_t rewind_back = 0;
+    bool play = false, golden = false;
+    const char* record = nullptr;
+    const char* load = nullptr;
+    const char* save = nullptr;
+    const char* record_vram = nullptr;
+    uint32_t soak = 0, soak_seed = 1;
+    int soak_jobs = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--play") == 0) {
+            play = true;
+        } else if (strcmp(argv[i], "--golden") == 0) {
+            golden = true;
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record = argv[++i];
+        } else if (strcmp(argv[i], "--load") == 0 && i + 1 < argc) {
+            load = argv[++i];
+        } else if (strcmp(argv[i], "--save") == 0 && i + 1 < argc) {
+            save = argv[++i];
+        } else if (strcmp(argv[i], "--rewind") == 0 && i + 1 < argc) {
+            rewind_back = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--record-vram") == 0 && i + 1 < argc) {
+            record_vram = argv[++i];
+        } else if (strcmp(argv[i], "--soak") == 0 && i + 1 < argc) {
+            soak = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            soak_jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            soak_seed = strtoul(argv[++i], nullptr, 0);
+        } else if (atoi(argv[i]) > 0) {
+            frames = atoi(argv[i]);
+        } else {
+            fprintf(stderr, "usage: %s [frames] [--play] [--save FILE] [--rewind N] | --golden | --record FILE"
+                            " [--load FILE] | --record-vram FILE"
+                            " | [frames] --soak N [--jobs J] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    memset(native_pins, HIGH, sizeof(native_pins));
+    setup();
+
+    if (load) {
+        if (!load_state(load)) return 2;
+        savestate_booted = true;
+    }
+    if (golden) {
+        return regress_run(false);
+    }
+    if (record) {
+        fflush(stdout);
+        if (!freopen(record, "w", stdout)) {
+            perror(record);
+            return 2;
+        }
+        return regress_run(true);
+    }
+    if (record_vram) {
+        fflush(stdout);
+        if (!freopen(record_vram, "w", stdout)) {
+            perror(record_vram);
+            return 2;
+        }
+        regress_record_vram(4, 750);
+        return 0;
+    }
+    if (soak) {
+        return soak_run(soak, frames, soak_jobs, soak_seed);
+    }
+
+    // What emulation_task() does on core 0 before its loop
+    if (!savestate_booted) sched_init();
+
+    const uint64_t display_period = CPU_CLOCK_HZ / VECT_REFRESH_HZ;
+    uint64_t frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+    uint64_t next_display = total_cpu_cycles + display_period;
+    uint64_t instructions0 = cpu->GetInstructionCount();
+    uint64_t cycles0 = total_cpu_cycles;
+
+    uint64_t cpu_ns = 0, dvg_ns = 0, display_ns = 0;
+    uint32_t lists = 0, displays = 0, displays_profiled = 0;
+    uint64_t list_points = 0, raster_points = 0;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        if (play) regress_input(f);
+
+        // Core 0: one NMI period
+        uint64_t t0 = native_nanos();
+        PROF_BEGIN(PROF_CORE0);
+        if (rewind_frame()) frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+        frame_end += CPU_CYCLES_PER_FRAME;
+        sched_run(frame_end);
+        PROF_END(PROF_CORE0);
+        prof_frame(0);
+
+        // Core 1: decode, then the 60 Hz display in emulated time
+        uint64_t t1 = native_nanos();
+        PROF_BEGIN(PROF_CORE1);
+        if (dvg_service()) {
+            lists++;
+            list_points += dvg_list_points;
+        }
+
+        uint64_t t2 = native_nanos();
+        if (total_cpu_cycles >= next_display) {
+            next_display += display_period;
+            if (!play) read_buttons();
+            vector_flip();
+            render_vectors();
+            displays++;
+            raster_points += vector_raster.frame.count;
+        }
+        PROF_END(PROF_CORE1);
+        if (displays != displays_profiled) {
+            displays_profiled = displays;
+            prof_frame(1);
+        }
+
+        uint64_t t3 = native_nanos();
+        cpu_ns += t1 - t0;
+        dvg_ns += t2 - t1;
+        display_ns += t3 - t2;
+    }
+
+    uint64_t instructions = cpu->GetInstructionCount() - instructions0;
+    uint64_t cycles = total_cpu_cycles - cycles0;
+    uint64_t total_ns = cpu_ns + dvg_ns + display_ns;
+    double wall_s = total_ns / 1e9;
+    double emulated_s = (double)cycles / CPU_CLOCK_HZ;
+
+    printf("\n=== Native benchmark: %u frames (%.1f s emulated), %s core, %s DVG%s ===\n",
+           frames, emulated_s, !CPU_USE_SWITCH_CORE ? "table" : CPU_PREDECODE ? "predecode" : "switch",
+           DVG_USE_DECODED_ENGINE ? "decoded" : "PROM", play ? ", scripted play" : "");
+    printf("CPU      %llu instructions, %llu cycles, %.2f M inst/s, %.1f MHz emulated (%.1fx real time)\n",
+           (unsigned long long)instructions, (unsigned long long)cycles,
+           instructions / (cpu_ns / 1e3), cycles / (cpu_ns / 1e3), emulated_s / wall_s);
+    printf("DVG      %u lists, %.1f points/list, %.0f lists/s serviced, %u/%u subroutine calls replayed/recorded, "
+           "%u/%u lists reused/decoded\n",
+           lists, lists ? (double)list_points / lists : 0.0,
+           dvg_ns ? lists / (dvg_ns / 1e9) : 0.0, dvg_memo_hits, dvg_memo_misses,
+           dvg_reuse_hits, dvg_reuse_misses);
+    printf("Display  %u frames, %.1f raster points/frame, %.0f frames/s rendered, "
+           "governor %u Hz / %d points, %u overloads\n",
+           displays, displays ? (double)raster_points / displays : 0.0,
+           display_ns ? displays / (display_ns / 1e9) : 0.0,
+           display_gov.hz, display_gov.max_points, display_gov.overloads);
+    printf("Time     cpu %.3f s (%.1f%%), dvg %.3f s (%.1f%%), display %.3f s (%.1f%%), total %.3f s\n",
+           cpu_ns / 1e9, 100.0 * cpu_ns / total_ns, dvg_ns / 1e9, 100.0 * dvg_ns / total_ns,
+           display_ns / 1e9, 100.0 * display_ns / total_ns, wall_s);
+    printf("State    hash %08x, PC=0x%04X, %u watchdog resets\n",
+           state_hash(), cpu->GetPC(), watchdog_resets);
+#if PROFILE_ENABLE
+    char prof_text[1024];
+    if (prof_report(prof_text, sizeof(prof_text))) fputs(prof_text, stdout);
+#endif
+#if REWIND_ENABLE
+    const RewindRing& r = rewind_ring;
+    printf("Rewind   %u snapshots (%u key), %u of %u KB, frames %u-%u (%.1f s), delta %.0f bytes avg\n",
+           r.snapshots, r.keys, (unsigned)(r.used() / 1024), (unsigned)(r.capacity / 1024),
+           r.first_frame, r.last_frame, (double)(r.last_frame - r.first_frame) / FRAMES_PER_SECOND,
+           r.delta_count ? (double)r.delta_bytes / r.delta_count : 0.0);
+#endif
+    if (save && !save_state(save)) return 2;
+    
+#if REWIND_ENABLE
+    if (rewind_back) {
+        // Seek back the way the console does (rewind_request, taken by
+        // rewind_frame() at the next frame start), replay the recorded
+        // inputs up to where the live run stopped and compare
+        uint32_t hash = state_hash();
+        uint32_t live = rewind_frames;
+        uint32_t target = frames > rewind_back ? frames - rewind_back : 0;
+        uint64_t t0 = native_nanos();
+        rewind_request.store(rewind_back);
+        if (!rewind_frame()) {
+            printf("Rewind   frame %u is not in the ring\n", target);
+            return 1;
+        }
+        uint32_t at = rewind_frames - 1;  // The snapshot's frame, now running
+        uint64_t end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+        while (true) {
+            end += CPU_CYCLES_PER_FRAME;
+            sched_run(end);
+            dvg_service();
+            if (rewind_frames >= live) break;
+            rewind_frame();
+        }
+        bool match = state_hash() == hash;
+        printf("Rewind   seek to frame %u: snapshot %u, %u frames replayed in %.1f ms, state %s\n",
+               target, at, frames - at, (native_nanos() - t0) / 1e6,
+               match ? "matches" : "MISMATCH");
+        if (!match) return 1;
+    }
+#endif
+    return 0;
+}
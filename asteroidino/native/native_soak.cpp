@@ -0,0 +1,223 @@
+/*
+ * native_soak.cpp - Dauertest mit vielen Instanzen (native --soak)
+ *
+ * Startet N unabhängige Emulator-Instanzen auf einem Pool von Worker-
+ * Prozessen. Jede Instanz ist ein fork() der fertig initialisierten
+ * Maschine und hat damit alle Globals von src/main.cpp für sich: der
+ * getestete Code ist genau der, der auf dem Board läuft. Instanz 0
+ * spielt das Skript von --play, alle anderen zufällige Eingaben aus
+ * ihrem Seed. Jede Instanz läuft ohne Anzeige so schnell sie kann und
+ * prüft nach jedem Frame:
+ *   - keine illegalen Opcodes, keine Watchdog-Resets
+ *   - jede DVG-Liste endet mit HALT innerhalb von DVG_MAX_STEPS
+ *   - kein Vektor fällt bei voller Liste weg (dvg_add_vector)
+ * Ausgabe: eine Zeile pro Instanz und die Summe in Frames/s. Exit-Code
+ * = Anzahl fehlgeschlagener Instanzen.
+ *
+ *   .pio/build/native/program [frames] --soak 32 [--jobs 8] [--seed 1]
+ */
+
+#include <Arduino.h>
+#include "../src/config.h"
+#include <cpu6502.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// src/main.cpp
+extern mos6502* cpu;
+extern uint8_t ram[MEM_SIZE_RAM];
+extern uint8_t vector_ram[MEM_SIZE_VECTOR];
+extern uint64_t total_cpu_cycles;
+extern uint32_t watchdog_resets;
+extern uint32_t dvg_overflows, dvg_overruns;
+extern bool savestate_booted;
+void sched_init();
+void sched_run(uint64_t until);
+bool dvg_service();
+void vector_flip();
+void regress_input(uint32_t frame);
+void regress_input_random(uint32_t frame, uint32_t seed);
+
+struct soak_result {
+    uint32_t frames;          // Frames run, fewer than asked after a failure
+    uint32_t lists;           // Lists decoded or reused
+    uint64_t instructions;
+    uint64_t ns;
+    uint32_t hash;            // RAM + vector RAM at the end
+    char     failure[96];     // Empty while every invariant held
+};
+
+struct soak_worker {
+    pid_t    pid;
+    int      fd;              // Read end of the result pipe
+    uint32_t instance;
+    uint64_t start_ns;
+};
+
+static uint32_t soak_hash() {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < MEM_SIZE_RAM; i++) h = (h ^ ram[i]) * 16777619u;
+    for (int i = 0; i < MEM_SIZE_VECTOR; i++) h = (h ^ vector_ram[i]) * 16777619u;
+    return h;
+}
+
+static uint32_t soak_seed(uint32_t base, uint32_t instance) {
+    return (base * 0x9E3779B9u) ^ (instance * 0x85EBCA6Bu);
+}
+
+// One instance, in the worker process
+static void soak_instance(uint32_t instance, uint32_t frames, uint32_t seed, soak_result& r) {
+    memset(&r, 0, sizeof(r));
+    uint64_t t0 = native_nanos();
+    uint64_t instructions0 = cpu->GetInstructionCount();
+    uint32_t overflows0 = dvg_overflows, overruns0 = dvg_overruns, resets0 = watchdog_resets;
+
+    if (!savestate_booted) sched_init();
+    uint64_t frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+
+    for (uint32_t f = 0; f < frames; f++) {
+        if (instance == 0) {
+            regress_input(f);
+        } else {
+            regress_input_random(f, seed);
+        }
+        frame_end += CPU_CYCLES_PER_FRAME;
+        sched_run(frame_end);
+        if (dvg_service()) r.lists++;
+        vector_flip();
+        r.frames = f + 1;
+
+        if (cpu->GetIllegalOpcode()) {
+            snprintf(r.failure, sizeof(r.failure), "frame %u: illegal opcode, PC=0x%04X", f, cpu->GetPC());
+        } else if (watchdog_resets != resets0) {
+            snprintf(r.failure, sizeof(r.failure), "frame %u: watchdog reset, PC=0x%04X", f, cpu->GetPC());
+        } else if (dvg_overruns != overruns0) {
+            snprintf(r.failure, sizeof(r.failure), "frame %u: DVG list without HALT in %d steps",
+                     f, DVG_MAX_STEPS);
+        } else if (dvg_overflows != overflows0) {
+            snprintf(r.failure, sizeof(r.failure), "frame %u: %u vectors dropped on a full list",
+                     f, dvg_overflows - overflows0);
+        }
+        if (r.failure[0]) break;
+    }
+
+    r.instructions = cpu->GetInstructionCount() - instructions0;
+    r.ns = native_nanos() - t0;
+    r.hash = soak_hash();
+}
+
+// Fork the worker for 'instance'; false if the system refused
+static bool soak_start(soak_worker& w, uint32_t instance, uint32_t frames, uint32_t seed) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return false;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        close(fds[0]);
+        close(fds[1]);
+        return false;
+    }
+    if (pid == 0) {
+        // Worker: the result fits one pipe write (< PIPE_BUF)
+        close(fds[0]);
+        soak_result r;
+        soak_instance(instance, frames, seed, r);
+        bool ok = write(fds[1], &r, sizeof(r)) == (ssize_t)sizeof(r);
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    w.pid = pid;
+    w.fd = fds[0];
+    w.instance = instance;
+    w.start_ns = native_nanos();
+    return true;
+}
+
+// Collect a finished worker; returns true if all its invariants held
+static bool soak_finish(const soak_worker& w, int status, uint32_t seed_base,
+                        uint64_t& frames, uint64_t& instructions) {
+    soak_result r;
+    bool got = read(w.fd, &r, sizeof(r)) == (ssize_t)sizeof(r);
+    close(w.fd);
+    if (!got) {
+        memset(&r, 0, sizeof(r));
+        if (WIFSIGNALED(status)) {
+            snprintf(r.failure, sizeof(r.failure), "worker died from signal %d", WTERMSIG(status));
+        } else {
+            snprintf(r.failure, sizeof(r.failure), "worker exited with %d and no result",
+                     WEXITSTATUS(status));
+        }
+        r.ns = native_nanos() - w.start_ns;
+    }
+    frames += r.frames;
+    instructions += r.instructions;
+
+    char input[24];
+    if (w.instance == 0) {
+        snprintf(input, sizeof(input), "scripted");
+    } else {
+        snprintf(input, sizeof(input), "seed %08x", soak_seed(seed_base, w.instance));
+    }
+    printf("[soak] #%-3u %-13s %6u frames %6u lists %6.2f M inst/s %6.0f frames/s  hash %08x  %s%s\n",
+           w.instance, input, r.frames, r.lists, r.ns ? r.instructions / (r.ns / 1e3) : 0.0,
+           r.ns ? r.frames / (r.ns / 1e9) : 0.0, r.hash,
+           r.failure[0] ? "FAIL " : "ok", r.failure);
+    return !r.failure[0];
+}
+
+// Run 'instances' instances of 'frames' frames on 'jobs' workers (0 =
+// one per CPU). Returns the number of failed instances.
+int soak_run(uint32_t instances, uint32_t frames, int jobs, uint32_t seed_base) {
+    if (jobs <= 0) jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs <= 0) jobs = 1;
+    if ((uint32_t)jobs > instances) jobs = instances;
+
+    printf("\n[soak] %u instances x %u frames (%.1f s emulated each) on %d workers, seed %u\n",
+           instances, frames, (double)frames * CPU_CYCLES_PER_FRAME / CPU_CLOCK_HZ, jobs, seed_base);
+
+    soak_worker* workers = new soak_worker[jobs];
+    int running = 0;
+    uint32_t next = 0, failed = 0;
+    uint64_t frames_total = 0, instructions_total = 0;
+    uint64_t t0 = native_nanos();
+
+    while (next < instances || running > 0) {
+        while (running < jobs && next < instances) {
+            if (!soak_start(workers[running], next, frames, soak_seed(seed_base, next))) break;
+            running++;
+            next++;
+        }
+        if (running == 0) {
+            // Nothing could be started: count the rest as failed
+            failed += instances - next;
+            break;
+        }
+
+        int status;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            perror("waitpid");
+            break;
+        }
+        for (int i = 0; i < running; i++) {
+            if (workers[i].pid != pid) continue;
+            if (!soak_finish(workers[i], status, seed_base, frames_total, instructions_total)) failed++;
+            workers[i] = workers[--running];
+            break;
+        }
+    }
+    delete[] workers;
+
+    double wall_s = (native_nanos() - t0) / 1e9;
+    printf("[soak] %s: %u/%u instances held, %llu frames in %.2f s, %.0f frames/s "
+           "(%.1fx real time), %.1f M inst/s\n",
+           failed ? "FAIL" : "PASS", instances - failed, instances,
+           (unsigned long long)frames_total, wall_s, frames_total / wall_s,
+           frames_total / wall_s * CPU_CYCLES_PER_FRAME / CPU_CLOCK_HZ,
+           instructions_total / (wall_s * 1e6));
+    return failed;
+}
@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 """
 Asteroids ROM to C Header Converter
-Converts Asteroids arcade ROM files to C header arrays for ESP32
+Packs the Asteroids arcade ROM files into one address-space image for ESP32
 
 ROM Memory Map:
 - Vector RAM:  0x4000-0x47FF (2KB) - Not converted, allocated at runtime
@@ -10,60 +10,102 @@ ROM Memory Map:
 - PROM1:       0x7000-0x77FF (2KB) - 035144-04e.h2
 - PROM2:       0x7800-0x7FFF (2KB) - 035143-02.j2
 
-The 6KB program ROM space (0x6800-0x7FFF) is mirrored throughout 0x6800-0xFFFF
-to provide access to reset vectors at 0xFFFC-0xFFFF.
+The image covers the 32KB CPU address space 0x0000-0x7FFF with every ROM
+at its CPU address, so a ROM byte is image[addr & 0x7FFF]: the board does
+not decode A15, which mirrors 0x0000-0x7FFF at 0x8000-0xFFFF (reset
+vectors at 0xFFFC-0xFFFF). Unused space reads 0xFF. The RAM area at
+0x0000 is never mapped and carries IMAGE_MAGIC instead, so a flashed
+image partition can be recognized.
+
+Output:
+- ../src/asteroid_rom_image.h  image as C array (built into the firmware)
+- ../src/asteroid_roms.h       combined include
+- asteroid_rom_image.bin       image for the "roms" flash partition
+                               (ROM_IMAGE_PARTITION in config.h)
 """
 
 import os
 import sys
 
-def convert_rom_to_header(input_file, output_file, array_name, description):
-    """Convert binary ROM to C header file"""
+IMAGE_SIZE = 0x8000
+IMAGE_MAGIC = b"ASTEROIDINO-ROM1"
+
+def build_image(placements):
+    """Place each ROM file at its CPU address in a 32KB image"""
+    image = bytearray([0xFF]) * IMAGE_SIZE
+    image[0:len(IMAGE_MAGIC)] = IMAGE_MAGIC
     
-    # Read ROM data
-    try:
+    for input_file, address, size in placements:
         with open(input_file, 'rb') as f:
             data = f.read()
-    except FileNotFoundError:
-        print(f"Error: File '{input_file}' not found!")
-        return False
-    
-    rom_size = len(data)
-    print(f"Converting {input_file} ({rom_size} bytes) -> {output_file}")
+        if len(data) != size:
+            print(f"Error: {input_file} has {len(data)} bytes, expected {size}!")
+            return None
+        print(f"Placing {input_file} ({size} bytes) at 0x{address:04X}-0x{address + size - 1:04X}")
+        image[address:address + size] = data
     
-    # Generate C header
+    return image
+
+def write_image_header(image, output_file, array_name, description):
+    """Write the image as C header, rows of 16 bytes with CPU addresses"""
     with open(output_file, 'w') as f:
-        # Header guard
         guard_name = array_name.upper() + "_H"
         f.write(f"#ifndef {guard_name}\n")
         f.write(f"#define {guard_name}\n\n")
         
-        # Description comment
         f.write(f"// {description}\n")
-        f.write(f"// Source: {input_file}\n")
-        f.write(f"// Size: {rom_size} bytes\n\n")
+        f.write(f"// Generated by romconv/convert_roms.py\n")
+        f.write(f"// Size: {len(image)} bytes\n\n")
         
-        # Array declaration with PROGMEM for ESP32
         f.write(f"#include <Arduino.h>\n\n")
-        f.write(f"const uint8_t PROGMEM {array_name}[{rom_size}] = {{\n")
+        f.write(f"alignas(4) const uint8_t {array_name}[{len(image)}] = {{\n")
         
-        # Write data in rows of 16 bytes
-        for i in range(0, rom_size, 16):
-            f.write("    ")
-            for j in range(16):
-                if i + j < rom_size:
-                    f.write(f"0x{data[i+j]:02X}")
-                    if i + j < rom_size - 1:
-                        f.write(", ")
-                    if j == 15 or i + j == rom_size - 1:
-                        f.write(f"  // 0x{i+j:04X}")
-            f.write("\n")
+        for i in range(0, len(image), 16):
+            row = ", ".join(f"0x{b:02X}" for b in image[i:i + 16])
+            comma = "," if i + 16 < len(image) else ""
+            f.write(f"    {row}{comma}  // 0x{i:04X}\n")
         
         f.write("};\n\n")
         f.write(f"#endif // {guard_name}\n")
     
     print(f"  → Created {output_file} with array '{array_name}'")
-    return True
+
+def write_combined_header(output_file):
+    with open(output_file, 'w') as f:
+        f.write("""/* asteroid_roms.h
+ * Combined ROM includes for Asteroids
+ * Generated by romconv/convert_roms.py
+ */
+
+#ifndef ASTEROID_ROMS_H
+#define ASTEROID_ROMS_H
+
+// Asteroids ROM Set - Memory Map:
+//   0x0000-0x0FFF: RAM (4KB)
+//   0x4000-0x47FF: Vector RAM (2KB)
+//   0x5000-0x57FF: Vector ROM - 035127-02.np3 (2KB)
+//   0x6800-0x6FFF: PROM0 - 035145-04e.ef2 (2KB)
+//   0x7000-0x77FF: PROM1 - 035144-04e.h2 (2KB)
+//   0x7800-0x7FFF: PROM2 - 035143-02.j2 (2KB)
+//
+// All of them sit at their CPU address in one 32KB image, mirrored at
+// 0x8000-0xFFFF (A15 is not decoded): ROM byte = image[addr & 0x7FFF]
+
+#define ROM_IMAGE_SIZE   0x8000
+#define ROM_IMAGE_MAGIC  "ASTEROIDINO-ROM1"   // At image offset 0 (RAM area)
+
+// The firmware array is left out when the image comes from the
+// "roms" flash partition (ROM_IMAGE_PARTITION in config.h)
+#if !ROM_IMAGE_PARTITION
+#include "asteroid_rom_image.h"
+#endif
+
+// Mark that ROMs are available
+#define ASTEROID_ROMS_CONVERTED 1
+
+#endif // ASTEROID_ROMS_H
+""")
+    print(f"  → Created {output_file}")
 
 def main():
     print("=" * 70)
@@ -87,41 +129,40 @@ def main():
     
     print("Found all required ROM files.\n")
     
-    # Convert each ROM
-    conversions = [
-        ('035127-02.np3', '../src/asteroid_rom_vector.h', 'asteroid_rom_vector',
-         'Asteroids Vector ROM (035127-02) - Address: 0x5000-0x57FF'),
-        ('035145-04e.ef2', '../src/asteroid_rom_prom0.h', 'asteroid_rom_prom0',
-         'Asteroids PROM0 (035145-04e) - Address: 0x6800-0x6FFF'),
-        ('035144-04e.h2', '../src/asteroid_rom_prom1.h', 'asteroid_rom_prom1',
-         'Asteroids PROM1 (035144-04e) - Address: 0x7000-0x77FF'),
-        ('035143-02.j2', '../src/asteroid_rom_prom2.h', 'asteroid_rom_prom2',
-         'Asteroids PROM2 (035143-02) - Address: 0x7800-0x7FFF'),
+    # Pack all ROMs into the address-space image
+    placements = [
+        (rom_files['vector'], 0x5000, 0x800),
+        (rom_files['prom0'],  0x6800, 0x800),
+        (rom_files['prom1'],  0x7000, 0x800),
+        (rom_files['prom2'],  0x7800, 0x800),
     ]
     
-    success_count = 0
-    for input_file, output_file, array_name, description in conversions:
-        if convert_rom_to_header(input_file, output_file, array_name, description):
-            success_count += 1
-        print()
-    
-    if success_count == len(conversions):
-        print("=" * 70)
-        print("SUCCESS! All ROM files converted.")
-        print("=" * 70)
-        print()
-        print("Memory Map:")
-        print("  0x4000-0x47FF: Vector RAM (allocated at runtime)")
-        print("  0x5000-0x57FF: Vector ROM (asteroid_rom_vector)")
-        print("  0x6800-0x6FFF: PROM0 (asteroid_rom_prom0)")
-        print("  0x7000-0x77FF: PROM1 (asteroid_rom_prom1)")
-        print("  0x7800-0x7FFF: PROM2 (asteroid_rom_prom2)")
-        print()
-        print("Note: Program ROMs are mirrored throughout 0x6800-0xFFFF")
-        return 0
-    else:
-        print(f"ERROR: Only {success_count}/{len(conversions)} conversions succeeded")
+    image = build_image(placements)
+    if image is None:
+        print("ERROR: Could not build the ROM image")
         return 1
+    print()
+    
+    write_image_header(image, '../src/asteroid_rom_image.h', 'asteroid_rom_image',
+                       'Asteroids ROM image - CPU address space 0x0000-0x7FFF')
+    write_combined_header('../src/asteroid_roms.h')
+    with open('asteroid_rom_image.bin', 'wb') as f:
+        f.write(image)
+    print("  → Created asteroid_rom_image.bin (flash partition image)")
+    print()
+    
+    print("=" * 70)
+    print("SUCCESS! ROM image created.")
+    print("=" * 70)
+    print()
+    print("Memory Map:")
+    print("  0x4000-0x47FF: Vector RAM (allocated at runtime)")
+    print("  0x5000-0x57FF: Vector ROM")
+    print("  0x6800-0x7FFF: Program ROM (PROM0-2)")
+    print()
+    print("Note: The image is mirrored at 0x8000-0xFFFF")
+    print("Flash partition: esptool.py write_flash 0x290000 asteroid_rom_image.bin")
+    return 0
 
 if __name__ == '__main__':
     sys.exit(main())
@@ -1,142 +0,0 @@
-/* asteroid_rom_prog1.h
- * Program ROM 1 (Rev 2)
- * Auto-generated from 035145-02.ef2
- * Size: 2048 bytes
- * Load address: 0x6800
- */
-
-#ifndef ASTEROID_ROM_PROG1_H
-#define ASTEROID_ROM_PROG1_H
-
-const unsigned char asteroid_rom_prog1[2048] = {
-  0x4C, 0xF3, 0x7C, 0x20, 0xFA, 0x6E, 0x20, 0xD8, 0x6E, 0x20, 0x68, 0x71, 0xAD, 0x07, 0x20, 0x30,
-  0xFE, 0x46, 0x5B, 0x90, 0xF7, 0xAD, 0x02, 0x20, 0x30, 0xFB, 0xAD, 0x01, 0x40, 0x49, 0x02, 0x8D,
-  0x01, 0x40, 0x8D, 0x00, 0x30, 0x8D, 0x00, 0x34, 0xE6, 0x5C, 0xD0, 0x02, 0xE6, 0x5D, 0xA2, 0x40,
-  0x29, 0x02, 0xD0, 0x02, 0xA2, 0x44, 0xA9, 0x02, 0x85, 0x02, 0x86, 0x03, 0x20, 0x85, 0x68, 0xB0,
-  0xC2, 0x20, 0x5C, 0x76, 0x20, 0x90, 0x6D, 0x10, 0x1B, 0x20, 0xC4, 0x73, 0xB0, 0x16, 0xA5, 0x5A,
-  0xD0, 0x0C, 0x20, 0xD7, 0x6C, 0x20, 0x74, 0x6E, 0x20, 0x3F, 0x70, 0x20, 0x93, 0x6B, 0x20, 0x57,
-  0x6F, 0x20, 0xF0, 0x69, 0x20, 0x4F, 0x72, 0x20, 0x55, 0x75, 0xA9, 0x7F, 0xAA, 0x20, 0x03, 0x7C,
-  0x20, 0xB5, 0x77, 0x20, 0xC0, 0x7B, 0xAD, 0xFB, 0x02, 0xF0, 0x03, 0xCE, 0xFB, 0x02, 0x0D, 0xF6,
-  0x02, 0xD0, 0x89, 0xF0, 0x84, 0xA5, 0x1C, 0xF0, 0x14, 0xA5, 0x5A, 0xD0, 0x03, 0x4C, 0x60, 0x69,
-  0xC6, 0x5A, 0x20, 0xE2, 0x69, 0x18, 0x60, 0xA9, 0x02, 0x85, 0x70, 0xD0, 0x13, 0xA5, 0x71, 0x29,
-  0x03, 0xF0, 0xF4, 0x18, 0x69, 0x07, 0xA8, 0xA5, 0x32, 0x25, 0x33, 0x10, 0x03, 0x20, 0xF6, 0x77,
-  0xA4, 0x70, 0xF0, 0xE1, 0xA2, 0x01, 0xAD, 0x03, 0x24, 0x30, 0x23, 0xC0, 0x02, 0x90, 0x7C, 0xAD,
-  0x04, 0x24, 0x10, 0x77, 0xA5, 0x6F, 0x09, 0x04, 0x85, 0x6F, 0x8D, 0x00, 0x32, 0x20, 0xD8, 0x6E,
-  0x20, 0x68, 0x71, 0x20, 0xE8, 0x71, 0xA5, 0x56, 0x85, 0x58, 0xA2, 0x02, 0xC6, 0x70, 0x86, 0x1C,
-  0xC6, 0x70, 0xA5, 0x6F, 0x29, 0xF8, 0x45, 0x1C, 0x85, 0x6F, 0x8D, 0x00, 0x32, 0x20, 0xE8, 0x71,
-  0xA9, 0x01, 0x8D, 0xFA, 0x02, 0x8D, 0xFA, 0x03, 0xA9, 0x92, 0x8D, 0xF8, 0x02, 0x8D, 0xF8, 0x03,
-  0x8D, 0xF7, 0x03, 0x8D, 0xF7, 0x02, 0xA9, 0x7F, 0x8D, 0xFB, 0x02, 0x8D, 0xFB, 0x03, 0xA9, 0x05,
-  0x8D, 0xFD, 0x02, 0x8D, 0xFD, 0x03, 0xA9, 0xFF, 0x85, 0x32, 0x85, 0x33, 0xA9, 0x80, 0x85, 0x5A,
-  0x0A, 0x85, 0x18, 0x85, 0x19, 0xA5, 0x56, 0x85, 0x57, 0xA9, 0x04, 0x85, 0x6C, 0x85, 0x6E, 0xA9,
-  0x30, 0x8D, 0xFC, 0x02, 0x8D, 0xFC, 0x03, 0x8D, 0x00, 0x3E, 0x60, 0xA5, 0x32, 0x25, 0x32, 0x10,
-  0x0B, 0xA5, 0x5C, 0x29, 0x20, 0xD0, 0x05, 0xA0, 0x06, 0x20, 0xF6, 0x77, 0xA5, 0x5C, 0x29, 0x0F,
-  0xD0, 0x0C, 0xA9, 0x01, 0xC5, 0x70, 0x69, 0x01, 0x49, 0x01, 0x45, 0x6F, 0x85, 0x6F, 0x18, 0x60,
-  0xA5, 0x5C, 0x29, 0x3F, 0xD0, 0x0A, 0xAD, 0xFC, 0x02, 0xC9, 0x08, 0xF0, 0x03, 0xCE, 0xFC, 0x02,
-  0xA6, 0x18, 0xB5, 0x57, 0xD0, 0x1C, 0xAD, 0x1F, 0x02, 0x0D, 0x20, 0x02, 0x0D, 0x21, 0x02, 0x0D,
-  0x22, 0x02, 0xD0, 0x0E, 0xA0, 0x07, 0x20, 0xF6, 0x77, 0xA5, 0x1C, 0xC9, 0x02, 0x90, 0x03, 0x20,
-  0xE2, 0x69, 0xAD, 0x1B, 0x02, 0xD0, 0x36, 0xAD, 0xFA, 0x02, 0xC9, 0x80, 0xD0, 0x2F, 0xA9, 0x10,
-  0x8D, 0xFA, 0x02, 0xA6, 0x1C, 0xA5, 0x57, 0x05, 0x58, 0xF0, 0x24, 0x20, 0x2D, 0x70, 0xCA, 0xF0,
-  0x1C, 0xA9, 0x80, 0x85, 0x5A, 0xA5, 0x18, 0x49, 0x01, 0xAA, 0xB5, 0x57, 0xF0, 0x0F, 0x86, 0x18,
-  0xA9, 0x04, 0x45, 0x6F, 0x85, 0x6F, 0x8D, 0x00, 0x32, 0x8A, 0x0A, 0x85, 0x19, 0x18, 0x60, 0x86,
-  0x1A, 0xA9, 0xFF, 0x85, 0x1C, 0x20, 0xFA, 0x6E, 0xA5, 0x6F, 0x29, 0xF8, 0x09, 0x03, 0x85, 0x6F,
-  0x18, 0x60, 0xA0, 0x01, 0x20, 0xF6, 0x77, 0xA4, 0x18, 0xC8, 0x98, 0x20, 0xD1, 0x7B, 0x60, 0x71,
-  0xA2, 0x07, 0xBD, 0x1B, 0x02, 0xF0, 0x02, 0x10, 0x04, 0xCA, 0x10, 0xF6, 0x60, 0xA0, 0x1C, 0xE0,
-  0x04, 0xB0, 0x07, 0x88, 0x8A, 0xD0, 0x03, 0x88, 0x30, 0xEF, 0xB9, 0x00, 0x02, 0xF0, 0xF8, 0x30,
-  0xF6, 0x85, 0x0B, 0xB9, 0xAF, 0x02, 0x38, 0xFD, 0xCA, 0x02, 0x85, 0x08, 0xB9, 0x69, 0x02, 0xFD,
-  0x84, 0x02, 0x4A, 0x66, 0x08, 0x0A, 0xF0, 0x0C, 0x10, 0x6D, 0x49, 0xFE, 0xD0, 0x69, 0xA5, 0x08,
-  0x49, 0xFF, 0x85, 0x08, 0xB9, 0xD2, 0x02, 0x38, 0xFD, 0xED, 0x02, 0x85, 0x09, 0xB9, 0x8C, 0x02,
-  0xFD, 0xA7, 0x02, 0x4A, 0x66, 0x09, 0x0A, 0xF0, 0x0C, 0x10, 0x4C, 0x49, 0xFE, 0xD0, 0x48, 0xA5,
-  0x09, 0x49, 0xFF, 0x85, 0x09, 0xA9, 0x2A, 0x46, 0x0B, 0xB0, 0x08, 0xA9, 0x48, 0x46, 0x0B, 0xB0,
-  0x02, 0xA9, 0x84, 0xE0, 0x01, 0xB0, 0x02, 0x69, 0x1C, 0xD0, 0x0C, 0x69, 0x12, 0xAE, 0x1C, 0x02,
-  0xCA, 0xF0, 0x02, 0x69, 0x12, 0xA2, 0x01, 0xC5, 0x08, 0x90, 0x1C, 0xC5, 0x09, 0x90, 0x18, 0x85,
-  0x0B, 0x4A, 0x18, 0x65, 0x0B, 0x85, 0x0B, 0xA5, 0x09, 0x65, 0x08, 0xB0, 0x0A, 0xC5, 0x0B, 0xB0,
-  0x06, 0x20, 0x0F, 0x6B, 0x4C, 0xF9, 0x69, 0x88, 0x30, 0xFA, 0x4C, 0x0A, 0x6A, 0xB9, 0x00, 0x02,
-  0x29, 0x07, 0x85, 0x08, 0x20, 0xB5, 0x77, 0x29, 0x18, 0x05, 0x08, 0x9D, 0x00, 0x02, 0xB9, 0xAF,
-  0x02, 0x9D, 0xAF, 0x02, 0xB9, 0x69, 0x02, 0x9D, 0x69, 0x02, 0xB9, 0xD2, 0x02, 0x9D, 0xD2, 0x02,
-  0xB9, 0x8C, 0x02, 0x9D, 0x8C, 0x02, 0xB9, 0x23, 0x02, 0x9D, 0x23, 0x02, 0xB9, 0x46, 0x02, 0x9D,
-  0x46, 0x02, 0x60, 0x85, 0x0B, 0x86, 0x0C, 0xA0, 0x00, 0xC8, 0xB1, 0x0B, 0x45, 0x09, 0x91, 0x02,
-  0x88, 0xC9, 0xF0, 0xB0, 0x1E, 0xC9, 0xA0, 0xB0, 0x16, 0xB1, 0x0B, 0x91, 0x02, 0xC8, 0xC8, 0xB1,
-  0x0B, 0x91, 0x02, 0xC8, 0xB1, 0x0B, 0x45, 0x08, 0x65, 0x17, 0x91, 0x02, 0xC8, 0xD0, 0xDA, 0x88,
-  0x4C, 0x39, 0x7C, 0xB1, 0x0B, 0x45, 0x08, 0x18, 0x65, 0x17, 0x91, 0x02, 0xC8, 0xD0, 0xED, 0xE0,
-  0x01, 0xD0, 0x08, 0xC0, 0x1B, 0xD0, 0x12, 0xA2, 0x00, 0xA0, 0x1C, 0x8A, 0xD0, 0x1E, 0xA9, 0x81,
-  0x8D, 0xFA, 0x02, 0xA6, 0x18, 0xD6, 0x57, 0xA2, 0x00, 0xA9, 0xA0, 0x9D, 0x1B, 0x02, 0xA9, 0x00,
-  0x9D, 0x3E, 0x02, 0x9D, 0x61, 0x02, 0xC0, 0x1B, 0x90, 0x0D, 0xB0, 0x37, 0xA9, 0x00, 0x9D, 0x1B,
-  0x02, 0xC0, 0x1B, 0xF0, 0x21, 0xB0, 0x2C, 0x20, 0xEC, 0x75, 0xB9, 0x00, 0x02, 0x29, 0x03, 0x49,
-  0x02, 0x4A, 0x6A, 0x6A, 0x09, 0x3F, 0x85, 0x69, 0xA9, 0xA0, 0x99, 0x00, 0x02, 0xA9, 0x00, 0x99,
-  0x23, 0x02, 0x99, 0x46, 0x02, 0x60, 0x8A, 0xA6, 0x18, 0xD6, 0x57, 0xAA, 0xA9, 0x81, 0x8D, 0xFA,
-  0x02, 0xD0, 0xD7, 0xAD, 0xF8, 0x02, 0x8D, 0xF7, 0x02, 0xA5, 0x1C, 0xF0, 0xCD, 0x86, 0x0D, 0xA6,
-  0x19, 0xAD, 0x1C, 0x02, 0x4A, 0xA9, 0x99, 0xB0, 0x02, 0xA9, 0x20, 0x20, 0x97, 0x73, 0xA6, 0x0D,
-  0x4C, 0x4A, 0x6B, 0xA5, 0x5C, 0x29, 0x03, 0xF0, 0x01, 0x60, 0xAD, 0x1C, 0x02, 0x30, 0xFA, 0xF0,
-  0x03, 0x4C, 0x34, 0x6C, 0xA5, 0x1C, 0xF0, 0x07, 0xAD, 0x1B, 0x02, 0xF0, 0xEC, 0x30, 0xEA, 0xAD,
-  0xF9, 0x02, 0xF0, 0x03, 0xCE, 0xF9, 0x02, 0xCE, 0xF7, 0x02, 0xD0, 0xDD, 0xA9, 0x12, 0x8D, 0xF7,
-  0x02, 0xAD, 0xF9, 0x02, 0xF0, 0x0A, 0xAD, 0xF6, 0x02, 0xF0, 0xCE, 0xCD, 0xFD, 0x02, 0xB0, 0xC9,
-  0xAD, 0xF8, 0x02, 0x38, 0xE9, 0x06, 0xC9, 0x20, 0x90, 0x03, 0x8D, 0xF8, 0x02, 0xA9, 0x00, 0x8D,
-  0xCB, 0x02, 0x8D, 0x85, 0x02, 0x20, 0xB5, 0x77, 0x4A, 0x6E, 0xEE, 0x02, 0x4A, 0x6E, 0xEE, 0x02,
-  0x4A, 0x6E, 0xEE, 0x02, 0xC9, 0x18, 0x90, 0x02, 0x29, 0x17, 0x8D, 0xA8, 0x02, 0xA2, 0x10, 0x24,
-  0x60, 0x70, 0x0C, 0xA9, 0x1F, 0x8D, 0x85, 0x02, 0xA9, 0xFF, 0x8D, 0xCB, 0x02, 0xA2, 0xF0, 0x8E,
-  0x3F, 0x02, 0xA2, 0x02, 0xAD, 0xF8, 0x02, 0x30, 0x17, 0xA4, 0x19, 0xB9, 0x53, 0x00, 0xC9, 0x30,
-  0xB0, 0x0D, 0x20, 0xB5, 0x77, 0x85, 0x08, 0xAD, 0xF8, 0x02, 0x4A, 0xC5, 0x08, 0xB0, 0x01, 0xCA,
-  0x8E, 0x1C, 0x02, 0x60, 0xA5, 0x5C, 0x0A, 0xD0, 0x0C, 0x20, 0xB5, 0x77, 0x29, 0x03, 0xAA, 0xBD,
-  0xD3, 0x6C, 0x8D, 0x62, 0x02, 0xA5, 0x1C, 0xF0, 0x05, 0xAD, 0xFA, 0x02, 0xD0, 0x05, 0xCE, 0xF7,
-  0x02, 0xF0, 0x01, 0x60, 0xA9, 0x0A, 0x8D, 0xF7, 0x02, 0xAD, 0x1C, 0x02, 0x4A, 0xF0, 0x06, 0x20,
-  0xB5, 0x77, 0x4C, 0xC4, 0x6C, 0xAD, 0x3F, 0x02, 0xC9, 0x80, 0x6A, 0x85, 0x0C, 0xAD, 0xCA, 0x02,
-  0x38, 0xED, 0xCB, 0x02, 0x85, 0x0B, 0xAD, 0x84, 0x02, 0xED, 0x85, 0x02, 0x06, 0x0B, 0x2A, 0x06,
-  0x0B, 0x2A, 0x38, 0xE5, 0x0C, 0xAA, 0xAD, 0x62, 0x02, 0xC9, 0x80, 0x6A, 0x85, 0x0C, 0xAD, 0xED,
-  0x02, 0x38, 0xED, 0xEE, 0x02, 0x85, 0x0B, 0xAD, 0xA7, 0x02, 0xED, 0xA8, 0x02, 0x06, 0x0B, 0x2A,
-  0x06, 0x0B, 0x2A, 0x38, 0xE5, 0x0C, 0xA8, 0x20, 0xF0, 0x76, 0x85, 0x62, 0x20, 0xB5, 0x77, 0xA6,
-  0x19, 0xB4, 0x53, 0xC0, 0x35, 0xA2, 0x00, 0x90, 0x01, 0xE8, 0x3D, 0xCF, 0x6C, 0x10, 0x03, 0x1D,
-  0xD1, 0x6C, 0x65, 0x62, 0x85, 0x62, 0xA0, 0x03, 0xA2, 0x01, 0x86, 0x0E, 0x4C, 0xF2, 0x6C, 0x8F,
-  0x87, 0x70, 0x78, 0xF0, 0x00, 0x00, 0x10, 0xA5, 0x1C, 0xF0, 0x21, 0x0E, 0x04, 0x20, 0x66, 0x63,
-  0x24, 0x63, 0x10, 0x18, 0x70, 0x16, 0xAD, 0xFA, 0x02, 0xD0, 0x11, 0xAA, 0xA9, 0x03, 0x85, 0x0E,
-  0xA0, 0x07, 0xB9, 0x1B, 0x02, 0xF0, 0x06, 0x88, 0xC4, 0x0E, 0xD0, 0xF6, 0x60, 0x86, 0x0D, 0xA9,
-  0x12, 0x99, 0x1B, 0x02, 0xB5, 0x61, 0x20, 0xD2, 0x77, 0xA6, 0x0D, 0xC9, 0x80, 0x6A, 0x85, 0x09,
-  0x18, 0x7D, 0x3E, 0x02, 0x30, 0x08, 0xC9, 0x70, 0x90, 0x0A, 0xA9, 0x6F, 0xD0, 0x06, 0xC9, 0x91,
-  0xB0, 0x02, 0xA9, 0x91, 0x99, 0x3E, 0x02, 0xB5, 0x61, 0x20, 0xD5, 0x77, 0xA6, 0x0D, 0xC9, 0x80,
-  0x6A, 0x85, 0x0C, 0x18, 0x7D, 0x61, 0x02, 0x30, 0x08, 0xC9, 0x70, 0x90, 0x0A, 0xA9, 0x6F, 0xD0,
-  0x06, 0xC9, 0x91, 0xB0, 0x02, 0xA9, 0x91, 0x99, 0x61, 0x02, 0xA2, 0x00, 0xA5, 0x09, 0x10, 0x01,
-  0xCA, 0x86, 0x08, 0xA6, 0x0D, 0xC9, 0x80, 0x6A, 0x18, 0x65, 0x09, 0x18, 0x7D, 0xCA, 0x02, 0x99,
-  0xCA, 0x02, 0xA5, 0x08, 0x7D, 0x84, 0x02, 0x99, 0x84, 0x02, 0xA2, 0x00, 0xA5, 0x0C, 0x10, 0x01,
-  0xCA, 0x86, 0x0B, 0xA6, 0x0D, 0xC9, 0x80, 0x6A, 0x18, 0x65, 0x0C, 0x18, 0x7D, 0xED, 0x02, 0x99,
-  0xED, 0x02, 0xA5, 0x0B, 0x7D, 0xA7, 0x02, 0x99, 0xA7, 0x02, 0xA9, 0x80, 0x95, 0x66, 0x60, 0xD8,
-  0xA5, 0x32, 0x25, 0x33, 0x10, 0x01, 0x60, 0xA5, 0x1A, 0x4A, 0xF0, 0x18, 0xA0, 0x01, 0x20, 0xF6,
-  0x77, 0xA0, 0x02, 0xA6, 0x33, 0x10, 0x01, 0x88, 0x84, 0x18, 0xA5, 0x5C, 0x29, 0x10, 0xD0, 0x04,
-  0x98, 0x20, 0xD1, 0x7B, 0x46, 0x18, 0x20, 0xB2, 0x73, 0xA0, 0x02, 0x20, 0xF6, 0x77, 0xA0, 0x03,
-  0x20, 0xF6, 0x77, 0xA0, 0x04, 0x20, 0xF6, 0x77, 0xA0, 0x05, 0x20, 0xF6, 0x77, 0xA9, 0x20, 0x85,
-  0x00, 0xA9, 0x64, 0xA2, 0x39, 0x20, 0x03, 0x7C, 0xA9, 0x70, 0x20, 0xDE, 0x7C, 0xA6, 0x18, 0xB4,
-  0x32, 0x84, 0x0B, 0x98, 0x18, 0x65, 0x31, 0x85, 0x0C, 0x20, 0x1A, 0x6F, 0xA4, 0x0B, 0xC8, 0x20,
-  0x1A, 0x6F, 0xA4, 0x0B, 0xC8, 0xC8, 0x20, 0x1A, 0x6F, 0xAD, 0x03, 0x20, 0x2A, 0x26, 0x63, 0xA5,
-  0x63, 0x29, 0x1F, 0xC9, 0x07, 0xD0, 0x27, 0xE6, 0x31, 0xA5, 0x31, 0xC9, 0x03, 0x90, 0x13, 0xA6,
-  0x18, 0xA9, 0xFF, 0x95, 0x32, 0xA2, 0x00, 0x86, 0x18, 0x86, 0x31, 0xA2, 0xF0, 0x86, 0x5D, 0x4C,
-  0xB2, 0x73, 0xE6, 0x0C, 0xA6, 0x0C, 0xA9, 0xF4, 0x85, 0x5D, 0xA9, 0x0B, 0x95, 0x34, 0xA5, 0x5D,
-  0xD0, 0x08, 0xA9, 0xFF, 0x85, 0x32, 0x85, 0x33, 0x30, 0xDB, 0xA5, 0x5C, 0x29, 0x07, 0xD0, 0x31,
-  0xAD, 0x07, 0x24, 0x10, 0x04, 0xA9, 0x01, 0xD0, 0x07, 0xAD, 0x06, 0x24, 0x10, 0x23, 0xA9, 0xFF,
-  0xA6, 0x0C, 0x18, 0x75, 0x34, 0x30, 0x10, 0xC9, 0x0B, 0xB0, 0x0E, 0xC9, 0x01, 0xF0, 0x04, 0xA9,
-  0x00, 0xF0, 0x0C, 0xA9, 0x0B, 0xD0, 0x08, 0xA9, 0x24, 0xC9, 0x25, 0x90, 0x02, 0xA9, 0x00, 0x95,
-  0x34, 0xA9, 0x00, 0x60, 0xA5, 0x1C, 0xF0, 0x5F, 0xAD, 0x1B, 0x02, 0x30, 0x5A, 0xAD, 0xFA, 0x02,
-  0xD0, 0x55, 0xAD, 0x03, 0x20, 0x10, 0x50, 0xA9, 0x00, 0x8D, 0x1B, 0x02, 0x8D, 0x3E, 0x02, 0x8D,
-  0x61, 0x02, 0xA9, 0x30, 0x8D, 0xFA, 0x02, 0x20, 0xB5, 0x77, 0x29, 0x1F, 0xC9, 0x1D, 0x90, 0x02,
-  0xA9, 0x1C, 0xC9, 0x03, 0xB0, 0x02, 0xA9, 0x03, 0x8D, 0x84, 0x02, 0xA2, 0x05, 0x20, 0xB5, 0x77,
-  0xCA, 0xD0, 0xFA, 0x29, 0x1F, 0xE8, 0xC9, 0x18, 0x90, 0x0C, 0x29, 0x07, 0x0A, 0x69, 0x04, 0xCD,
-  0xF6, 0x02, 0x90, 0x02, 0xA2, 0x80, 0xC9, 0x15, 0x90, 0x02, 0xA9, 0x14, 0xC9, 0x03, 0xB0, 0x02,
-  0xA9, 0x03, 0x8D, 0xA7, 0x02, 0x86, 0x59, 0x60, 0xA9, 0x02, 0x8D, 0xF5, 0x02, 0xA2, 0x03, 0x4E,
-  0x02, 0x28, 0xB0, 0x01, 0xE8, 0x86, 0x56, 0xA9, 0x00, 0xA2, 0x04, 0x9D, 0x1B, 0x02, 0x9D, 0x1F,
-  0x02, 0x95, 0x51, 0xCA, 0x10, 0xF5, 0x8D, 0xF6, 0x02, 0x60, 0xA9, 0x00, 0x8D, 0x00, 0x36, 0x8D,
-  0x00, 0x3A, 0x8D, 0x00, 0x3C, 0x8D, 0x01, 0x3C, 0x8D, 0x03, 0x3C, 0x8D, 0x04, 0x3C, 0x8D, 0x05,
-  0x3C, 0x85, 0x69, 0x85, 0x66, 0x85, 0x67, 0x85, 0x68, 0x60, 0xB9, 0x34, 0x00, 0x0A, 0xA8, 0xD0,
-  0x14, 0xA5, 0x32, 0x25, 0x33, 0x30, 0x0E, 0xA9, 0x72, 0xA2, 0xF8, 0x20, 0x45, 0x7D, 0xA9, 0x01,
-  0xA2, 0xF8, 0x4C, 0x45, 0x7D, 0xBE, 0xD5, 0x56, 0xB9, 0xD4, 0x56, 0x4C, 0x45, 0x7D, 0xF0, 0x16,
-  0x84, 0x08, 0xA2, 0xD5, 0xA0, 0xE0, 0x84, 0x00, 0x20, 0x03, 0x7C, 0xA2, 0xDA, 0xA9, 0x54, 0x20,
-  0xFC, 0x7B, 0xC6, 0x08, 0xD0, 0xF5, 0x60, 0xA2, 0x22, 0xBD, 0x00, 0x02, 0xD0, 0x04, 0xCA, 0x10,
-  0xF8, 0x60, 0x10, 0x63, 0x20, 0x08, 0x77, 0x4A, 0x4A, 0x4A, 0x4A, 0xE0, 0x1B, 0xD0, 0x07, 0xA5,
-  0x5C, 0x29, 0x01, 0x4A, 0xF0, 0x01, 0x38, 0x7D, 0x00, 0x02, 0x30, 0x25, 0xE0, 0x1B, 0xF0, 0x13,
-  0xB0, 0x17, 0xCE, 0xF6, 0x02, 0xD0, 0x05, 0xA0, 0x7F, 0x8C, 0xFB, 0x02, 0xA9, 0x00, 0x9D, 0x00,
-  0x02, 0xF0, 0xCB, 0x20, 0xE8, 0x71, 0x4C, 0x8C, 0x6F, 0xAD, 0xF8, 0x02, 0x8D, 0xF7, 0x02, 0xD0,
-  0xEB, 0x9D, 0x00, 0x02, 0x29, 0xF0, 0x18, 0x69, 0x10, 0xE0, 0x1B, 0xD0, 0x02, 0xA9, 0x00, 0xA8,
-  0xBD, 0xAF, 0x02, 0x85, 0x04, 0xBD, 0x69, 0x02, 0x85, 0x05, 0xBD, 0xD2, 0x02, 0x85, 0x06, 0xBD,
-  0x8C, 0x02, 0x85, 0x07, 0x4C, 0x27, 0x70, 0x18, 0xA0, 0x00, 0xBD, 0x23, 0x02, 0x10, 0x01, 0x88,
-  0x7D, 0xAF, 0x02, 0x9D, 0xAF, 0x02, 0x85, 0x04, 0x98, 0x7D, 0x69, 0x02, 0xC9, 0x20, 0x90, 0x0C,
-  0x29, 0x1F, 0xE0, 0x1C, 0xD0, 0x06, 0x20, 0x2D, 0x70, 0x4C, 0x5E, 0x6F, 0x9D, 0x69, 0x02, 0x85,
-  0x05, 0x18, 0xA0, 0x00, 0xBD, 0x46, 0x02, 0x10, 0x02, 0xA0, 0xFF, 0x7D, 0xD2, 0x02, 0x9D, 0xD2,
-};
-
-#endif // ASTEROID_ROM_PROG1_H
@@ -1,142 +0,0 @@
-/* asteroid_rom_prog2.h
- * Program ROM 2 (Rev 2)
- * Auto-generated from 035144-02.h2
- * Size: 2048 bytes
- * Load address: 0x7000
- */
-
-#ifndef ASTEROID_ROM_PROG2_H
-#define ASTEROID_ROM_PROG2_H
-
-const unsigned char asteroid_rom_prog2[2048] = {
-  0x02, 0x85, 0x06, 0x98, 0x7D, 0x8C, 0x02, 0xC9, 0x18, 0x90, 0x08, 0xF0, 0x04, 0xA9, 0x17, 0xD0,
-  0x02, 0xA9, 0x00, 0x9D, 0x8C, 0x02, 0x85, 0x07, 0xBD, 0x00, 0x02, 0xA0, 0xE0, 0x4A, 0xB0, 0x07,
-  0xA0, 0xF0, 0x4A, 0xB0, 0x02, 0xA0, 0x00, 0x20, 0xFE, 0x72, 0x4C, 0x5E, 0x6F, 0xAD, 0xF8, 0x02,
-  0x8D, 0xF7, 0x02, 0xA9, 0x00, 0x8D, 0x1C, 0x02, 0x8D, 0x3F, 0x02, 0x8D, 0x62, 0x02, 0x60, 0xA5,
-  0x1C, 0xF0, 0x42, 0xAD, 0x1B, 0x02, 0x30, 0x3D, 0xAD, 0xFA, 0x02, 0xF0, 0x39, 0xCE, 0xFA, 0x02,
-  0xD0, 0x33, 0xA4, 0x59, 0x30, 0x19, 0xD0, 0x10, 0x20, 0x39, 0x71, 0xD0, 0x24, 0xAC, 0x1C, 0x02,
-  0xF0, 0x06, 0xA0, 0x02, 0x8C, 0xFA, 0x02, 0x60, 0xA9, 0x01, 0x8D, 0x1B, 0x02, 0xD0, 0x12, 0xA9,
-  0xA0, 0x8D, 0x1B, 0x02, 0xA2, 0x3E, 0x86, 0x69, 0xA6, 0x18, 0xD6, 0x57, 0xA9, 0x81, 0x8D, 0xFA,
-  0x02, 0xA9, 0x00, 0x85, 0x59, 0x60, 0xAD, 0x07, 0x24, 0x10, 0x04, 0xA9, 0x03, 0xD0, 0x07, 0xAD,
-  0x06, 0x24, 0x10, 0x07, 0xA9, 0xFD, 0x18, 0x65, 0x61, 0x85, 0x61, 0xA5, 0x5C, 0x4A, 0xB0, 0xE5,
-  0xAD, 0x05, 0x24, 0x10, 0x3C, 0xA9, 0x80, 0x8D, 0x03, 0x3C, 0xA0, 0x00, 0xA5, 0x61, 0x20, 0xD2,
-  0x77, 0x10, 0x01, 0x88, 0x0A, 0x18, 0x65, 0x64, 0xAA, 0x98, 0x6D, 0x3E, 0x02, 0x20, 0x25, 0x71,
-  0x8D, 0x3E, 0x02, 0x86, 0x64, 0xA0, 0x00, 0xA5, 0x61, 0x20, 0xD5, 0x77, 0x10, 0x01, 0x88, 0x0A,
-  0x18, 0x65, 0x65, 0xAA, 0x98, 0x6D, 0x61, 0x02, 0x20, 0x25, 0x71, 0x8D, 0x61, 0x02, 0x86, 0x65,
-  0x60, 0xA9, 0x00, 0x8D, 0x03, 0x3C, 0xAD, 0x3E, 0x02, 0x05, 0x64, 0xF0, 0x18, 0xAD, 0x3E, 0x02,
-  0x0A, 0xA2, 0xFF, 0x18, 0x49, 0xFF, 0x30, 0x02, 0xE8, 0x38, 0x65, 0x64, 0x85, 0x64, 0x8A, 0x6D,
-  0x3E, 0x02, 0x8D, 0x3E, 0x02, 0xA5, 0x65, 0x0D, 0x61, 0x02, 0xF0, 0x18, 0xAD, 0x61, 0x02, 0x0A,
-  0xA2, 0xFF, 0x18, 0x49, 0xFF, 0x30, 0x02, 0x38, 0xE8, 0x65, 0x65, 0x85, 0x65, 0x8A, 0x6D, 0x61,
-  0x02, 0x8D, 0x61, 0x02, 0x60, 0x30, 0x09, 0xC9, 0x40, 0x90, 0x0D, 0xA2, 0xFF, 0xA9, 0x3F, 0x60,
-  0xC9, 0xC0, 0xB0, 0x04, 0xA2, 0x01, 0xA9, 0xC0, 0x60, 0xA2, 0x1C, 0xBD, 0x00, 0x02, 0xF0, 0x1E,
-  0xBD, 0x69, 0x02, 0x38, 0xED, 0x84, 0x02, 0xC9, 0x04, 0x90, 0x04, 0xC9, 0xFC, 0x90, 0x0F, 0xBD,
-  0x8C, 0x02, 0x38, 0xED, 0xA7, 0x02, 0xC9, 0x04, 0x90, 0x09, 0xC9, 0xFC, 0xB0, 0x05, 0xCA, 0x10,
-  0xDA, 0xE8, 0x60, 0xEE, 0xFA, 0x02, 0x60, 0x90, 0xA2, 0x1A, 0xAD, 0xFB, 0x02, 0xD0, 0x70, 0xAD,
-  0x1C, 0x02, 0xD0, 0x73, 0x8D, 0x3F, 0x02, 0x8D, 0x62, 0x02, 0xEE, 0xFD, 0x02, 0xAD, 0xFD, 0x02,
-  0xC9, 0x0B, 0x90, 0x03, 0xCE, 0xFD, 0x02, 0xAD, 0xF5, 0x02, 0x18, 0x69, 0x02, 0xC9, 0x0B, 0x90,
-  0x02, 0xA9, 0x0B, 0x8D, 0xF6, 0x02, 0x8D, 0xF5, 0x02, 0x85, 0x08, 0xA0, 0x1C, 0x20, 0xB5, 0x77,
-  0x29, 0x18, 0x09, 0x04, 0x9D, 0x00, 0x02, 0x20, 0x03, 0x72, 0x20, 0xB5, 0x77, 0x4A, 0x29, 0x1F,
-  0x90, 0x13, 0xC9, 0x18, 0x90, 0x02, 0x29, 0x17, 0x9D, 0x8C, 0x02, 0xA9, 0x00, 0x9D, 0x69, 0x02,
-  0x9D, 0xAF, 0x02, 0xF0, 0x0B, 0x9D, 0x69, 0x02, 0xA9, 0x00, 0x9D, 0x8C, 0x02, 0x9D, 0xD2, 0x02,
-  0xCA, 0xC6, 0x08, 0xD0, 0xC8, 0xA9, 0x7F, 0x8D, 0xF7, 0x02, 0xA9, 0x30, 0x8D, 0xFC, 0x02, 0xA9,
-  0x00, 0x9D, 0x00, 0x02, 0xCA, 0x10, 0xFA, 0x60, 0xA9, 0x60, 0x8D, 0xCA, 0x02, 0x8D, 0xED, 0x02,
-  0xA9, 0x00, 0x8D, 0x3E, 0x02, 0x8D, 0x61, 0x02, 0xA9, 0x10, 0x8D, 0x84, 0x02, 0xA9, 0x0C, 0x8D,
-  0xA7, 0x02, 0x60, 0x20, 0xB5, 0x77, 0x29, 0x8F, 0x10, 0x02, 0x09, 0xF0, 0x18, 0x79, 0x23, 0x02,
-  0x20, 0x33, 0x72, 0x9D, 0x23, 0x02, 0x20, 0xB5, 0x77, 0x20, 0xB5, 0x77, 0x20, 0xB5, 0x77, 0x20,
-  0xB5, 0x77, 0x29, 0x8F, 0x10, 0x02, 0x09, 0xF0, 0x18, 0x79, 0x46, 0x02, 0x20, 0x33, 0x72, 0x9D,
-  0x46, 0x02, 0x60, 0x10, 0x0D, 0xC9, 0xE1, 0xB0, 0x02, 0xA9, 0xE1, 0xC9, 0xFB, 0x90, 0x0F, 0xA9,
-  0xFA, 0x60, 0xC9, 0x06, 0xB0, 0x02, 0xA9, 0x06, 0xC9, 0x20, 0x90, 0x02, 0xA9, 0x1F, 0x60, 0xA9,
-  0x10, 0x85, 0x00, 0xA9, 0x50, 0xA2, 0xA4, 0x20, 0xFC, 0x7B, 0xA9, 0x19, 0xA2, 0xDB, 0x20, 0x03,
-  0x7C, 0xA9, 0x70, 0x20, 0xDE, 0x7C, 0xA2, 0x00, 0xA5, 0x1C, 0xC9, 0x02, 0xD0, 0x18, 0xA5, 0x18,
-  0xD0, 0x14, 0xA2, 0x20, 0xAD, 0x1B, 0x02, 0x05, 0x59, 0xD0, 0x0B, 0xAD, 0xFA, 0x02, 0x30, 0x06,
-  0xA5, 0x5C, 0x29, 0x10, 0xF0, 0x0D, 0xA9, 0x52, 0xA0, 0x02, 0x38, 0x20, 0x3F, 0x77, 0xA9, 0x00,
-  0x20, 0x8B, 0x77, 0xA9, 0x28, 0xA4, 0x57, 0x20, 0x3E, 0x6F, 0xA9, 0x00, 0x85, 0x00, 0xA9, 0x78,
-  0xA2, 0xDB, 0x20, 0x03, 0x7C, 0xA9, 0x50, 0x20, 0xDE, 0x7C, 0xA9, 0x1D, 0xA0, 0x02, 0x38, 0x20,
-  0x3F, 0x77, 0xA9, 0x00, 0x20, 0xD1, 0x7B, 0xA9, 0x10, 0x85, 0x00, 0xA9, 0xC0, 0xA2, 0xDB, 0x20,
-  0x03, 0x7C, 0xA9, 0x50, 0x20, 0xDE, 0x7C, 0xA2, 0x00, 0xA5, 0x1C, 0xC9, 0x01, 0xF0, 0x2E, 0x90,
-  0x18, 0xA5, 0x18, 0xF0, 0x14, 0xA2, 0x20, 0xAD, 0x1B, 0x02, 0x05, 0x59, 0xD0, 0x0B, 0xAD, 0xFA,
-  0x02, 0x30, 0x06, 0xA5, 0x5C, 0x29, 0x10, 0xF0, 0x0D, 0xA9, 0x54, 0xA0, 0x02, 0x38, 0x20, 0x3F,
-  0x77, 0xA9, 0x00, 0x20, 0x8B, 0x77, 0xA9, 0xCF, 0xA4, 0x58, 0x4C, 0x3E, 0x6F, 0x60, 0x84, 0x00,
-  0x86, 0x0D, 0xA5, 0x05, 0x4A, 0x66, 0x04, 0x4A, 0x66, 0x04, 0x4A, 0x66, 0x04, 0x85, 0x05, 0xA5,
-  0x07, 0x18, 0x69, 0x04, 0x4A, 0x66, 0x06, 0x4A, 0x66, 0x06, 0x4A, 0x66, 0x06, 0x85, 0x07, 0xA2,
-  0x04, 0x20, 0x1C, 0x7C, 0xA9, 0x70, 0x38, 0xE5, 0x00, 0xC9, 0xA0, 0x90, 0x0E, 0x48, 0xA9, 0x90,
-  0x20, 0xDE, 0x7C, 0x68, 0x38, 0xE9, 0x10, 0xC9, 0xA0, 0xB0, 0xF2, 0x20, 0xDE, 0x7C, 0xA6, 0x0D,
-  0xBD, 0x00, 0x02, 0x10, 0x16, 0xE0, 0x1B, 0xF0, 0x0C, 0x29, 0x0C, 0x4A, 0xA8, 0xB9, 0xF8, 0x50,
-  0xBE, 0xF9, 0x50, 0xD0, 0x1B, 0x20, 0x65, 0x74, 0xA6, 0x0D, 0x60, 0xE0, 0x1B, 0xF0, 0x17, 0xE0,
-  0x1C, 0xF0, 0x19, 0xB0, 0x1F, 0x29, 0x18, 0x4A, 0x4A, 0xA8, 0xB9, 0xDE, 0x51, 0xBE, 0xDF, 0x51,
-  0x20, 0x45, 0x7D, 0xA6, 0x0D, 0x60, 0x20, 0x0B, 0x75, 0xA6, 0x0D, 0x60, 0xAD, 0x50, 0x52, 0xAE,
-  0x51, 0x52, 0xD0, 0xEC, 0xA9, 0x70, 0xA2, 0xF0, 0x20, 0xE0, 0x7C, 0xA6, 0x0D, 0xA5, 0x5C, 0x29,
-  0x03, 0xD0, 0x03, 0xDE, 0x00, 0x02, 0x60, 0xF8, 0x75, 0x52, 0x95, 0x52, 0x90, 0x12, 0xB5, 0x53,
-  0x69, 0x00, 0x95, 0x53, 0x29, 0x0F, 0xD0, 0x08, 0xA9, 0xB0, 0x85, 0x68, 0xA6, 0x18, 0xF6, 0x57,
-  0xD8, 0x60, 0xA5, 0x18, 0x0A, 0x0A, 0x85, 0x08, 0xA5, 0x6F, 0x29, 0xFB, 0x05, 0x08, 0x85, 0x6F,
-  0x8D, 0x00, 0x32, 0x60, 0xA5, 0x1C, 0xF0, 0x02, 0x18, 0x60, 0xA5, 0x5D, 0x29, 0x04, 0xD0, 0xF8,
-  0xA5, 0x1D, 0x05, 0x1E, 0xF0, 0xF2, 0xA0, 0x00, 0x20, 0xF6, 0x77, 0xA2, 0x00, 0x86, 0x10, 0xA9,
-  0x01, 0x85, 0x00, 0xA9, 0xA7, 0x85, 0x0E, 0xA9, 0x10, 0x85, 0x00, 0xB5, 0x1D, 0x15, 0x1E, 0xF0,
-  0x67, 0x86, 0x0F, 0xA9, 0x5F, 0xA6, 0x0E, 0x20, 0x03, 0x7C, 0xA9, 0x40, 0x20, 0xDE, 0x7C, 0xA5,
-  0x0F, 0x4A, 0xF8, 0x69, 0x01, 0xD8, 0x85, 0x0D, 0xA9, 0x0D, 0x38, 0xA0, 0x01, 0xA2, 0x00, 0x20,
-  0x3F, 0x77, 0xA9, 0x40, 0xAA, 0x20, 0xE0, 0x7C, 0xA0, 0x00, 0x20, 0x35, 0x6F, 0xA5, 0x0F, 0x18,
-  0x69, 0x1D, 0xA0, 0x02, 0x38, 0xA2, 0x00, 0x20, 0x3F, 0x77, 0xA9, 0x00, 0x20, 0xD1, 0x7B, 0xA0,
-  0x00, 0x20, 0x35, 0x6F, 0xA4, 0x10, 0x20, 0x1A, 0x6F, 0xE6, 0x10, 0xA4, 0x10, 0x20, 0x1A, 0x6F,
-  0xE6, 0x10, 0xA4, 0x10, 0x20, 0x1A, 0x6F, 0xE6, 0x10, 0xA5, 0x0E, 0x38, 0xE9, 0x08, 0x85, 0x0E,
-  0xA6, 0x0F, 0xE8, 0xE8, 0xE0, 0x14, 0x90, 0x93, 0x38, 0x60, 0xA2, 0x1A, 0xBD, 0x00, 0x02, 0xF0,
-  0x03, 0xCA, 0x10, 0xF8, 0x60, 0xAD, 0x1B, 0x02, 0xC9, 0xA2, 0xB0, 0x22, 0xA2, 0x0A, 0xBD, 0xEC,
-  0x50, 0x4A, 0x4A, 0x4A, 0x4A, 0x18, 0x69, 0xF8, 0x49, 0xF8, 0x95, 0x7E, 0xBD, 0xED, 0x50, 0x4A,
-  0x4A, 0x4A, 0x4A, 0x18, 0x69, 0xF8, 0x49, 0xF8, 0x95, 0x8A, 0xCA, 0xCA, 0x10, 0xE0, 0xAD, 0x1B,
-  0x02, 0x49, 0xFF, 0x29, 0x70, 0x4A, 0x4A, 0x4A, 0xAA, 0x86, 0x09, 0xA0, 0x00, 0xBD, 0xEC, 0x50,
-  0x10, 0x01, 0x88, 0x18, 0x75, 0x7D, 0x95, 0x7D, 0x98, 0x75, 0x7E, 0x95, 0x7E, 0x85, 0x04, 0x84,
-  0x05, 0xA0, 0x00, 0xBD, 0xED, 0x50, 0x10, 0x01, 0x88, 0x18, 0x75, 0x89, 0x95, 0x89, 0x98, 0x75,
-  0x8A, 0x95, 0x8A, 0x85, 0x06, 0x84, 0x07, 0xA5, 0x02, 0x85, 0x0B, 0xA5, 0x03, 0x85, 0x0C, 0x20,
-  0x49, 0x7C, 0xA4, 0x09, 0xB9, 0xE0, 0x50, 0xBE, 0xE1, 0x50, 0x20, 0x45, 0x7D, 0xA4, 0x09, 0xB9,
-  0xE1, 0x50, 0x49, 0x04, 0xAA, 0xB9, 0xE0, 0x50, 0x29, 0x0F, 0x49, 0x04, 0x20, 0x45, 0x7D, 0xA0,
-  0xFF, 0xC8, 0xB1, 0x0B, 0x91, 0x02, 0xC8, 0xB1, 0x0B, 0x49, 0x04, 0x91, 0x02, 0xC0, 0x03, 0x90,
-  0xF0, 0x20, 0x39, 0x7C, 0xA6, 0x09, 0xCA, 0xCA, 0x10, 0x8F, 0x60, 0xA2, 0x00, 0x86, 0x17, 0xA0,
-  0x00, 0xA5, 0x61, 0x10, 0x06, 0xA0, 0x04, 0x8A, 0x38, 0xE5, 0x61, 0x85, 0x08, 0x24, 0x08, 0x30,
-  0x02, 0x50, 0x07, 0xA2, 0x04, 0xA9, 0x80, 0x38, 0xE5, 0x08, 0x86, 0x08, 0x84, 0x09, 0x4A, 0x29,
-  0xFE, 0xA8, 0xB9, 0x6E, 0x52, 0xBE, 0x6F, 0x52, 0x20, 0xD3, 0x6A, 0xAD, 0x05, 0x24, 0x10, 0x14,
-  0xA5, 0x5C, 0x29, 0x04, 0xF0, 0x0E, 0xC8, 0xC8, 0x38, 0xA6, 0x0C, 0x98, 0x65, 0x0B, 0x90, 0x01,
-  0xE8, 0x20, 0xD3, 0x6A, 0x60, 0xA5, 0x1C, 0xD0, 0x01, 0x60, 0xA2, 0x00, 0xAD, 0x1C, 0x02, 0x30,
-  0x0A, 0xF0, 0x08, 0x6A, 0x6A, 0x6A, 0x8D, 0x02, 0x3C, 0xA2, 0x80, 0x8E, 0x00, 0x3C, 0xA2, 0x01,
-  0x20, 0xCD, 0x75, 0x8D, 0x01, 0x3C, 0xCA, 0x20, 0xCD, 0x75, 0x8D, 0x04, 0x3C, 0xAD, 0x1B, 0x02,
-  0xC9, 0x01, 0xF0, 0x04, 0x8A, 0x8D, 0x03, 0x3C, 0xAD, 0xF6, 0x02, 0xF0, 0x11, 0xAD, 0x1B, 0x02,
-  0x30, 0x0C, 0x05, 0x59, 0xF0, 0x08, 0xA5, 0x6D, 0xF0, 0x14, 0xC6, 0x6D, 0xD0, 0x21, 0xA5, 0x6C,
-  0x29, 0x0F, 0x85, 0x6C, 0x8D, 0x00, 0x3A, 0xAD, 0xFC, 0x02, 0x85, 0x6E, 0x10, 0x11, 0xC6, 0x6E,
-  0xD0, 0x0D, 0xA9, 0x04, 0x85, 0x6D, 0xA5, 0x6C, 0x49, 0x14, 0x85, 0x6C, 0x8D, 0x00, 0x3A, 0xA5,
-  0x69, 0xAA, 0x29, 0x3F, 0xF0, 0x01, 0xCA, 0x86, 0x69, 0x8E, 0x00, 0x36, 0x60, 0xB5, 0x6A, 0x30,
-  0x0C, 0xB5, 0x66, 0x10, 0x12, 0xA9, 0x10, 0x95, 0x66, 0xA9, 0x80, 0x30, 0x0C, 0xB5, 0x66, 0xF0,
-  0x06, 0x30, 0x04, 0xD6, 0x66, 0xD0, 0xF2, 0xA9, 0x00, 0x95, 0x6A, 0x60, 0x86, 0x0D, 0xA9, 0x50,
-  0x8D, 0xF9, 0x02, 0xB9, 0x00, 0x02, 0x29, 0x78, 0x85, 0x0E, 0xB9, 0x00, 0x02, 0x29, 0x07, 0x4A,
-  0xAA, 0xF0, 0x02, 0x05, 0x0E, 0x99, 0x00, 0x02, 0xA5, 0x1C, 0xF0, 0x11, 0xA5, 0x0D, 0xF0, 0x04,
-  0xC9, 0x04, 0x90, 0x09, 0xBD, 0x59, 0x76, 0xA6, 0x19, 0x18, 0x20, 0x97, 0x73, 0xBE, 0x00, 0x02,
-  0xF0, 0x34, 0x20, 0x5A, 0x74, 0x30, 0x2F, 0xEE, 0xF6, 0x02, 0x20, 0x9D, 0x6A, 0x20, 0x03, 0x72,
-  0xBD, 0x23, 0x02, 0x29, 0x1F, 0x0A, 0x5D, 0xAF, 0x02, 0x9D, 0xAF, 0x02, 0x20, 0x5C, 0x74, 0x30,
-  0x15, 0xEE, 0xF6, 0x02, 0x20, 0x9D, 0x6A, 0x20, 0x03, 0x72, 0xBD, 0x46, 0x02, 0x29, 0x1F, 0x0A,
-  0x5D, 0xD2, 0x02, 0x9D, 0xD2, 0x02, 0xA6, 0x0D, 0x60, 0x10, 0x05, 0x02, 0xA5, 0x1C, 0x10, 0x38,
-  0xA2, 0x02, 0x85, 0x5D, 0x85, 0x32, 0x85, 0x33, 0xA0, 0x00, 0xB9, 0x1D, 0x00, 0xD5, 0x52, 0xB9,
-  0x1E, 0x00, 0xF5, 0x53, 0x90, 0x23, 0xC8, 0xC8, 0xC0, 0x14, 0x90, 0xEE, 0xCA, 0xCA, 0x10, 0xE8,
-  0xA5, 0x33, 0x30, 0x0E, 0xC5, 0x32, 0x90, 0x0A, 0x69, 0x02, 0xC9, 0x1E, 0x90, 0x02, 0xA9, 0xFF,
-  0x85, 0x33, 0xA9, 0x00, 0x85, 0x1C, 0x85, 0x31, 0x60, 0x86, 0x0B, 0x84, 0x0C, 0x8A, 0x4A, 0xAA,
-  0x98, 0x4A, 0x65, 0x0C, 0x85, 0x0D, 0x95, 0x32, 0xA2, 0x1B, 0xA0, 0x12, 0xE4, 0x0D, 0xF0, 0x1F,
-  0xB5, 0x31, 0x95, 0x34, 0xB5, 0x32, 0x95, 0x35, 0xB5, 0x33, 0x95, 0x36, 0xB9, 0x1B, 0x00, 0x99,
-  0x1D, 0x00, 0xB9, 0x1C, 0x00, 0x99, 0x1E, 0x00, 0x88, 0x88, 0xCA, 0xCA, 0xCA, 0xD0, 0xDD, 0xA9,
-  0x0B, 0x95, 0x34, 0xA9, 0x00, 0x95, 0x35, 0x95, 0x36, 0xA9, 0xF0, 0x85, 0x5D, 0xA6, 0x0B, 0xA4,
-  0x0C, 0xB5, 0x53, 0x99, 0x1E, 0x00, 0xB5, 0x52, 0x99, 0x1D, 0x00, 0xA0, 0x00, 0xF0, 0x8D, 0xDF,
-  0x98, 0x10, 0x09, 0x20, 0x08, 0x77, 0x20, 0xFC, 0x76, 0x4C, 0x08, 0x77, 0xA8, 0x8A, 0x10, 0x0E,
-  0x20, 0x08, 0x77, 0x20, 0x0E, 0x77, 0x49, 0x80, 0x49, 0xFF, 0x18, 0x69, 0x01, 0x60, 0x85, 0x0C,
-  0x98, 0xC5, 0x0C, 0xF0, 0x10, 0x90, 0x11, 0xA4, 0x0C, 0x85, 0x0C, 0x98, 0x20, 0x28, 0x77, 0x38,
-  0xE9, 0x40, 0x4C, 0x08, 0x77, 0xA9, 0x20, 0x60, 0x20, 0x6C, 0x77, 0xBD, 0x2F, 0x77, 0x60, 0x00,
-  0x02, 0x05, 0x07, 0x0A, 0x0C, 0x0F, 0x11, 0x13, 0x15, 0x17, 0x19, 0x1A, 0x1C, 0x1D, 0x1F, 0x08,
-  0x86, 0x17, 0x88, 0x84, 0x16, 0x18, 0x65, 0x16, 0x85, 0x15, 0x28, 0xAA, 0x08, 0xB5, 0x00, 0x4A,
-  0x4A, 0x4A, 0x4A, 0x28, 0x20, 0x85, 0x77, 0xA5, 0x16, 0xD0, 0x01, 0x18, 0xA6, 0x15, 0xB5, 0x00,
-  0x20, 0x85, 0x77, 0xC6, 0x15, 0xA6, 0x15, 0xC6, 0x16, 0x10, 0xE1, 0x60, 0xA0, 0x00, 0x84, 0x0B,
-  0xA0, 0x04, 0x26, 0x0B, 0x2A, 0xC5, 0x0C, 0x90, 0x02, 0xE5, 0x0C, 0x88, 0xD0, 0xF4, 0xA5, 0x0B,
-  0x2A, 0x29, 0x0F, 0xAA, 0x60, 0x90, 0x04, 0x29, 0x0F, 0xF0, 0x27, 0xA6, 0x17, 0xF0, 0x23, 0x29,
-  0x0F, 0x18, 0x69, 0x01, 0x08, 0x0A, 0xA8, 0xB9, 0xD4, 0x56, 0x0A, 0x85, 0x0B, 0xB9, 0xD5, 0x56,
-  0x2A, 0x29, 0x1F, 0x09, 0x40, 0x85, 0x0C, 0xA9, 0x00, 0x85, 0x08, 0x85, 0x09, 0x20, 0xD7, 0x6A,
-  0x28, 0x60, 0x4C, 0xCB, 0x7B, 0x06, 0x5F, 0x26, 0x60, 0x10, 0x02, 0xE6, 0x5F, 0xA5, 0x5F, 0x2C,
-  0xD1, 0x77, 0xF0, 0x04, 0x49, 0x01, 0x85, 0x5F, 0x05, 0x60, 0xD0, 0x02, 0xE6, 0x5F, 0xA5, 0x5F,
-  0x60, 0x02, 0x18, 0x69, 0x40, 0x10, 0x08, 0x29, 0x7F, 0x20, 0xDF, 0x77, 0x4C, 0x08, 0x77, 0xC9,
-  0x41, 0x90, 0x04, 0x49, 0x7F, 0x69, 0x00, 0xAA, 0xBD, 0xB9, 0x57, 0x60, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAD, 0x03, 0x28, 0x29, 0x03, 0x0A, 0xAA, 0xA9, 0x10, 0x85,
-};
-
-#endif // ASTEROID_ROM_PROG2_H
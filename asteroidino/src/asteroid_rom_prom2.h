@@ -1,141 +0,0 @@
-#ifndef ASTEROID_ROM_PROM2_H
-#define ASTEROID_ROM_PROM2_H
-
-// Asteroids PROM2 (035143-02) - Address: 0x7800-0x7FFF
-// Source: 035143-02.j2
-// Size: 2048 bytes
-
-#include <Arduino.h>
-
-const uint8_t PROGMEM asteroid_rom_prom2[2048] = {
-    0x00, 0xBD, 0x88, 0x78, 0x85, 0x09, 0xBD, 0x87, 0x78, 0x85, 0x08, 0x71, 0x08, 0x85, 0x08, 0x90,   // 0x000F
-    0x02, 0xE6, 0x09, 0x98, 0x0A, 0xA8, 0xB9, 0x71, 0x78, 0xBE, 0x72, 0x78, 0x20, 0x03, 0x7C, 0xA9,   // 0x001F
-    0x70, 0x20, 0xDE, 0x7C, 0xA0, 0x00, 0xA2, 0x00, 0xA1, 0x08, 0x85, 0x0B, 0x4A, 0x4A, 0x20, 0x4D,   // 0x002F
-    0x78, 0xA1, 0x08, 0x2A, 0x26, 0x0B, 0x2A, 0xA5, 0x0B, 0x2A, 0x0A, 0x20, 0x53, 0x78, 0xA1, 0x08,   // 0x003F
-    0x85, 0x0B, 0x20, 0x4D, 0x78, 0x46, 0x0B, 0x90, 0xDF, 0x88, 0x4C, 0x39, 0x7C, 0xE6, 0x08, 0xD0,   // 0x004F
-    0x02, 0xE6, 0x09, 0x29, 0x3E, 0xD0, 0x04, 0x68, 0x68, 0xD0, 0xEE, 0xC9, 0x0A, 0x90, 0x02, 0x69,   // 0x005F
-    0x0D, 0xAA, 0xBD, 0xD2, 0x56, 0x91, 0x02, 0xC8, 0xBD, 0xD3, 0x56, 0x91, 0x02, 0xC8, 0xA2, 0x00,   // 0x006F
-    0x60, 0x64, 0xB6, 0x64, 0xB6, 0x0C, 0xAA, 0x0C, 0xA2, 0x0C, 0x9A, 0x0C, 0x92, 0x64, 0xC6, 0x64,   // 0x007F
-    0x9D, 0x50, 0x39, 0x50, 0x39, 0x50, 0x39, 0x1E, 0x57, 0x8F, 0x78, 0x46, 0x79, 0xF3, 0x79, 0x0B,   // 0x008F
-    0x15, 0x1B, 0x35, 0x4D, 0x65, 0x7F, 0x8D, 0x93, 0x9F, 0xAB, 0x64, 0xD2, 0x3B, 0x2E, 0xC2, 0x6C,   // 0x009F
-    0x5A, 0x4C, 0x93, 0x6F, 0xBD, 0x1A, 0x4C, 0x12, 0xB0, 0x40, 0x6B, 0x2C, 0x0A, 0x6C, 0x5A, 0x4C,   // 0x00AF
-    0x93, 0x6E, 0x0B, 0x6E, 0xC0, 0x52, 0x6C, 0x92, 0xB8, 0x50, 0x4D, 0x82, 0xF2, 0x58, 0x90, 0x4C,   // 0x00BF
-    0x4D, 0xF0, 0x4C, 0x80, 0x33, 0x70, 0xC2, 0x42, 0x5A, 0x4C, 0x4C, 0x82, 0xBB, 0x52, 0x0B, 0x58,   // 0x00CF
-    0xB2, 0x42, 0x6C, 0x9A, 0xC3, 0x4A, 0x82, 0x64, 0x0A, 0x5A, 0x90, 0x00, 0xF6, 0x6C, 0x09, 0xB2,   // 0x00DF
-    0x3B, 0x2E, 0xC1, 0x4C, 0x4C, 0xB6, 0x2B, 0x20, 0x0D, 0xA6, 0xC1, 0x70, 0x48, 0x50, 0xB6, 0x52,   // 0x00EF
-    0x3B, 0xD2, 0x90, 0x00, 0xDA, 0x64, 0x90, 0x4C, 0xC9, 0xD8, 0xBE, 0x0A, 0x32, 0x42, 0x9B, 0xC2,   // 0x00FF
-    0x67, 0x68, 0x4D, 0xAE, 0xA1, 0x4E, 0x48, 0x50, 0xB6, 0x52, 0x3B, 0xD2, 0x90, 0x00, 0xBE, 0x0A,   // 0x010F
-    0xB6, 0x1E, 0x94, 0xD2, 0xA2, 0x92, 0x0A, 0x2C, 0xCA, 0x4E, 0x7A, 0x65, 0xBD, 0x1A, 0x4C, 0x12,   // 0x011F
-    0x92, 0x13, 0x18, 0x62, 0xCA, 0x64, 0xF2, 0x42, 0x20, 0x6E, 0xA3, 0x52, 0x82, 0x40, 0x18, 0x62,   // 0x012F
-    0xCA, 0x64, 0xF2, 0x42, 0x18, 0x6E, 0xA3, 0x52, 0x80, 0x00, 0x20, 0x62, 0xCA, 0x64, 0xF2, 0x64,   // 0x013F
-    0x08, 0xC2, 0xBD, 0x1A, 0x4C, 0x00, 0x0B, 0x15, 0x19, 0x31, 0x41, 0x57, 0x73, 0x7F, 0x89, 0x95,   // 0x014F
-    0xA1, 0x8A, 0x5A, 0x84, 0x12, 0xCD, 0x82, 0xB9, 0xE6, 0xB2, 0x40, 0x74, 0xF2, 0x4D, 0x83, 0xD4,   // 0x015F
-    0xF0, 0xB2, 0x42, 0xB9, 0xE6, 0xB2, 0x42, 0x4D, 0xF0, 0x0E, 0x64, 0x0A, 0x12, 0xB8, 0x46, 0x10,   // 0x016F
-    0x62, 0x4B, 0x60, 0x82, 0x72, 0xB5, 0xC0, 0xBE, 0xA8, 0x0A, 0x64, 0xC5, 0x92, 0xF0, 0x74, 0x9D,   // 0x017F
-    0xC2, 0x6C, 0x9A, 0xC3, 0x4A, 0x82, 0x6F, 0xA4, 0xF2, 0xBD, 0xD2, 0xF0, 0x6C, 0x9E, 0x0A, 0xC2,   // 0x018F
-    0x42, 0xA4, 0xF2, 0xB0, 0x74, 0x9D, 0xC2, 0x6C, 0x9A, 0xC3, 0x4A, 0x82, 0x6F, 0xA4, 0xF2, 0xBD,   // 0x019F
-    0xD2, 0xF0, 0x58, 0xED, 0x12, 0xB5, 0xE8, 0x29, 0xD2, 0x0D, 0x72, 0x2C, 0x90, 0x0C, 0x12, 0xC6,   // 0x01AF
-    0x2C, 0x48, 0x4E, 0x9D, 0xAC, 0x49, 0xF0, 0x48, 0x00, 0x2D, 0x28, 0xCF, 0x52, 0xB0, 0x6E, 0xCD,   // 0x01BF
-    0x82, 0xBE, 0x0A, 0xB6, 0x00, 0x53, 0x64, 0x0A, 0x12, 0x0D, 0x0A, 0xB6, 0x1A, 0x48, 0x00, 0x18,   // 0x01CF
-    0x68, 0x6A, 0x4E, 0x48, 0x48, 0x0B, 0xA6, 0xCA, 0x72, 0xB5, 0xC0, 0x18, 0x68, 0x6A, 0x4E, 0x48,   // 0x01DF
-    0x46, 0x0B, 0xA6, 0xCA, 0x72, 0xB0, 0x00, 0x20, 0x68, 0x6A, 0x4E, 0x4D, 0xC2, 0x18, 0x5C, 0x9E,   // 0x01EF
-    0x52, 0xCD, 0x80, 0x0B, 0x11, 0x17, 0x31, 0x45, 0x5F, 0x6B, 0x73, 0x7D, 0x89, 0x93, 0xB2, 0x4E,   // 0x01FF
-    0x9D, 0x90, 0xB8, 0x00, 0x76, 0x56, 0x2A, 0x26, 0xB0, 0x40, 0xBE, 0x42, 0xA6, 0x64, 0xC1, 0x5C,   // 0x020F
-    0x48, 0x52, 0xBE, 0x0A, 0x0A, 0x64, 0xC5, 0x92, 0x0C, 0x26, 0xB8, 0x50, 0x6A, 0x7C, 0x0C, 0x52,   // 0x021F
-    0x74, 0xEC, 0x4D, 0xC0, 0xA4, 0xEC, 0x0A, 0x8A, 0xD4, 0xEC, 0x0A, 0x64, 0xC5, 0x92, 0x0D, 0xF2,   // 0x022F
-    0xB8, 0x5A, 0x93, 0x4E, 0x69, 0x60, 0x4D, 0xC0, 0x9D, 0x2C, 0x6C, 0x4A, 0x0D, 0xA6, 0xC1, 0x70,   // 0x023F
-    0x48, 0x68, 0x2D, 0x8A, 0x0D, 0xD2, 0x82, 0x4E, 0x3B, 0x66, 0x91, 0x6C, 0x0C, 0x0A, 0x0C, 0x12,   // 0x024F
-    0xC5, 0x8B, 0x9D, 0x2C, 0x6C, 0x4A, 0x0B, 0x3A, 0xA2, 0x6C, 0xBD, 0x0A, 0x3A, 0x40, 0xA6, 0x60,   // 0x025F
-    0xB9, 0x6C, 0x0D, 0xF0, 0x2D, 0xB1, 0x76, 0x52, 0x5C, 0xC2, 0xC2, 0x6C, 0x8B, 0x64, 0x2A, 0x27,   // 0x026F
-    0x18, 0x54, 0x69, 0xD8, 0x28, 0x48, 0x0B, 0xB2, 0x4A, 0xE6, 0xB8, 0x00, 0x18, 0x54, 0x69, 0xD8,   // 0x027F
-    0x28, 0x46, 0x0B, 0xB2, 0x4A, 0xE7, 0x20, 0x54, 0x69, 0xD8, 0x2D, 0xC2, 0x18, 0x5C, 0xCA, 0x56,   // 0x028F
-    0x98, 0x00, 0x52, 0xA2, 0x02, 0xBD, 0x00, 0x24, 0x0A, 0xB5, 0x7A, 0x29, 0x1F, 0x90, 0x37, 0xF0,   // 0x029F
-    0x10, 0xC9, 0x1B, 0xB0, 0x0A, 0xA8, 0xA5, 0x5E, 0x29, 0x07, 0xC9, 0x07, 0x98, 0x90, 0x02, 0xE9,   // 0x02AF
-    0x01, 0x95, 0x7A, 0xAD, 0x06, 0x20, 0x29, 0x80, 0xF0, 0x04, 0xA9, 0xF0, 0x85, 0x72, 0xA5, 0x72,   // 0x02BF
-    0xF0, 0x08, 0xC6, 0x72, 0xA9, 0x00, 0x95, 0x7A, 0x95, 0x77, 0x18, 0xB5, 0x77, 0xF0, 0x23, 0xD6,   // 0x02CF
-    0x77, 0xD0, 0x1F, 0x38, 0xB0, 0x1C, 0xC9, 0x1B, 0xB0, 0x09, 0xB5, 0x7A, 0x69, 0x20, 0x90, 0xD1,   // 0x02DF
-    0xF0, 0x01, 0x18, 0xA9, 0x1F, 0xB0, 0xCA, 0x95, 0x7A, 0xB5, 0x77, 0xF0, 0x01, 0x38, 0xA9, 0x78,   // 0x02EF
-    0x95, 0x77, 0x90, 0x23, 0xA9, 0x00, 0xE0, 0x01, 0x90, 0x16, 0xF0, 0x0C, 0xA5, 0x71, 0x29, 0x0C,   // 0x02FF
-    0x4A, 0x4A, 0xF0, 0x0C, 0x69, 0x02, 0xD0, 0x08, 0xA5, 0x71, 0x29, 0x10, 0xF0, 0x02, 0xA9, 0x01,   // 0x030F
-    0x38, 0x65, 0x73, 0x85, 0x73, 0xF6, 0x74, 0xCA, 0x30, 0x03, 0x4C, 0x95, 0x7A, 0xA5, 0x71, 0x29,   // 0x031F
-    0x03, 0xA8, 0xF0, 0x12, 0x4A, 0x69, 0x00, 0x49, 0xFF, 0x38, 0x65, 0x73, 0x90, 0x0A, 0xC0, 0x02,   // 0x032F
-    0xB0, 0x02, 0xE6, 0x70, 0xE6, 0x70, 0x85, 0x73, 0xA5, 0x5E, 0x4A, 0xB0, 0x27, 0xA0, 0x00, 0xA2,   // 0x033F
-    0x02, 0xB5, 0x74, 0xF0, 0x09, 0xC9, 0x10, 0x90, 0x05, 0x69, 0xEF, 0xC8, 0x95, 0x74, 0xCA, 0x10,   // 0x034F
-    0xF0, 0x98, 0xD0, 0x10, 0xA2, 0x02, 0xB5, 0x74, 0xF0, 0x07, 0x18, 0x69, 0xEF, 0x95, 0x74, 0x30,   // 0x035F
-    0x03, 0xCA, 0x10, 0xF2, 0x60, 0x48, 0x98, 0x48, 0x8A, 0x48, 0xD8, 0xAD, 0xFF, 0x01, 0x0D, 0xD0,   // 0x036F
-    0x01, 0xD0, 0xFE, 0xE6, 0x5E, 0xA5, 0x5E, 0x29, 0x03, 0xD0, 0x08, 0xE6, 0x5B, 0xA5, 0x5B, 0xC9,   // 0x037F
-    0x04, 0xB0, 0xFE, 0x20, 0x93, 0x7A, 0xA5, 0x6F, 0x29, 0xC7, 0x24, 0x74, 0x10, 0x02, 0x09, 0x08,   // 0x038F
-    0x24, 0x75, 0x10, 0x02, 0x09, 0x10, 0x24, 0x76, 0x10, 0x02, 0x09, 0x20, 0x85, 0x6F, 0x8D, 0x00,   // 0x039F
-    0x32, 0xA5, 0x72, 0xF0, 0x04, 0xA9, 0x80, 0xD0, 0x0E, 0xA5, 0x68, 0xF0, 0x0A, 0xA5, 0x5C, 0x6A,   // 0x03AF
-    0x90, 0x02, 0xC6, 0x68, 0x6A, 0x6A, 0x6A, 0x8D, 0x05, 0x3C, 0x68, 0xAA, 0x68, 0xA8, 0x68, 0x40,   // 0x03BF
-    0xA9, 0xB0, 0xA0, 0x00, 0x91, 0x02, 0xC8, 0x91, 0x02, 0xD0, 0x6E, 0x90, 0x04, 0x29, 0x0F, 0xF0,   // 0x03CF
-    0x05, 0x29, 0x0F, 0x18, 0x69, 0x01, 0x08, 0x0A, 0xA0, 0x00, 0xAA, 0xBD, 0xD4, 0x56, 0x91, 0x02,   // 0x03DF
-    0xBD, 0xD5, 0x56, 0xC8, 0x91, 0x02, 0x20, 0x39, 0x7C, 0x28, 0x60, 0x4A, 0x29, 0x0F, 0x09, 0xE0,   // 0x03EF
-    0xA0, 0x01, 0x91, 0x02, 0x88, 0x8A, 0x6A, 0x91, 0x02, 0xC8, 0xD0, 0x3D, 0x4A, 0x29, 0x0F, 0x09,   // 0x03FF
-    0xC0, 0xD0, 0xED, 0xA0, 0x00, 0x84, 0x05, 0x84, 0x07, 0x0A, 0x26, 0x05, 0x0A, 0x26, 0x05, 0x85,   // 0x040F
-    0x04, 0x8A, 0x0A, 0x26, 0x07, 0x0A, 0x26, 0x07, 0x85, 0x06, 0xA2, 0x04, 0xB5, 0x02, 0xA0, 0x00,   // 0x041F
-    0x91, 0x02, 0xB5, 0x03, 0x29, 0x0F, 0x09, 0xA0, 0xC8, 0x91, 0x02, 0xB5, 0x00, 0xC8, 0x91, 0x02,   // 0x042F
-    0xB5, 0x01, 0x29, 0x0F, 0x05, 0x00, 0xC8, 0x91, 0x02, 0x98, 0x38, 0x65, 0x02, 0x85, 0x02, 0x90,   // 0x043F
-    0x02, 0xE6, 0x03, 0x60, 0xA9, 0xD0, 0x4C, 0xC2, 0x7B, 0xA5, 0x05, 0xC9, 0x80, 0x90, 0x11, 0x49,   // 0x044F
-    0xFF, 0x85, 0x05, 0xA5, 0x04, 0x49, 0xFF, 0x69, 0x00, 0x85, 0x04, 0x90, 0x02, 0xE6, 0x05, 0x38,   // 0x045F
-    0x26, 0x08, 0xA5, 0x07, 0xC9, 0x80, 0x90, 0x11, 0x49, 0xFF, 0x85, 0x07, 0xA5, 0x06, 0x49, 0xFF,   // 0x046F
-    0x69, 0x00, 0x85, 0x06, 0x90, 0x02, 0xE6, 0x07, 0x38, 0x26, 0x08, 0xA5, 0x05, 0x05, 0x07, 0xF0,   // 0x047F
-    0x0A, 0xA2, 0x00, 0xC9, 0x02, 0xB0, 0x24, 0xA0, 0x01, 0xD0, 0x10, 0xA0, 0x02, 0xA2, 0x09, 0xA5,   // 0x048F
-    0x04, 0x05, 0x06, 0xF0, 0x16, 0x30, 0x04, 0xC8, 0x0A, 0x10, 0xFC, 0x98, 0xAA, 0xA5, 0x05, 0x06,   // 0x049F
-    0x04, 0x2A, 0x06, 0x06, 0x26, 0x07, 0x88, 0xD0, 0xF6, 0x85, 0x05, 0x8A, 0x38, 0xE9, 0x0A, 0x49,   // 0x04AF
-    0xFF, 0x0A, 0x66, 0x08, 0x2A, 0x66, 0x08, 0x2A, 0x0A, 0x85, 0x08, 0xA0, 0x00, 0xA5, 0x06, 0x91,   // 0x04BF
-    0x02, 0xA5, 0x08, 0x29, 0xF4, 0x05, 0x07, 0xC8, 0x91, 0x02, 0xA5, 0x04, 0xC8, 0x91, 0x02, 0xA5,   // 0x04CF
-    0x08, 0x29, 0x02, 0x0A, 0x05, 0x01, 0x05, 0x05, 0xC8, 0x91, 0x02, 0x4C, 0x39, 0x7C, 0xA2, 0x00,   // 0x04DF
-    0xA0, 0x01, 0x91, 0x02, 0x88, 0x98, 0x91, 0x02, 0xC8, 0xC8, 0x91, 0x02, 0xC8, 0x8A, 0x91, 0x02,   // 0x04EF
-    0x4C, 0x39, 0x7C, 0xA2, 0xFE, 0x9A, 0xD8, 0xA9, 0x00, 0xAA, 0xCA, 0x9D, 0x00, 0x03, 0x9D, 0x00,   // 0x04FF
-    0x02, 0x9D, 0x00, 0x01, 0x95, 0x00, 0xD0, 0xF2, 0xAC, 0x07, 0x20, 0x30, 0x43, 0xE8, 0x8E, 0x00,   // 0x050F
-    0x40, 0xA9, 0xE2, 0x8D, 0x01, 0x40, 0xA9, 0xB0, 0x8D, 0x03, 0x40, 0x85, 0x32, 0x85, 0x33, 0xA9,   // 0x051F
-    0x03, 0x85, 0x6F, 0x8D, 0x00, 0x32, 0x2D, 0x00, 0x28, 0x85, 0x71, 0xAD, 0x01, 0x28, 0x29, 0x03,   // 0x052F
-    0x0A, 0x0A, 0x05, 0x71, 0x85, 0x71, 0xAD, 0x02, 0x28, 0x29, 0x02, 0x0A, 0x0A, 0x0A, 0x05, 0x71,   // 0x053F
-    0x85, 0x71, 0x4C, 0x03, 0x68, 0xA0, 0x00, 0x91, 0x02, 0xC8, 0x8A, 0x91, 0x02, 0x4C, 0x39, 0x7C,   // 0x054F
-    0x9D, 0x00, 0x40, 0x9D, 0x00, 0x41, 0x9D, 0x00, 0x42, 0x9D, 0x00, 0x43, 0x9D, 0x00, 0x44, 0x9D,   // 0x055F
-    0x00, 0x45, 0x9D, 0x00, 0x46, 0x9D, 0x00, 0x47, 0xE8, 0xD0, 0xE5, 0x8D, 0x00, 0x34, 0xA2, 0x00,   // 0x056F
-    0xB5, 0x00, 0xD0, 0x47, 0xA9, 0x11, 0x95, 0x00, 0xA8, 0x55, 0x00, 0xD0, 0x3E, 0x98, 0x0A, 0x90,   // 0x057F
-    0xF5, 0xE8, 0xD0, 0xEC, 0x8D, 0x00, 0x34, 0x8A, 0x85, 0x00, 0x2A, 0x85, 0x01, 0xA0, 0x00, 0xA2,   // 0x058F
-    0x11, 0xB1, 0x00, 0xD0, 0x2A, 0x8A, 0x91, 0x00, 0x51, 0x00, 0xD0, 0x23, 0x8A, 0x0A, 0xAA, 0x90,   // 0x059F
-    0xF4, 0xC8, 0xD0, 0xEB, 0x8D, 0x00, 0x34, 0xE6, 0x01, 0xA6, 0x01, 0xE0, 0x04, 0x90, 0xE0, 0xA9,   // 0x05AF
-    0x40, 0xE0, 0x40, 0x90, 0xD6, 0xE0, 0x48, 0x90, 0xD6, 0xB0, 0x69, 0xA0, 0x00, 0xF0, 0x0E, 0xA0,   // 0x05BF
-    0x00, 0xA6, 0x01, 0xE0, 0x04, 0x90, 0x06, 0xC8, 0xE0, 0x44, 0x90, 0x01, 0xC8, 0xC9, 0x10, 0x2A,   // 0x05CF
-    0x29, 0x1F, 0xC9, 0x02, 0x2A, 0x29, 0x03, 0x88, 0x30, 0x04, 0x0A, 0x0A, 0x90, 0xF9, 0x4A, 0xA2,   // 0x05DF
-    0x14, 0x90, 0x02, 0xA2, 0x1D, 0x8E, 0x00, 0x3A, 0xA2, 0x00, 0xA0, 0x08, 0x2C, 0x01, 0x20, 0x10,   // 0x05EF
-    0xFB, 0x2C, 0x01, 0x20, 0x30, 0xFB, 0xCA, 0x8D, 0x00, 0x34, 0xD0, 0xF0, 0x88, 0xD0, 0xED, 0x8E,   // 0x05FF
-    0x00, 0x3A, 0xA0, 0x08, 0x2C, 0x01, 0x20, 0x10, 0xFB, 0x2C, 0x01, 0x20, 0x30, 0xFB, 0xCA, 0x8D,   // 0x060F
-    0x00, 0x34, 0xD0, 0xF0, 0x88, 0xD0, 0xED, 0xAA, 0xD0, 0xC4, 0x8D, 0x00, 0x34, 0xAD, 0x07, 0x20,   // 0x061F
-    0x30, 0xF8, 0x10, 0xFE, 0xA9, 0x00, 0xA8, 0xAA, 0x85, 0x08, 0xA9, 0x50, 0x85, 0x09, 0xA9, 0x04,   // 0x062F
-    0x85, 0x0B, 0xA9, 0xFF, 0x51, 0x08, 0xC8, 0xD0, 0xFB, 0xE6, 0x09, 0xC6, 0x0B, 0xD0, 0xF5, 0x95,   // 0x063F
-    0x0D, 0xE8, 0x8D, 0x00, 0x34, 0xA5, 0x09, 0xC9, 0x58, 0x90, 0xE1, 0xD0, 0x02, 0xA9, 0x68, 0xC9,   // 0x064F
-    0x80, 0x90, 0xD9, 0x8D, 0x00, 0x03, 0xA2, 0x04, 0x8E, 0x00, 0x32, 0x86, 0x15, 0xA2, 0x00, 0xCD,   // 0x065F
-    0x00, 0x02, 0xF0, 0x01, 0xE8, 0xAD, 0x00, 0x03, 0xC9, 0x88, 0xF0, 0x01, 0xE8, 0x86, 0x16, 0xA9,   // 0x066F
-    0x10, 0x85, 0x00, 0xA2, 0x24, 0xAD, 0x01, 0x20, 0x10, 0xFB, 0xAD, 0x01, 0x20, 0x30, 0xFB, 0xCA,   // 0x067F
-    0x10, 0xF3, 0x2C, 0x02, 0x20, 0x30, 0xFB, 0x8D, 0x00, 0x34, 0xA9, 0x00, 0x85, 0x02, 0xA9, 0x40,   // 0x068F
-    0x85, 0x03, 0xAD, 0x05, 0x20, 0x10, 0x5B, 0xA6, 0x15, 0xAD, 0x03, 0x20, 0x10, 0x0A, 0x4D, 0x09,   // 0x069F
-    0x00, 0x10, 0x05, 0xCA, 0xF0, 0x02, 0x86, 0x15, 0xBC, 0xBB, 0x7E, 0xA9, 0xB0, 0x91, 0x02, 0x88,   // 0x06AF
-    0x88, 0xB9, 0xC0, 0x7E, 0x91, 0x02, 0x88, 0x10, 0xF8, 0x4C, 0x9D, 0x7F, 0x33, 0x1D, 0x17, 0x0D,   // 0x06BF
-    0x80, 0xA0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xFF, 0x92, 0xFF, 0x73, 0xD0, 0xA1, 0x30, 0x02,   // 0x06CF
-    0x00, 0x70, 0x00, 0x00, 0x7F, 0xFB, 0x0D, 0xE0, 0x00, 0xB0, 0x7E, 0xFA, 0x11, 0xC0, 0x78, 0xFE,   // 0x06DF
-    0x00, 0xB0, 0x13, 0xC0, 0x00, 0xD0, 0x15, 0xC0, 0x00, 0xD0, 0x17, 0xC0, 0x00, 0xD0, 0x7A, 0xF8,   // 0x06EF
-    0x00, 0xD0, 0xA9, 0x50, 0xA2, 0x00, 0x20, 0xFC, 0x7B, 0xA9, 0x69, 0xA2, 0x93, 0x20, 0x03, 0x7C,   // 0x06FF
-    0xA9, 0x30, 0x20, 0xDE, 0x7C, 0xA2, 0x03, 0xBD, 0x00, 0x28, 0x29, 0x01, 0x86, 0x0B, 0x20, 0xD1,   // 0x070F
-    0x7B, 0xA6, 0x0B, 0xBD, 0x00, 0x28, 0x29, 0x02, 0x4A, 0x20, 0xD1, 0x7B, 0xA6, 0x0B, 0xCA, 0x10,   // 0x071F
-    0xE6, 0xA9, 0x7A, 0xA2, 0x9D, 0x20, 0x03, 0x7C, 0xA9, 0x10, 0x20, 0xDE, 0x7C, 0xAD, 0x02, 0x28,   // 0x072F
-    0x29, 0x02, 0x4A, 0x69, 0x01, 0x20, 0xD1, 0x7B, 0xAD, 0x01, 0x28, 0x29, 0x03, 0xAA, 0xBD, 0xF5,   // 0x073F
-    0x7F, 0x20, 0xD1, 0x7B, 0xA5, 0x16, 0xF0, 0x07, 0xA2, 0x88, 0xA9, 0x50, 0x20, 0xFC, 0x7B, 0xA2,   // 0x074F
-    0x96, 0x8E, 0x0C, 0x00, 0xA2, 0x07, 0xB5, 0x0D, 0xF0, 0x37, 0x48, 0x8E, 0x0B, 0x00, 0xAE, 0x0C,   // 0x075F
-    0x00, 0x8A, 0x38, 0xE9, 0x08, 0x8D, 0x0C, 0x00, 0xA9, 0x20, 0x20, 0x03, 0x7C, 0xA9, 0x70, 0x20,   // 0x076F
-    0xDE, 0x7C, 0xAD, 0x0B, 0x00, 0x20, 0xD1, 0x7B, 0xAD, 0xD4, 0x56, 0xAE, 0xD5, 0x56, 0x20, 0x45,   // 0x077F
-    0x7D, 0x68, 0x48, 0x4A, 0x4A, 0x4A, 0x4A, 0x20, 0xD1, 0x7B, 0x68, 0x20, 0xD1, 0x7B, 0xAE, 0x0B,   // 0x078F
-    0x00, 0xCA, 0x10, 0xC2, 0xA9, 0x7F, 0xAA, 0x20, 0x03, 0x7C, 0x20, 0xC0, 0x7B, 0xA9, 0x00, 0xA2,   // 0x079F
-    0x04, 0x3E, 0x03, 0x20, 0x6A, 0xCA, 0x10, 0xF9, 0xA8, 0xA2, 0x07, 0x3E, 0x00, 0x24, 0x2A, 0xCA,   // 0x07AF
-    0x10, 0xF9, 0xAA, 0x45, 0x08, 0x86, 0x08, 0x08, 0xA9, 0x04, 0x8D, 0x00, 0x32, 0x2E, 0x03, 0x20,   // 0x07BF
-    0x2A, 0x2E, 0x04, 0x20, 0x2A, 0x2E, 0x07, 0x24, 0x2A, 0x2E, 0x06, 0x24, 0x2A, 0x2E, 0x05, 0x24,   // 0x07CF
-    0x2A, 0xAA, 0x28, 0xD0, 0x09, 0x45, 0x0A, 0xD0, 0x05, 0x98, 0x45, 0x09, 0xF0, 0x02, 0xA9, 0x80,   // 0x07DF
-    0x8D, 0x05, 0x3C, 0x8D, 0x00, 0x32, 0x8D, 0x00, 0x30, 0x86, 0x0A, 0x84, 0x09, 0xAD, 0x07, 0x20,   // 0x07EF
-    0x10, 0xFE, 0x4C, 0x73, 0x7E, 0x01, 0x04, 0x05, 0x06, 0x4E, 0x65, 0x7B, 0xF3, 0x7C, 0xF3, 0x7C  // 0x07FF
-};
-
-#endif // ASTEROID_ROM_PROM2_H
@@ -1,6 +1,6 @@
 /* asteroid_roms.h
  * Combined ROM includes for Asteroids
- * Converted from MAME asteroid.zip
+ * Generated by romconv/convert_roms.py
  */
 
 #ifndef ASTEROID_ROMS_H
@@ -14,12 +14,17 @@
 //   0x7000-0x77FF: PROM1 - 035144-04e.h2 (2KB)
 //   0x7800-0x7FFF: PROM2 - 035143-02.j2 (2KB)
 //
-// Note: Program ROMs (6KB total) are mirrored throughout 0x6800-0xFFFF
+// All of them sit at their CPU address in one 32KB image, mirrored at
+// 0x8000-0xFFFF (A15 is not decoded): ROM byte = image[addr & 0x7FFF]
 
-#include "asteroid_rom_vector.h"
-#include "asteroid_rom_prom0.h"
-#include "asteroid_rom_prom1.h"
-#include "asteroid_rom_prom2.h"
+#define ROM_IMAGE_SIZE   0x8000
+#define ROM_IMAGE_MAGIC  "ASTEROIDINO-ROM1"   // At image offset 0 (RAM area)
+
+// The firmware array is left out when the image comes from the
+// "roms" flash partition (ROM_IMAGE_PARTITION in config.h)
+#if !ROM_IMAGE_PARTITION
+#include "asteroid_rom_image.h"
+#endif
 
 // Mark that ROMs are available
 #define ASTEROID_ROMS_CONVERTED 1
@@ -9,33 +9,86 @@
 // DISPLAY KONFIGURATION - SPI DAC für Vector-Ausgabe
 // ============================================================================
 
-// Hardware-Option: MCP4821 oder MCP4922
-// MCP4821: 2x Single-Channel DAC (ein CS pro Achse)
-// MCP4922: 1x Dual-Channel DAC (ein CS für beide Achsen)
-#define VECT_USE_MCP4821    1     // 1 = 2x MCP4821, 0 = 1x MCP4922
+// Hardware-Option: DAC-Backend (lib/vector_dac, eine .cpp pro Backend)
+// MCP4821:  3x Single-Channel DAC (ein CS pro Achse, Z analog)
+// MCP4922:  1x Dual-Channel DAC (ein CS für beide Achsen, Z digital),
+//           LDAC übernimmt X und Y gleichzeitig (kein schräger Sprung)
+// INTERNAL: die 8-bit DACs des ESP32 (GPIO25 = X, GPIO26 = Y), Z digital,
+//           Stream über I2S0 im DAC-Modus - für Boards ohne externe DACs
+// (per -D überschreibbar, z.B. für die Benchmarks in test/test_bench)
+#define VECT_DAC_MCP4821    0
+#define VECT_DAC_MCP4922    1
+#define VECT_DAC_INTERNAL   2
+#ifndef VECT_DAC_BACKEND
+#define VECT_DAC_BACKEND    VECT_DAC_MCP4821
+#endif
 
-#if VECT_USE_MCP4821
+#if VECT_DAC_BACKEND == VECT_DAC_MCP4821
   // 3x MCP4821 (Single 12-bit DAC für X, Y, Z)
   #define VECT_SPI_CS_X    5      // Chip Select X-Achse
   #define VECT_SPI_CS_Y    16     // Chip Select Y-Achse
   #define VECT_SPI_CS_Z    17     // Chip Select Z-Achse (Intensität)
   #define VECT_SPI_CLK     18     // SPI Clock (SCK) - shared
   #define VECT_SPI_MOSI    23     // SPI MOSI - shared
-#else
+  #define VECT_SPI_LDAC    -1     // LDAC aller drei Chips, -1 = fest auf GND
+#elif VECT_DAC_BACKEND == VECT_DAC_MCP4922
   // 1x MCP4922 (Dual 12-bit DAC) + Digital Z
   #define VECT_SPI_CS      5      // Chip Select (beide Kanäle)
   #define VECT_SPI_CLK     18     // SPI Clock (SCK)
   #define VECT_SPI_MOSI    23     // SPI MOSI
+  #define VECT_SPI_LDAC    4      // LDAC: beide Ausgänge gleichzeitig übernehmen
+  #define VECT_BLANK_PIN   17     // Z-Achse: Beam Blanking (digital)
+#else
+  // ESP32 DAC1/DAC2 (feste Pins GPIO25/26) + Digital Z
   #define VECT_BLANK_PIN   17     // Z-Achse: Beam Blanking (digital)
+  #define VECT_DAC_INT_SWAP 0     // 1 = X/Y im Stream tauschen (Kanalreihenfolge I2S)
 #endif
 
 #define VECT_SPI_SPEED   20000000  // 20 MHz SPI clock
 
+// DMA-Ausgabe: I2S0 im Parallel-Modus erzeugt SCK/SDI/CS der DACs,
+// der letzte Frame wird ohne CPU mit fester Punktrate wiederholt
+// (INTERNAL: I2S0 im DAC-Modus, ein Sample pro Punkt)
+// 0 = blockierende Ausgabe pro Punkt (setXY)
+#define VECT_USE_DMA          0
+#define VECT_DMA_POINT_RATE   100000  // Punkte pro Sekunde
+#define VECT_DMA_MAX_POINTS   1024    // Punkte pro DMA-Frame (2 Frames im DMA-RAM)
+#define VECT_DMA_CLK_INVERT   1       // SCK invertieren: SDI stabil vor steigender Flanke
+
+#if VECT_USE_DMA && VECT_DAC_BACKEND == VECT_DAC_MCP4821
+  // DMA-Modus mit 3x MCP4821: eigene SDI-Leitung pro DAC, CS gemeinsam
+  // (VECT_SPI_MOSI = SDI X, CS-Signal geht auf alle drei CS-Pins)
+  #define VECT_SPI_MOSI_Y  19     // SDI Y-Achse
+  #define VECT_SPI_MOSI_Z  21     // SDI Z-Achse
+#endif
+
 // Vector display timing
 #define VECT_POINTS_PER_FRAME  2048   // Max Punkte pro Frame
-#define VECT_REFRESH_HZ        60     // Frame rate
+#define VECT_REFRESH_HZ        60     // Frame rate (Obergrenze mit VECT_GOV_ENABLE)
 #define VECT_DWELL_US          2      // Verweildauer pro Punkt (µs)
 
+// Bildraten-Regler (lib/display_gov): misst die Ausgabezeit pro Frame und
+// senkt bei Bedarf erst das Punktbudget, dann die Verweildauer, dann die
+// Bildrate, bis ein Frame wieder in die Periode passt. 0 = feste Werte
+#define VECT_GOV_ENABLE        1
+#define VECT_REFRESH_MIN_HZ    40     // Untergrenze der Bildrate
+#define VECT_DWELL_MIN_US      1      // Untergrenze der Verweildauer (µs)
+#define VECT_GOV_MIN_POINTS    512    // Untergrenze des Punktbudgets
+#define VECT_GOV_LOAD_PCT      80     // Anteil der Periode für die Ausgabe (Rest: DVG, Status)
+#define VECT_GOV_HOLD_FRAMES   60     // Frames mit Reserve, bevor wieder hochgeregelt wird
+
+// Rasterizer: Linien in Punkte mit konstantem Abstand zerlegen
+// (konstante Strahlgeschwindigkeit = gleichmäßige Helligkeit)
+#define VECT_RASTER_STEP       16     // Punktabstand (DAC-Einheiten, 12-bit)
+#define VECT_RASTER_SETTLE     4      // Dunkelpunkte nach einem Sprung (Einschwingen)
+#define VECT_RASTER_DOT        4      // Punkte für Vektoren der Länge 0 (Schüsse)
+
+// Vektorlisten-Optimierung vor dem Rasterizer: Gruppen nach nächstem
+// Nachbarn sortieren, überflüssige Sprünge entfernen, kollineare
+// Segmente zusammenfassen (unveränderte Frames kommen aus dem Cache)
+#define VECT_OPTIMIZE          1
+#define VECT_OPT_MAX_GROUPS    256    // Max. sortierte Gruppen pro Frame
+
 // ============================================================================
 // AUDIO KONFIGURATION - I2S DAC
 // ============================================================================
@@ -46,6 +99,23 @@
 #define AUDIO_SAMPLE_RATE 22050  // Sample rate (Hz)
 #define AUDIO_BUFFER_SIZE 64     // Samples pro Buffer
 
+// Sound-Latches (0x3600, 0x3A00, 0x3C00-0x3C07, 0x3E00) mit Zeitstempel
+// in eine Queue, ein Task auf Core 1 synthetisiert daraus den Sound
+// 0 = kein Sound, Schreibzugriffe werden ignoriert
+#ifndef ASTEROIDINO_NATIVE
+  #define AUDIO_ENABLE    1
+#else
+  #define AUDIO_ENABLE    0      // Host-Build (env:native): kein I2S
+#endif
+#define AUDIO_DMA_BUFFERS 4      // DMA-Buffer à AUDIO_BUFFER_SIZE Samples
+#define AUDIO_QUEUE_SIZE  256    // Latch-Ereignisse (Zweierpotenz)
+#define AUDIO_LATENCY_MS  16     // Wiedergabe läuft so weit hinter der Emulation
+
+#if AUDIO_ENABLE && VECT_DAC_BACKEND == VECT_DAC_INTERNAL && \
+    (AUDIO_I2S_BCK == 25 || AUDIO_I2S_BCK == 26 || AUDIO_I2S_WS == 25 || AUDIO_I2S_WS == 26)
+  #error "VECT_DAC_INTERNAL belegt GPIO25/26: AUDIO_I2S_BCK/WS auf andere Pins legen"
+#endif
+
 // ============================================================================
 // INPUT KONFIGURATION - GPIO Buttons
 // ============================================================================
@@ -59,16 +129,135 @@
 #define BTN_START_PIN    14   // Start (1 Player)
 #define BTN_COIN_PIN     27   // Coin (Münze)
 
-// Button debounce time (ms)
+// Entprellzeit (ms): ein Timer tastet alle BTN_DEBOUNCE_MS / 4 ab, ein
+// Button wechselt nach vier gleichen Abtastungen in Folge
 #define BTN_DEBOUNCE_MS  20
 
+// Münze nach 2 s und Start nach 4 s automatisch (Aufbau ohne Buttons)
+#ifndef ASTEROIDINO_NATIVE
+#define INPUT_AUTO_START 1
+#else
+#define INPUT_AUTO_START 0   // Host-Build: Eingaben nur aus dem Skript
+#endif
+
 // ============================================================================
 // EMULATION KONFIGURATION
 // ============================================================================
 
-// 6502 CPU @ 1.5 MHz, 60 Hz refresh = 25000 cycles/frame
-// Aber wir brauchen auch Zeit für Display + Audio, also konservativ:
-#define CPU_CYCLES_PER_FRAME  20000
+// 6502 CPU @ 1.512 MHz (12.096 MHz / 8)
+// NMI kommt vom 3 kHz Takt / 12 = 250 Hz (alle 6048 CPU-Zyklen)
+#define CPU_CLOCK_HZ          1512000
+#define CPU_NMI_HZ            250
+#define CPU_CYCLES_PER_NMI    (CPU_CLOCK_HZ / CPU_NMI_HZ)
+
+// Emulation läuft in Zeitscheiben von einer NMI-Periode (4 ms)
+#define CPU_CYCLES_PER_FRAME  CPU_CYCLES_PER_NMI
+
+// Watchdog: ohne Schreibzugriff auf 0x3400 innerhalb dieser Zeit wird
+// die CPU zurückgesetzt (16 NMI-Perioden = 64 ms), 0 = aus
+#define EMU_WATCHDOG_CYCLES   (CPU_CYCLES_PER_NMI * 16)
+
+// 1 = an Echtzeit koppeln (Original-Spielgeschwindigkeit)
+// 0 = so schnell wie möglich (Benchmark)
+// Startwert, zur Laufzeit über die Konsole änderbar ("speed")
+#define EMU_THROTTLE          1
+
+// CPU-Kern: 1 = Switch-Kern (mos6502::RunSwitch, spezialisierte Opcodes)
+//           0 = Tabellen-Kern (mos6502::Run über InstrTable)
+// (per -D überschreibbar, z.B. für Vergleiche im Host-Build)
+#ifndef CPU_USE_SWITCH_CORE
+#define CPU_USE_SWITCH_CORE   1
+#endif
+
+// Switch-Kern mit vordekodiertem Programm-ROM (mos6502::RunPredecoded):
+// Opcode und Operand jedes ROM-Befehls werden beim ersten Ausführen in
+// einen Record (4 Byte pro ROM-Adresse, 24 KB) gelegt, RAM-Code läuft
+// normal. 0 = reiner Switch-Kern
+#ifndef CPU_PREDECODE
+#define CPU_PREDECODE         1
+#endif
+
+// Leerlauf-Schleifen (BMI auf $2002, Warten auf ZP[0x5B]) erkennen und
+// bis zum nächsten Ereignis (NMI, Ende der Zeitscheibe) überspringen
+#define EMU_IDLE_SKIP         1
+
+// Boot aus Savestate (SAVESTATE in main.cpp): liegt SAVESTATE_FILE im
+// LittleFS, startet die Emulation direkt aus diesem Abbild (ohne
+// Selbsttest und RAM-Löschen), sonst wird es beim Kaltstart nach
+// SAVESTATE_BOOT_FRAMES Frames im Attract-Modus angelegt
+// Nach ROM- oder Emulator-Änderungen die Datei löschen
+#define SAVESTATE_BOOT          0
+#define SAVESTATE_FILE          "/boot.state"
+#define SAVESTATE_BOOT_FRAMES   (CPU_NMI_HZ * 5)   // 5 s
+
+// Rewind (lib/rewind): alle REWIND_INTERVAL_FRAMES Frames ein Savestate
+// in einen Ring, jeder REWIND_KEY_INTERVAL-te vollständig, dazwischen
+// Deltas, dazu die Eingaben. Konsole "rewind" zeigt Belegung und
+// Zeitraum und springt zurück; der Host-Build prüft mit --rewind das
+// Nachspielen. Der Ring hält an, wenn der Watchdog die CPU zurücksetzt
+// (REWIND_FREEZE_ON_RESET), damit der Zustand davor erhalten bleibt
+#define REWIND_ENABLE           1
+#define REWIND_INTERVAL_FRAMES  25        // 100 ms
+#define REWIND_KEY_INTERVAL     20        // Key-Frame alle 20 Snapshots (2 s)
+#define REWIND_BYTES            49152     // Interner Heap
+#define REWIND_PSRAM_BYTES      1048576   // PSRAM, falls vorhanden (0 = nie)
+#define REWIND_FREEZE_ON_RESET  1
+
+// Status-Ausgabe der Emulation (µs)
+#define EMU_STATUS_INTERVAL_US  2000000
+
+// DVG-Engine: 1 = dekodierte Befehle (schnell), 0 = PROM-Zustandsautomat
+// (per -D überschreibbar)
+#ifndef DVG_USE_DECODED_ENGINE
+#define DVG_USE_DECODED_ENGINE  1
+#endif
+
+// DVG HALT erst nach der Strahlzeit der Liste melden (IN0 Bit 2),
+// 0 = HALT sofort nach GO
+#define DVG_BUSY_TIMING         1
+
+// Max. PROM-Schritte pro DVG GO (beide Engines); nur gegen Endlos-
+// schleifen, die Highscore-Eingabe braucht mehr als 4096 (native --soak)
+#define DVG_MAX_STEPS           16384
+
+// Dekodierte Engine: JSRL in Vektor-ROM-Unterprogramme (Felsen, Ziffern,
+// Buchstaben) merkt sich die relative Punktliste pro (Adresse, Skala) und
+// spielt sie beim nächsten Aufruf nur verschoben ab. 0 = aus
+#define DVG_MEMO                1
+#define DVG_MEMO_ENTRIES        256    // Einträge (Zweierpotenz)
+#define DVG_MEMO_POINTS         4096   // Punkte aller Einträge zusammen (4 Byte/Punkt)
+#define DVG_MEMO_MAX_POINTS     128    // Längere Unterprogramme laufen ungecacht
+
+// Unveränderte Listen nicht neu dekodieren: der Snapshot hasht den
+// Vektor-RAM blockweise (128 Byte), der DVG merkt sich pro Startadresse
+// (das Spiel wechselt zwischen zwei Listen), welche Blöcke die letzte
+// Liste gelesen hat, und ihre Punkte (2 x 8 KB). Stimmen Startadresse,
+// DVG-Register und alle gelesenen Blöcke überein, wird die Liste
+// übernommen; ist sie gleich der gezeigten, bleiben Raster und DMA-Strom
+// stehen. 0 = jede Liste dekodieren
+#ifndef DVG_FRAME_REUSE
+#define DVG_FRAME_REUSE         1
+#endif
+
+// Differential-Test: bei jedem DVG GO beide Engines laufen lassen
+// und Vektor-Ausgabe + DVG-Zustand vergleichen
+// #define DVG_DIFF_TEST
+
+// ROM-Abbild (romconv/convert_roms.py): Vektor- und Programm-ROM an
+// ihren CPU-Adressen in 32 KB (0x0000-0x7FFF, gespiegelt ab 0x8000)
+// 0 = als Array in der Firmware
+// 1 = per esp_partition_mmap aus der Flash-Partition "roms" (partitions.csv):
+//     esptool.py write_flash 0x290000 romconv/asteroid_rom_image.bin
+#ifndef ASTEROIDINO_NATIVE
+  #define ROM_IMAGE_PARTITION   0
+#else
+  #define ROM_IMAGE_PARTITION   0    // Host-Build (env:native): kein Flash
+#endif
+#define ROM_IMAGE_PARTITION_NAME "roms"
+
+// Die 8 KB ROM-Inhalt beim Start ins interne RAM kopieren (unabhängig
+// vom Flash-Cache), 0 = direkt aus dem Abbild lesen
+#define ROM_HOT_DRAM          1
 
 // Memory map (vereinfacht)
 #define MEM_SIZE_RAM     0x1000   // 4 KB RAM (0x0000-0x0FFF)
@@ -85,14 +274,95 @@
 // #define DEBUG_CPU        // 6502 Instructions loggen (LANGSAM!)
 // #define DEBUG_AUDIO      // Audio-Buffer-Status
 
-// Vector Logger aktivieren (loggt X/Y/Z in Datei)
+// Binär-Trace (lib/trace): Bitmaske der Kategorien, 0 = komplett aus
+// 0x01 CPU  (jeder Befehl; erzwingt den Tabellen-Kern)
+// 0x02 ZP   (Schreibzugriffe auf TRACE_ZP_ADDR)
+// 0x04 VRAM (Vector-RAM-Schreibzugriffe laufen dann über den Callback)
+// 0x08 DVG  (GO, PROM-Schritte, Vektoren, Listenende)
+// 0x10 IO   (I/O-Ports lesen/schreiben)
+#define TRACE_CATEGORIES   0
+#define TRACE_ZP_ADDR      0x5B   // Beobachtete Zero-Page-Zelle
+#define TRACE_RING_SIZE    512    // Records pro Core (Zweierpotenz, 12 Byte/Record)
+#define TRACE_DRAIN_BATCH  32     // Records pro Durchlauf des Trace-Tasks
+
+// Profiler (lib/profiler): CCOUNT-Takte pro Frame für CPU, Bus-Callbacks,
+// Leerlauf, DVG und Vektorausgabe, als min/avg/p99/max mit Zählern für
+// Überschreitungen des Frame-Budgets; Ausgabe mit dem Raster-Report über
+// Serial (und als Text-Datagramm, wenn der Vector Logger LOG_UDP sendet)
+#define PROFILE_ENABLE     0
+#define PROFILE_WINDOW_MS  2000   // Frames pro Auswertung (emulierte Zeit)
+
+// Vector Logger aktivieren (loggt jeden angezeigten Frame, 60 Hz)
 // #define ENABLE_VECTOR_LOGGER
 // #define VECTOR_LOG_FILE "/vectors.csv"  // oder .bin, .txt
-// #define VECTOR_LOG_MODE LOG_CSV         // LOG_CSV, LOG_BINARY, LOG_TEXT
+// #define VECTOR_LOG_MODE LOG_UDP         // LOG_UDP, LOG_CSV, LOG_BINARY, LOG_TEXT
+
+// LOG_BINARY: Frame-Records mit Frame-Nummer, CPU-Takt und Punktzahl plus
+// Index (lib/vector_logger/vcap_format.h), über Serial mitschneiden und mit
+// tools/vcap_tool auswerten oder für VECTOR_REPLAY auf SD-Karte kopieren
+#define VECTOR_LOG_INDEX        64      // Frames pro Index-Record
+
+// LOG_UDP: ganze Frames (gepackte 32-Bit-Punkte, Delta zum Vorframe) per
+// WLAN an tools/vector_capture.py, gesendet von einem Task auf Core 1
+// Hinweis: der WLAN-Stack selbst läuft auf Core 0 neben der Emulation
+#ifndef ASTEROIDINO_NATIVE
+  #define VECTOR_LOG_UDP      1
+#else
+  #define VECTOR_LOG_UDP      0      // Host-Build (env:native): kein WLAN
+#endif
+#define VECTOR_LOG_WIFI_SSID    "asteroidino"
+#define VECTOR_LOG_WIFI_PASS    ""
+#define VECTOR_LOG_UDP_HOST     "192.168.1.100"   // Rechner mit vector_capture.py
+#define VECTOR_LOG_UDP_PORT     5005
+#define VECTOR_LOG_KEYFRAME     30      // Vollbild alle N Frames (Paketverlust)
+#define VECTOR_LOG_UDP_BUFFER   16384   // Sendepuffer (Bytes), voll = Frame fällt aus
+
+// Replay (lib/vector_logger/vector_replay): statt der Emulation eine
+// Aufnahme (.vci, LOG_BINARY oder vcap_tool) von SD-Karte im Takt der
+// Aufnahme auf den DAC geben, zum Testen von Oszilloskop und Monitor
+// ohne CPU. Raster, Regler und DAC laufen wie im Spiel.
+// SD-Karte an HSPI; SCK/CS liegen auf BTN_START/BTN_FIRE (14/15), die
+// Tasten bleiben beim Replay aus. GPIO12 ist Strapping-Pin: der Pull-up
+// der Karte darf beim Booten nicht durchkommen (oder MISO umlegen)
+#define VECTOR_REPLAY           0
+#define VECTOR_REPLAY_FILE      "/capture.vci"
+#define VECTOR_REPLAY_LOOP      1       // Am Ende von vorn beginnen
+#define VECTOR_REPLAY_SD_SCK    14
+#define VECTOR_REPLAY_SD_MISO   12
+#define VECTOR_REPLAY_SD_MOSI   13
+#define VECTOR_REPLAY_SD_CS     15
+#ifdef ASTEROIDINO_NATIVE
+  #undef VECTOR_REPLAY
+  #define VECTOR_REPLAY         0       // Host-Build: keine SD-Karte
+#endif
 
 // Test-Modi
 // #define RUN_VECTOR_LOGGER_TEST  // Führt vector_logger Tests aus
 
+// Golden-Frame-Regression (REGRESSION in main.cpp): ab Reset
+// REGRESS_FRAMES NMI-Perioden mit festem Eingabe-Skript abspielen und
+// mit test/golden/regress.inc vergleichen; auf dem Target statt des
+// Spiels, im Host-Build über "program --golden"
+// #define RUN_REGRESSION_TEST
+#define REGRESS_FRAMES      7500   // 30 s emulierte Zeit
+#define REGRESS_CHECKPOINT  250    // Vergleich jede Sekunde
+
+// Konsole (lib/console): Befehle zeilenweise über Serial, mit CONSOLE_UDP
+// auch per UDP (WLAN wie VECTOR_LOG_WIFI_*, Antwort an den Absender).
+// Eine Task auf Core 1 liest ohne zu blockieren; Befehle setzen nur
+// Werte, die Emulation und Anzeige an Frame-Grenzen übernehmen
+// (Tempo, Bildrate, Punktbudget, Verweildauer, Trace-Kategorien,
+// Status-Ausgaben). "help" listet alle Befehle
+#define CONSOLE_ENABLE     1
+#define CONSOLE_POLL_MS    20     // Abfrageintervall
+#define CONSOLE_LINE_MAX   96     // Max. Zeichen pro Befehlszeile
+#ifndef ASTEROIDINO_NATIVE
+  #define CONSOLE_UDP      0      // 1 = zusätzlich UDP
+#else
+  #define CONSOLE_UDP      0      // Host-Build (env:native): kein WLAN
+#endif
+#define CONSOLE_UDP_PORT   5006
+
 // Serial baud rate
 #define SERIAL_BAUD      115200
 
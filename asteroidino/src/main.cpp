@@ -14,7 +14,33 @@
 #include "config.h"
 #include <cpu6502.h>
 #include <vector_dac.h>
+#include <vector_raster.h>
+#include <vector_opt.h>
+#include <display_gov.h>
+#include <console.h>
+#include <rewind.h>
+#include <trace.h>
+#include <profiler.h>
+#include <sound.h>
+#ifdef ENABLE_VECTOR_LOGGER
+#include <vector_logger.h>
+#endif
+#if VECTOR_REPLAY
+#include <SD.h>
+#include <vector_replay.h>
+#endif
 #include <esp_task_wdt.h>  // For watchdog timer control
+#include <atomic>
+#if ROM_IMAGE_PARTITION
+#include <esp_partition.h>
+#endif
+#if SAVESTATE_BOOT && !defined(ASTEROIDINO_NATIVE)
+#include <LittleFS.h>
+#endif
+#ifndef ASTEROIDINO_NATIVE
+#include <esp_timer.h>
+#include <soc/gpio_reg.h>
+#endif
 
 // ROMs konvertiert - inkludiere sie
 #define ASTEROID_ROMS_CONVERTED
@@ -27,22 +53,44 @@
 
 mos6502* cpu = nullptr;
 VectorDAC vector_dac;
+VectorRaster vector_raster;
+VectorOptimizer vector_opt;
+DisplayGovernor display_gov;
 
 // Memory
 uint8_t ram[MEM_SIZE_RAM];          // 0x0000-0x0FFF
-uint8_t vector_ram[MEM_SIZE_VECTOR]; // 0x4000-0x47FF
+alignas(4) uint8_t vector_ram[MEM_SIZE_VECTOR]; // 0x4000-0x47FF (snapshots copy words)
+const uint8_t* dvg_vram = vector_ram;  // Vector RAM as seen by the DVG (snapshot)
 // ROMs werden aus den inkludierten Arrays geladen
 
 // Vector display state
-struct {
-    uint16_t points[VECT_POINTS_PER_FRAME][2];  // X, Y pairs
-    uint8_t  intensity[VECT_POINTS_PER_FRAME];  // Brightness
+struct vector_list {
+    uint32_t points[VECT_POINTS_PER_FRAME];  // Packed X/Y/Z (vector_point.h)
     int      count;
-} vector_buffer;
+    uint32_t cycle;                          // Master cycle of the GO that drew it
+};
+
+// Both lists are owned by core 1: the DVG decodes into the back list,
+// render_vectors() draws the front list, and loop() flips them at a
+// frame boundary once a new back list is complete
+vector_list vector_lists[2];
+vector_list* vector_back = &vector_lists[0];
+vector_list* vector_front = &vector_lists[1];
+bool vector_back_ready = false;
+bool vector_front_dirty = false;   // Front list not yet rasterized
+bool raster_stale = false;         // Raster frame needs rebuilding (new list or budget)
+bool raster_dirty = false;         // Raster frame not yet handed to the DMA engine
+
+// Vector output runs through the DMA stream (VECT_USE_DMA and setup ok)
+bool vector_dma = false;
 
 // DVG frame counter for debugging
 int dvg_frame_count = 0;
 
+// Invariants the DVG must never break (checked by native --soak)
+uint32_t dvg_overflows = 0;  // Vectors dropped on a full back list
+uint32_t dvg_overruns = 0;   // Lists cut off at DVG_MAX_STEPS before HALT
+
 // DVG state machine (MAME-style with PROM)
 struct {
     uint16_t pc;           // Program counter in vector RAM
@@ -58,18 +106,40 @@ struct {
     uint8_t  stack_ptr;    // Stack pointer
     bool     halt;         // Halt flag
     bool     running;      // DVG is processing
+    uint32_t cycles;       // Beam time of the current list (CPU cycles)
 } dvg_state;
 
+// Vector RAM in blocks of DVG_BLOCK_WORDS words: the snapshot hashes each
+// block and the decoder notes which blocks a list read (DVG PIPELINE)
+#define DVG_BLOCK_WORDS 64
+#define DVG_BLOCKS      (MEM_SIZE_VECTOR / (2 * DVG_BLOCK_WORDS))
+
+uint32_t dvg_reuse_hits = 0, dvg_reuse_misses = 0;  // Lists reused / decoded
+
+#if DVG_FRAME_REUSE && !(TRACE_CATEGORIES & TRACE_DVG)
+#define DVG_REUSE_ACTIVE 1
+static uint32_t dvg_read_blocks = 0;  // Blocks read by the list being decoded
+#define DVG_MARK_READ(addr) (dvg_read_blocks |= 1u << ((addr) / DVG_BLOCK_WORDS))
+#else
+#define DVG_REUSE_ACTIVE 0
+#define DVG_MARK_READ(addr) ((void)0)
+#endif
+
 // Input state
-struct {
-    bool rotate_left;
-    bool rotate_right;
-    bool thrust;
-    bool hyperspace;
-    bool fire;
-    bool start;
-    bool coin;
-} buttons;
+// Buttons (bit mask, 1 = pressed), in the order of input_buttons[]
+enum : uint8_t {
+    INPUT_LEFT   = 0x01,
+    INPUT_RIGHT  = 0x02,
+    INPUT_THRUST = 0x04,
+    INPUT_HYPER  = 0x08,
+    INPUT_FIRE   = 0x10,
+    INPUT_START  = 0x20,
+    INPUT_COIN   = 0x40,
+};
+
+// Port bytes as the CPU reads them, published by input_publish():
+// IN0 button bits | IN1 << 8 | DSW1 << 16
+std::atomic<uint32_t> input_ports(0);
 
 // DIP switch settings (DSW1) - MAME default Asteroids settings
 // Bit 0-1: Language (00=English, 01=German, 10=French, 11=Spanish)
@@ -80,7 +150,7 @@ struct {
 // MAME default: 0x84 = 10000100 (English, 3 ships, 1C/1C)
 uint8_t dip_switches = 0x84;  // CORRECTED: English=00, Lives=3, Coinage=1C/1C
 
-// 3 kHz clock signal (bit 1 of IN0) - toggled by CPU cycle count
+// 3 kHz clock signal (bit 1 of IN0) - bit 8 of the master cycle count
 bool clock_3khz = false;
 
 // Task handles for dual-core
@@ -90,9 +160,84 @@ TaskHandle_t emulation_task_handle;
 volatile bool irq_pending = false;
 unsigned long last_irq_time = 0;
 
-// Total CPU cycle counter for clock signal generation
+// Master cycle count (CPU cycles at 1.512 MHz), see SCHEDULER
 uint64_t total_cpu_cycles = 0;
 
+// Machine state came from the boot image (see SAVESTATE)
+bool savestate_booted = false;
+
+// ============================================================================
+// ROM IMAGE
+// ============================================================================
+
+/*
+ * Vector and program ROM sit at their CPU addresses in one 32KB image of
+ * 0x0000-0x7FFF (romconv/convert_roms.py). The board does not decode
+ * A15, so 0x8000-0xFFFF mirrors it and the reset vectors at 0xFFFC come
+ * from PROM2. The image is compiled into the firmware, or with
+ * ROM_IMAGE_PARTITION memory-mapped from the "roms" flash partition.
+ * ROM_HOT_DRAM copies the 8KB of ROM contents into internal RAM at boot,
+ * so neither opcode fetches on core 0 nor vector ROM reads on core 1
+ * depend on the flash cache.
+ */
+
+#define ROM_VECTOR_BASE   0x5000
+#define ROM_VECTOR_SIZE   0x0800
+#define ROM_PROGRAM_BASE  0x6800
+#define ROM_PROGRAM_SIZE  0x1800
+
+const uint8_t* rom_image = nullptr;    // CPU 0x0000-0x7FFF
+const uint8_t* rom_vector = nullptr;   // CPU 0x5000-0x57FF (image or DRAM copy)
+const uint8_t* rom_program = nullptr;  // CPU 0x6800-0x7FFF (image or DRAM copy)
+
+#if ROM_HOT_DRAM
+static uint8_t rom_dram[ROM_VECTOR_SIZE + ROM_PROGRAM_SIZE];
+#endif
+
+// Locate the image and set up the ROM pointers (before the CPU starts)
+bool rom_image_init() {
+#if ROM_IMAGE_PARTITION
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ROM_IMAGE_PARTITION_NAME);
+    if (!part || part->size < ROM_IMAGE_SIZE) {
+        Serial.printf("*** ROM partition '%s' missing (see partitions.csv)\n", ROM_IMAGE_PARTITION_NAME);
+        return false;
+    }
+    const void* map;
+    spi_flash_mmap_handle_t handle;  // Mapped for the lifetime of the firmware
+    if (esp_partition_mmap(part, 0, ROM_IMAGE_SIZE, SPI_FLASH_MMAP_DATA, &map, &handle) != ESP_OK) {
+        Serial.println("*** ROM partition could not be mapped");
+        return false;
+    }
+    rom_image = (const uint8_t*)map;
+#else
+    rom_image = asteroid_rom_image;
+#endif
+    
+    if (memcmp(rom_image, ROM_IMAGE_MAGIC, strlen(ROM_IMAGE_MAGIC)) != 0) {
+        Serial.println("*** No ROM image found (flash romconv/asteroid_rom_image.bin)");
+        return false;
+    }
+    
+    rom_vector = rom_image + ROM_VECTOR_BASE;
+    rom_program = rom_image + ROM_PROGRAM_BASE;
+#if ROM_HOT_DRAM
+    memcpy(rom_dram, rom_vector, ROM_VECTOR_SIZE);
+    memcpy(rom_dram + ROM_VECTOR_SIZE, rom_program, ROM_PROGRAM_SIZE);
+    rom_vector = rom_dram;
+    rom_program = rom_dram + ROM_VECTOR_SIZE;
+#endif
+    return true;
+}
+
+// ROM byte for a CPU address, nullptr outside ROM
+const uint8_t* rom_ptr(uint16_t addr) {
+    uint16_t a = addr & 0x7FFF;
+    if (a >= ROM_PROGRAM_BASE) return rom_program + (a - ROM_PROGRAM_BASE);
+    if (a >= ROM_VECTOR_BASE && a < ROM_VECTOR_BASE + ROM_VECTOR_SIZE) return rom_vector + (a - ROM_VECTOR_BASE);
+    return nullptr;
+}
+
 // ============================================================================
 // DVG (DIGITAL VECTOR GENERATOR) STATE MACHINE
 // ============================================================================
@@ -129,23 +274,16 @@ uint64_t total_cpu_cycles = 0;
  */
 
 void dvg_add_vector(int16_t dx, int16_t dy, uint8_t intensity) {
-    // Debug logging (first 20 calls)
-    static int debug_calls = 0;
-    if (debug_calls < 20) {
-        Serial.printf("DVG_ADD_VECTOR[%d]: dx=%d, dy=%d, I=%d, state.x=%d, state.y=%d\n",
-            debug_calls++, dx, dy, intensity, dvg_state.x, dvg_state.y);
-    }
-    
-    if (vector_buffer.count >= VECT_POINTS_PER_FRAME) {
+    if (vector_back->count >= VECT_POINTS_PER_FRAME) {
+        dvg_overflows++;
         return;  // Buffer full
     }
     
     // Add starting point if this is the first vector
-    if (vector_buffer.count == 0) {
-        vector_buffer.points[0][0] = dvg_state.x;
-        vector_buffer.points[0][1] = dvg_state.y;
-        vector_buffer.intensity[0] = 0;  // Starting point has no intensity
-        vector_buffer.count = 1;
+    if (vector_back->count == 0) {
+        // Starting point has no intensity
+        vector_back->points[0] = vpoint_pack(dvg_state.x, dvg_state.y, 0);
+        vector_back->count = 1;
     }
     
     // Update position
@@ -159,40 +297,43 @@ void dvg_add_vector(int16_t dx, int16_t dy, uint8_t intensity) {
     if (dvg_state.y > 1023) dvg_state.y = 1023;
     
     // Add endpoint
-    vector_buffer.points[vector_buffer.count][0] = dvg_state.x;
-    vector_buffer.points[vector_buffer.count][1] = dvg_state.y;
-    vector_buffer.intensity[vector_buffer.count] = intensity;
-    vector_buffer.count++;
-    
-    // CSV logging of DVG vector output (first 5000 vectors)
-    static int vec_log_count = 0;
-    static bool vec_csv_header = false;
-    
-    if (vec_log_count < 5000) {
-        if (!vec_csv_header) {
-            Serial.println("\n=== DVG VECTOR OUTPUT (10-bit coords, 4-bit intensity) ===");
-            Serial.println("X,Y,Intensity");
-            vec_csv_header = true;
-        }
-        
-        Serial.printf("%d,%d,%d\n", dvg_state.x, dvg_state.y, intensity);
-        vec_log_count++;
-    }
+    vector_back->points[vector_back->count++] = vpoint_pack(dvg_state.x, dvg_state.y, intensity);
+    
+    TRACE(TRACE_DVG, TRACE_EV_DVG_VECTOR, dvg_state.pc, dvg_state.x,
+          (intensity << 12) | dvg_state.y);
 }
 
-void dvg_process_vector() {
-    // VCTR: Draw vector
-    // Scale determines step size: 2^(scale+1) steps
-    int scale_val = (2 << dvg_state.scale) & 0x7ff;
-    
-    // Convert 12-bit signed values to actual deltas
-    int16_t dx = (dvg_state.dvx & 0x400) ? (dvg_state.dvx | 0xF800) : (dvg_state.dvx & 0x3FF);
-    int16_t dy = (dvg_state.dvy & 0x400) ? (dvg_state.dvy | 0xF800) : (dvg_state.dvy & 0x3FF);
+// VCTR/SVEC: beam deltas of the latched vector
+// The vector timer runs for 2^(scale+1) steps; VCTR adds its opcode
+// to the global scale, SVEC the scale bits latched into dvx/dvy
+static inline void dvg_vector_delta(int16_t& dx, int16_t& dy) {
+    int scale;
+    if (dvg_state.op == 0xf) {
+        scale = (dvg_state.scale +
+                 (((dvg_state.dvy & 0x800) >> 11) |
+                  (((dvg_state.dvx & 0x800) ^ 0x800) >> 10) |
+                  ((dvg_state.dvx & 0x800) >> 9))) & 0xf;
+        dvg_state.dvx &= 0xf00;
+        dvg_state.dvy &= 0xf00;
+    } else {
+        scale = (dvg_state.scale + dvg_state.op) & 0xf;
+    }
+    int scale_val = (2 << scale) & 0x7ff;
     
-    // Scale the deltas
-    dx = (dx * scale_val) >> 8;
-    dy = (dy * scale_val) >> 8;
+    // The rate multipliers step the beam round(|d| * steps / 1024) times
+    dx = ((dvg_state.dvx & 0x3FF) * scale_val + 512) >> 10;
+    dy = ((dvg_state.dvy & 0x3FF) * scale_val + 512) >> 10;
+    if (dvg_state.dvx & 0x400) dx = -dx;
+    if (dvg_state.dvy & 0x400) dy = -dy;
     
+    // The vector timer runs at the DVG clock (12.096 MHz / 8, same as
+    // the CPU)
+    dvg_state.cycles += scale_val;
+}
+
+void dvg_process_vector() {
+    int16_t dx, dy;
+    dvg_vector_delta(dx, dy);
     dvg_add_vector(dx, dy, dvg_state.intensity);
 }
 
@@ -202,8 +343,8 @@ uint8_t dvg_state_addr() {
     // If OP3 is set, add opcode bits
     uint8_t addr = ((((dvg_state.state_latch >> 4) ^ 1) & 1) << 7) | (dvg_state.state_latch & 0x0f);
     
-    // ST3 check: bit 3 of state_latch
-    if (dvg_state.state_latch & 0x08) {
+    // OP3 check: bit 3 of the opcode (ops 0-7 are all VCTR)
+    if (dvg_state.op & 0x08) {
         addr |= ((dvg_state.op & 7) << 4);
     }
     
@@ -219,15 +360,16 @@ void dvg_update_databus() {
     if (dvg_addr < 0x400) {
         // Read from Vector RAM
         if (byte_addr < 2048) {
-            dvg_state.data = vector_ram[byte_addr];
+            DVG_MARK_READ(dvg_addr);
+            dvg_state.data = dvg_vram[byte_addr];
         } else {
             dvg_state.data = 0x00;
         }
-    } else if (dvg_addr < 0x800) {
-        // Read from Vector ROM
-        uint16_t rom_offset = (dvg_addr - 0x400) * 2 + (dvg_state.state_latch & 1);
+    } else if (dvg_addr >= 0x800 && dvg_addr < 0xC00) {
+        // Read from Vector ROM (CPU 0x5000 = DVG word 0x800)
+        uint16_t rom_offset = (dvg_addr - 0x800) * 2 + (dvg_state.state_latch & 1);
         if (rom_offset < 2048) {
-            dvg_state.data = pgm_read_byte(&asteroid_rom_vector[rom_offset]);
+            dvg_state.data = rom_vector[rom_offset];
         } else {
             dvg_state.data = 0x00;
         }
@@ -265,15 +407,16 @@ int dvg_handler_2() {
     return 0;
 }
 
-// DVG Handler 3: HALTSTROBE (halt if OP0 clear)
+// DVG Handler 3: HALTSTROBE (HALT if OP0 set, LABS if clear)
 int dvg_handler_3() {
     uint8_t op0 = dvg_state.op & 1;
-    dvg_state.halt = !op0;
+    dvg_state.halt = op0;
     
     if (!op0) {
         dvg_state.xpos = dvg_state.dvx & 0xfff;
         dvg_state.ypos = dvg_state.dvy & 0xfff;
-        dvg_add_vector(0, 0, 0);  // Draw to final position
+        // Blank move to the absolute position
+        dvg_add_vector(dvg_state.xpos - dvg_state.x, dvg_state.ypos - dvg_state.y, 0);
     }
     return 0;
 }
@@ -281,7 +424,11 @@ int dvg_handler_3() {
 // DVG Handler 4: LATCH0 (latch low byte)
 int dvg_handler_4() {
     dvg_state.dvy &= 0xf00;
-    if (dvg_state.op != 0xf) {
+    if (dvg_state.op == 0xf) {
+        // SVEC: the low byte latches like LATCH3 (high X, intensity)
+        dvg_state.dvx = (dvg_state.dvx & 0xff) | ((dvg_state.data & 0xf) << 8);
+        dvg_state.intensity = dvg_state.data >> 4;
+    } else {
         dvg_state.dvy = (dvg_state.dvy & 0xf00) | dvg_state.data;
     }
     dvg_state.pc++;
@@ -324,58 +471,31 @@ int dvg_handler_7() {
     return 0;
 }
 
-void dvg_run_state_machine() {
-    if (!dvg_state.running) return;
-    
-    static int debug_count = 0;
-    static int last_frame_debugged = -1;
-    extern int dvg_frame_count;
-    
-    if (dvg_frame_count != last_frame_debugged) {
-        debug_count = 0;
-        last_frame_debugged = dvg_frame_count;
-    }
-    
-    bool debug = (dvg_frame_count >= 7 && dvg_frame_count <= 100 && debug_count < 50);
-    
-    if (dvg_frame_count >= 7 && dvg_frame_count <= 100 && debug_count == 0) {
-        Serial.printf("\n=== DVG PROM-BASED STATE MACHINE: Frame %d ===\n", dvg_frame_count);
-    }
-    
+// Reference engine: steps the 034602 PROM one micro-state at a time
+void dvg_run_prom() {
     dvg_state.halt = false;
-    int max_iterations = 1000;
+    int max_iterations = DVG_MAX_STEPS;
     int cycles = 0;
     
-    if (debug) {
-        Serial.printf("DVG State Machine Start: PC=0x%03X, state_latch=0x%02X\n",
-            dvg_state.pc, dvg_state.state_latch);
-    }
-    
     while (!dvg_state.halt && max_iterations-- > 0 && cycles < 10000) {
         // PROM-based state machine (MAME-style)
         // Calculate PROM address
         uint8_t prom_addr = dvg_state_addr();
         uint8_t prom_data = dvg_prom_read(prom_addr);
         
-        // Get next state from PROM (034602-01.c8)
-        uint8_t old_latch = dvg_state.state_latch;
-        dvg_state.state_latch = (dvg_state.state_latch & 0x10) | (prom_data & 0x0f);
-        
-        if (debug && cycles < 20) {
-            Serial.printf("  [%d] PROM[0x%02X]=0x%X → latch:0x%02X→0x%02X ST3=%d\n",
-                cycles, prom_addr, prom_data, old_latch, dvg_state.state_latch,
-                (dvg_state.state_latch & 0x08) ? 1 : 0);
-        }
+        // Get next state from PROM (034602-01.c8); traced as old << 8 | new
+        uint8_t next_latch = (dvg_state.state_latch & 0x10) | (prom_data & 0x0f);
+        TRACE(TRACE_DVG, TRACE_EV_DVG_PROM, dvg_state.pc, prom_addr,
+              (dvg_state.state_latch << 8) | next_latch);
+        dvg_state.state_latch = next_latch;
         
         // ST3 check: if bit 3 is set, update databus and execute handler
         if (dvg_state.state_latch & 0x08) {
             dvg_update_databus();
             
             uint8_t handler = dvg_state.state_latch & 0x07;
-            if (debug && debug_count < 50) {
-                Serial.printf("  Handler %d: PC:%03X Op:%X Data:%02X\n", 
-                    handler, dvg_state.pc, dvg_state.op, dvg_state.data);
-            }
+            TRACE(TRACE_DVG, TRACE_EV_DVG_HANDLER, dvg_state.pc, handler,
+                  (dvg_state.op << 8) | (dvg_state.data & 0xff));
             
             // Decode state and call appropriate handler
             switch (handler) {
@@ -388,279 +508,1397 @@ void dvg_run_state_machine() {
                 case 6: cycles += dvg_handler_6(); break;  // LATCH2
                 case 7: cycles += dvg_handler_7(); break;  // LATCH3
             }
-            
-            if (debug && debug_count < 50) {
-                debug_count++;
-            }
         }
         
         cycles++;
     }  // end while
     
-    if (debug_count < 10) debug_count++;
-    
-    dvg_state.running = false;
-    
-    // CSV output for first 5000 DVG runs (10-bit DVG coordinates)
-    static int csv_count = 0;
-    static bool csv_header = false;
-    
-    if (csv_count < 5000) {
-        if (!csv_header) {
-            Serial.println("\n=== DVG VECTOR OUTPUT (10-bit coords 0-1023, 4-bit intensity 0-15) ===");
-            Serial.println("X,Y,Intensity");
-            csv_header = true;
-        }
-        
-        // Output all vectors - convert from 12-bit DAC (0-4095) back to 10-bit DVG (0-1023)
-        for (int i = 0; i < vector_buffer.count; i++) {
-            int dvg_x = (vector_buffer.points[i][0] * 1023) / 4095;
-            int dvg_y = (vector_buffer.points[i][1] * 1023) / 4095;
-            int intensity = (vector_buffer.intensity[i] * 15) / 255;
-            
-            Serial.printf("%d,%d,%d\n", dvg_x, dvg_y, intensity);
-        }
-        csv_count++;
+    // One DVG clock per PROM step on top of the vector timer
+    dvg_state.cycles += cycles;
+}
+
+// ----------------------------------------------------------------------------
+// Decoded DVG engine
+// ----------------------------------------------------------------------------
+//
+// Executes whole vector instructions instead of PROM micro-states. The
+// handler sequence each opcode takes through the PROM is fixed (PROM
+// address = state | (op & 7) << 4 if OP3, ops 0-7 share one sequence),
+// so it is resolved here once:
+//
+//   op 0-9  VCTR   LATCH0 LATCH3 LATCH2 GOSTROBE  -  -        (7 steps)
+//   op A    LABS   LATCH0 LATCH3 LATCH2 HALTSTROBE            (5 steps)
+//   op B    HALT   LATCH0 DMAPUSH HALTSTROBE -> halt          (3 steps)
+//   op C    JSRL   LATCH0 DMAPUSH DMALD                       (4 steps)
+//   op D    RTSL   LATCH0 DMALD (pop)                         (3 steps)
+//   op E    JMPL   LATCH0 DMALD (jump)                        (3 steps)
+//   op F    SVEC   LATCH0 GOSTROBE  -  -                      (5 steps)
+//
+// Every sequence except the halting one ends with LATCH1 of the next word,
+// which is counted in the step cost above. The PROM engine stops after
+// DVG_MAX_STEPS micro-states, so when the budget runs out inside an
+// instruction the remaining steps are replayed through the PROM handlers
+// to stay bit-exact with it.
+
+// Handler per PROM step of each opcode, -1 = state without ST3
+static const int8_t dvg_op_micro[16][7] = {
+    { 4, 7, 6, 2, -1, -1, 5 }, { 4, 7, 6, 2, -1, -1, 5 },
+    { 4, 7, 6, 2, -1, -1, 5 }, { 4, 7, 6, 2, -1, -1, 5 },
+    { 4, 7, 6, 2, -1, -1, 5 }, { 4, 7, 6, 2, -1, -1, 5 },
+    { 4, 7, 6, 2, -1, -1, 5 }, { 4, 7, 6, 2, -1, -1, 5 },
+    { 4, 7, 6, 2, -1, -1, 5 }, { 4, 7, 6, 2, -1, -1, 5 },
+    { 4, 7, 6, 3, 5 },         { 4, 0, 3 },
+    { 4, 0, 1, 5 },            { 4, 1, 5 },
+    { 4, 1, 5 },               { 4, 2, -1, -1, 5 },
+};
+static const uint8_t dvg_op_steps[16] = {
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 3, 4, 3, 3, 5
+};
+
+// Byte of vector word 'addr' on the DVG data bus (odd = high byte)
+static inline uint8_t dvg_bus_byte(uint16_t addr, uint8_t odd) {
+    if (addr < 0x400) {
+        DVG_MARK_READ(addr);
+        return dvg_vram[(addr << 1) + odd];
     }
-    
-    // Show summary (first 10 only to reduce spam)
-    static int summary_count = 0;
-    if (summary_count++ < 10) {
-        Serial.printf("*** DVG finished: vectors=%d, halt=%d, PC=0x%04X\n", 
-                     vector_buffer.count, dvg_state.halt, dvg_state.pc);
+    if (addr >= 0x800 && addr < 0xC00) return rom_vector[((addr - 0x800) << 1) + odd];
+    return 0x00;
+}
+
+// LATCH1: opcode and high Y bits of the word at pc
+static inline void dvg_latch_op() {
+    uint8_t hi = dvg_bus_byte(dvg_state.pc, 1);
+    dvg_state.dvy = (dvg_state.dvy & 0xff) | ((hi & 0xf) << 8);
+    dvg_state.op = hi >> 4;
+    if (dvg_state.op == 0xf) {
+        dvg_state.dvx &= 0xf00;
+        dvg_state.dvy &= 0xf00;
     }
-}// ============================================================================
-// MEMORY ACCESS (called by CPU emulator)
-// ============================================================================
+}
 
-uint8_t cpu6502_read_callback(uint16_t addr) {
-    // RAM: 0x0000-0x0FFF
-    if (addr < 0x1000) {
-        // DEBUG: Track Zero Page 0x5B (used by bit-shift loop at PC 0x6811)
-        static int zp5b_read_count = 0;
-        if (addr == 0x5B && zp5b_read_count < 30) {
-            Serial.printf("*** ZP[0x5B] READ #%d: value=0x%02X, PC=0x%04X\n",
-                         ++zp5b_read_count, ram[0x5B], cpu->GetPC());
+// Replay the first 'steps' PROM micro-states of the current opcode
+static void dvg_run_micro_steps(int steps) {
+    const int8_t* seq = dvg_op_micro[dvg_state.op];
+    for (int i = 0; i < steps && !dvg_state.halt; i++) {
+        if (seq[i] < 0) continue;
+        dvg_state.state_latch = 0x08 | seq[i];
+        dvg_update_databus();
+        switch (seq[i]) {
+            case 0: dvg_handler_0(); break;
+            case 1: dvg_handler_1(); break;
+            case 2: dvg_handler_2(); break;
+            case 3: dvg_handler_3(); break;
+            case 4: dvg_handler_4(); break;
+            case 5: dvg_handler_5(); break;
+            case 6: dvg_handler_6(); break;
+            case 7: dvg_handler_7(); break;
         }
-        return ram[addr];
     }
-    
-    // Vector RAM: 0x4000-0x47FF
-    if (addr >= 0x4000 && addr < 0x4800) {
-        return vector_ram[addr - 0x4000];
+}
+
+// ----------------------------------------------------------------------------
+// Subroutine memoization (decoded engine)
+// ----------------------------------------------------------------------------
+//
+// Rocks, the ship's lives, digits and letters are JSRL calls into leaf
+// subroutines of the vector ROM. Their output depends only on the ROM
+// words and the global scale at entry: every VCTR and SVEC latches its
+// own deltas and intensity, so the entry intensity does not matter. The
+// first call per (address, scale) runs normally and records the points
+// relative to the entry position, the step and cycle cost and the DVG
+// registers after the RTSL. Later calls copy the points with the entry
+// position added, as long as nothing would be clipped or cut by the
+// list limit; otherwise the subroutine runs normally. Subroutines that
+// call, jump, halt or load a position are marked uncacheable.
+
+uint32_t dvg_memo_hits = 0, dvg_memo_misses = 0;  // Replayed / recorded calls
+
+#if DVG_MEMO && !(TRACE_CATEGORIES & TRACE_DVG)
+
+static_assert((DVG_MEMO_ENTRIES & (DVG_MEMO_ENTRIES - 1)) == 0,
+              "DVG_MEMO_ENTRIES must be a power of two");
+
+enum : uint8_t { DVG_MEMO_EMPTY, DVG_MEMO_VALID, DVG_MEMO_UNCACHEABLE };
+
+struct dvg_memo_entry {
+    uint16_t addr;                  // Subroutine word address (ROM)
+    uint8_t  scale;
+    uint8_t  state;
+    uint16_t first, count;          // Points in dvg_memo_points
+    uint16_t steps;                 // PROM steps including the RTSL
+    uint32_t cycles;                // Vector timer cycles
+    int16_t  min_x, max_x;          // Extent relative to the entry position
+    int16_t  min_y, max_y;
+    int16_t  end_x, end_y;          // Beam offset after the RTSL
+    uint16_t dvx, dvy;              // Registers after the RTSL
+    uint8_t  intensity;
+};
+
+static dvg_memo_entry dvg_memo_entries[DVG_MEMO_ENTRIES];
+static int32_t dvg_memo_points[DVG_MEMO_POINTS];   // x + (y << 10) + (z << 20), relative
+static uint16_t dvg_memo_used = 0;
+
+// Subroutine being recorded (one at a time: only leaves are cached)
+static struct {
+    dvg_memo_entry* entry;
+    uint16_t steps;                 // Steps when the call started
+    uint32_t cycles;
+    int16_t  x, y;                  // Offset from the entry position
+} dvg_memo_rec;
+
+static inline dvg_memo_entry& dvg_memo_slot(uint16_t addr, uint8_t scale) {
+    return dvg_memo_entries[(addr ^ (addr >> 7) ^ (scale * 0x51)) & (DVG_MEMO_ENTRIES - 1)];
+}
+
+static void dvg_memo_flush() {
+    for (int i = 0; i < DVG_MEMO_ENTRIES; i++) dvg_memo_entries[i].state = DVG_MEMO_EMPTY;
+    dvg_memo_used = 0;
+}
+
+static void dvg_memo_begin(dvg_memo_entry& e, uint16_t addr, int steps) {
+    // Evicted entries leave their points behind; start over when full
+    if (dvg_memo_used + DVG_MEMO_MAX_POINTS > DVG_MEMO_POINTS) dvg_memo_flush();
+    
+    e.addr = addr;
+    e.scale = dvg_state.scale;
+    e.state = DVG_MEMO_EMPTY;
+    e.first = dvg_memo_used;
+    e.count = 0;
+    e.min_x = e.max_x = e.min_y = e.max_y = 0;
+    dvg_memo_rec.entry = &e;
+    dvg_memo_rec.steps = steps;
+    dvg_memo_rec.cycles = dvg_state.cycles;
+    dvg_memo_rec.x = dvg_memo_rec.y = 0;
+    dvg_memo_misses++;
+}
+
+// The recorded subroutine does something that depends on more than its entry
+static inline void dvg_memo_abort() {
+    if (!dvg_memo_rec.entry) return;
+    dvg_memo_rec.entry->state = DVG_MEMO_UNCACHEABLE;
+    dvg_memo_rec.entry = nullptr;
+}
+
+static inline void dvg_memo_record(int16_t dx, int16_t dy, uint8_t z) {
+    dvg_memo_entry& e = *dvg_memo_rec.entry;
+    if (e.count == DVG_MEMO_MAX_POINTS) {
+        dvg_memo_abort();
+        return;
     }
-    
-    // Vector ROM: 0x5000-0x57FF (2KB with vector object data)
-    if (addr >= 0x5000 && addr < 0x5800) {
-        static bool first_read = true;
-        if (first_read) {
-            first_read = false;
-            Serial.printf("*** First Vector ROM read at 0x%04X\n", addr);
-        }
-        return asteroid_rom_vector[addr - 0x5000];
+    int16_t x = dvg_memo_rec.x += dx;
+    int16_t y = dvg_memo_rec.y += dy;
+    if (x < e.min_x) e.min_x = x;
+    if (x > e.max_x) e.max_x = x;
+    if (y < e.min_y) e.min_y = y;
+    if (y > e.max_y) e.max_y = y;
+    dvg_memo_points[e.first + e.count++] = x + y * 1024 + ((int32_t)z << 20);
+}
+
+// RTSL of the recorded subroutine: keep it if it drew anything
+static void dvg_memo_end(int steps) {
+    dvg_memo_entry& e = *dvg_memo_rec.entry;
+    dvg_memo_rec.entry = nullptr;
+    if (e.count == 0) {
+        e.state = DVG_MEMO_UNCACHEABLE;  // Leaves the registers as they came
+        return;
     }
-    
-    // Input ports: 0x2000-0x2FFF
-    // IN0: 0x2000-0x2007 (each address bit-selects one input)
-    if (addr >= 0x2000 && addr < 0x2008) {
-        static int read_count = 0;
-        
-        bool debug = false;  // Other debug disabled
-        if (debug) {
-            read_count++;
-        }
-        
-        // Read all inputs from buttons struct
-        uint8_t in0 = 0x00;
-        if (buttons.hyperspace)  in0 |= 0x08;  // Bit 3
-        if (buttons.fire)        in0 |= 0x10;  // Bit 4
-        // Bit 5: Diagnostic Step (not implemented)
-        // Bit 6: TILT (not implemented)
-        // Bit 7: Self-Test Switch - Always 0 for normal gameplay
-        
-        // NORMAL GAMEPLAY MODE: bit 7 = 0
-        // Leave bit 7 = 0 to run normal game code
-        //
-        // Reset handler at 0x7D08:
-        //   LDY $2007    ; Load IN0 bit 7
-        //   BMI L7D50    ; If bit 7=1, branch to self-test
-        //   Falls through to JMP $6803 (normal game init at 0x6803)
-        //
-        // With NMI disabled, the main game code should be able to run
-        // and eventually write to DVG GO (0x3000)
-        // Bit 7 = 0 (normal mode, NOT self-test)
-        
-        // Bit 1: 3 kHz clock - toggle based on CPU cycles
-        clock_3khz = (total_cpu_cycles & 0x100) ? true : false;
-        if (clock_3khz) in0 |= 0x02;
-        
-        // Bit 2: DVG HALT (ACTIVE-LOW per schematics)
-        // HALT=0 → DVG is DONE/ready (signal LOW)
-        // HALT=1 → DVG is BUSY (signal HIGH)
-        //
-        // ROM at PC=0x6815: LDA $0x2002; BMI loop
-        // - Reads bit 2 of IN0, returns as bit 7 of result
-        // - BMI branches if bit 7=1 (negative)
-        // - Waits until bit 7=0 (positive) to continue
-        //
-        // Bit-select logic: bit_value = (in0 >> 2) & 0x01
-        //                   result = bit_value ? 0x80 : 0x7F
-        //
-        // For DVG DONE (HALT=0, active-low):
-        //   bit 2 = 0 → bit_value=0 → result=0x7F (positive) → ROM exits loop ✓
-        //
-        // For DVG BUSY (HALT=1):
-        //   bit 2 = 1 → bit_value=1 → result=0x80 (negative) → ROM loops ✓
-        //
-        // DVG state: when halt=true, DVG is stopped/done (HALT signal LOW, bit 2 = 0)
-        //            when running=true, DVG is processing (HALT signal HIGH, bit 2 = 1)
-        if (dvg_state.running && !dvg_state.halt) {
-            // DVG is actively RUNNING - HALT signal is HIGH (busy)
-            // Set bit 2 = 1
-            in0 |= 0x04;
-        }
-        // else: DVG is DONE (halted) - leave bit 2 = 0
-        
-        // Each address bit selects which bit to return in bit 7
-        uint8_t bit_select = addr & 0x07;
-        uint8_t bit_value = (in0 >> bit_select) & 0x01;
-        
-        // MAME logic: if bit set, return 0x80, else return ~0x80 (0x7F)
-        uint8_t result = bit_value ? 0x80 : 0x7F;
-        
-        // DEBUG: Show IN0 reads, especially 0x2002 (DVG HALT) and 0x2007 (Self-Test)
-        static int read_2002_count = 0;
-        if (addr == 0x2002 && read_2002_count < 50) {
-            Serial.printf("*** IN0 READ 0x2002 [%d]: DVG halt=%d running=%d → bit2=%d → RETURN 0x%02X (PC=%04X)\n",
-                         read_2002_count++, dvg_state.halt, dvg_state.running, bit_value, result, cpu->GetPC());
-        }
-        
-        if (addr == 0x2007 && read_count < 20) {
-            Serial.printf("*** IN0[%d] READ 0x2007: in0=0x%02X, bit7=%d → RETURN 0x%02X (N=%d)\n",
-                         read_count++, in0, bit_value, result, (result & 0x80) ? 1 : 0);
-        }
-        
-        if (debug) {
-            Serial.printf("*** IN0[%d] addr=0x%04X: in0=0x%02X, bit=%d, result=0x%02X\n", 
-                         read_count, addr, in0, bit_value, result);
-        }
-        
-        return result;
+    e.steps = steps - dvg_memo_rec.steps;
+    e.cycles = dvg_state.cycles - dvg_memo_rec.cycles;
+    e.end_x = dvg_memo_rec.x;
+    e.end_y = dvg_memo_rec.y;
+    e.dvx = dvg_state.dvx;
+    e.dvy = dvg_state.dvy;
+    e.intensity = dvg_state.intensity;
+    e.state = DVG_MEMO_VALID;
+    dvg_memo_used += e.count;
+}
+
+// Replay a cached subroutine called at the current beam position;
+// false if it has to run normally
+static inline bool dvg_memo_replay(const dvg_memo_entry& e, int& steps) {
+    int x = dvg_state.x, y = dvg_state.y;
+    int count = vector_back->count;
+    if (steps + e.steps > DVG_MAX_STEPS ||
+        count == 0 || count + e.count > VECT_POINTS_PER_FRAME ||
+        x + e.min_x < 0 || x + e.max_x > 1023 ||
+        y + e.min_y < 0 || y + e.max_y > 1023) {
+        return false;
     }
     
-    // IN1: 0x2400-0x2407 (player controls)
-    if (addr >= 0x2400 && addr < 0x2408) {
-        static int read_count = 0;
-        if (read_count++ < 5) {
-            Serial.printf("*** I/O read IN1 at 0x%04X\n", addr);
-        }
-        
-        uint8_t in1 = 0x00;
-        
-        // EXPERIMENTAL: Auto-insert coin and press start
-        // Simulate player inserting coin and pressing start button
-        // This should trigger the game to begin and write to DVG
-        static unsigned long game_start_time = 0;
-        if (game_start_time == 0) {
-            game_start_time = millis();
-        }
-        unsigned long game_runtime = millis() - game_start_time;
-        
-        // Insert coin after 2 seconds
-        if (game_runtime >= 2000 && game_runtime < 4000) {
-            in1 |= 0x01;  // Bit 0: Coin 1 PRESSED
-        }
-        
-        // Press START after 4 seconds
-        if (game_runtime >= 4000 && game_runtime < 6000) {
-            in1 |= 0x08;  // Bit 3: Start 1 PRESSED
-        }
-        
-        // Manual controls (after auto-start)
-        if (buttons.coin)         in1 |= 0x01;  // Bit 0: Coin 1
-        // Bit 1: Coin 2 (not implemented)
-        // Bit 2: Coin 3 (not implemented)
-        if (buttons.start)        in1 |= 0x08;  // Bit 3: Start 1
-        // Bit 4: Start 2 (not implemented)
-        if (buttons.thrust)       in1 |= 0x20;  // Bit 5: Thrust
-        if (buttons.rotate_right) in1 |= 0x40;  // Bit 6: Right
-        if (buttons.rotate_left)  in1 |= 0x80;  // Bit 7: Left
-        
-        uint8_t bit_select = addr & 0x07;
-        uint8_t bit_value = (in1 >> bit_select) & 0x01;
-        
-        return bit_value ? 0x80 : 0x7F;
-    }
+    // In range, so adding the packed offsets never carries between fields
+    const int32_t* src = dvg_memo_points + e.first;
+    uint32_t* dst = vector_back->points + count;
+    int32_t base = x + y * 1024;
+    for (int i = 0; i < e.count; i++) dst[i] = base + src[i];
+    vector_back->count = count + e.count;
+    
+    dvg_state.x = x + e.end_x;
+    dvg_state.y = y + e.end_y;
+    dvg_state.dvx = e.dvx;
+    dvg_state.dvy = e.dvy;
+    dvg_state.intensity = e.intensity;
+    dvg_state.cycles += e.cycles;
+    steps += e.steps;
+    
+    // RTSL
+    dvg_state.pc = dvg_state.stack[dvg_state.stack_ptr & 3];
+    dvg_state.stack_ptr = (dvg_state.stack_ptr - 1) & 0xf;
+    dvg_memo_hits++;
+    return true;
+}
+
+#define DVG_MEMO_ACTIVE 1
+#else
+#define DVG_MEMO_ACTIVE 0
+#endif
+
+// GOSTROBE of VCTR/SVEC, recorded while a subroutine is being memoized
+static inline void dvg_decoded_vector() {
+    int16_t dx, dy;
+    dvg_vector_delta(dx, dy);
+#if DVG_MEMO_ACTIVE
+    if (dvg_memo_rec.entry) dvg_memo_record(dx, dy, dvg_state.intensity);
+#endif
+    dvg_add_vector(dx, dy, dvg_state.intensity);
+}
+
+void dvg_run_decoded() {
+    dvg_state.halt = false;
     
-    // DSW1: 0x2800-0x2803 (DIP switches)
-    if (addr >= 0x2800 && addr < 0x2804) {
-        static int read_count = 0;
-        if (read_count++ < 5) {
-            Serial.printf("*** I/O read DSW1 at 0x%04X\n", addr);
+    // GO: DMALD with op 0 loads pc from dvy, then LATCH1 of the first word
+    dvg_state.pc = dvg_state.dvy;
+    dvg_latch_op();
+    int steps = 2;
+#if DVG_MEMO_ACTIVE
+    dvg_memo_rec.entry = nullptr;
+#endif
+    
+    while (!dvg_state.halt) {
+        uint8_t op = dvg_state.op;
+        if (steps + dvg_op_steps[op] > DVG_MAX_STEPS) {
+            dvg_run_micro_steps(DVG_MAX_STEPS - steps);
+            steps = DVG_MAX_STEPS;
+            break;
         }
+        steps += dvg_op_steps[op];
         
-        // Simplified DIP switch reading
-        // Real hardware uses 74LS153 multiplexer controlled by offset
-        uint8_t bit_select = addr & 0x03;
-        uint8_t bit_pair = (dip_switches >> (bit_select * 2)) & 0x03;
-        
-        // Return bits in positions 0 and 1
-        return 0xFC | bit_pair;
-    }
-    
-    // ROM: 0x6800-0xFFFF (6KB ROM mirrored throughout this range)
-#ifdef ASTEROID_ROMS_CONVERTED
-    if (addr >= 0x6800) {
-        // Debug: Monitor NMI handler access
-        static int nmi_handler_access = 0;
-        if (addr >= 0xF37B && addr < 0xF400 && nmi_handler_access < 5) {
-            Serial.printf("*** NMI Handler READ [%d]: PC accessed 0x%04X\n", 
-                         ++nmi_handler_access, addr);
+        // LATCH0: low Y / address bits, every opcode starts with it
+        if (op != 0xf) {
+            dvg_state.dvy = (dvg_state.dvy & 0xf00) | dvg_bus_byte(dvg_state.pc, 0);
+        } else {
+            // SVEC: the low byte holds high X and intensity
+            uint8_t lo = dvg_bus_byte(dvg_state.pc, 0);
+            dvg_state.dvy &= 0xf00;
+            dvg_state.dvx = (dvg_state.dvx & 0xff) | ((lo & 0xf) << 8);
+            dvg_state.intensity = lo >> 4;
         }
+        dvg_state.pc++;
         
-        // Special case: High vectors (0xF800-0xFFFF) always map to end of PROM2
-        // This ensures reset/IRQ/NMI vectors are read correctly
-        if (addr >= 0xF800) {
-            uint16_t offset_in_last_2k = addr - 0xF800;  // 0x0000-0x07FF
+        switch (op) {
+            case 0x0: case 0x1: case 0x2: case 0x3:  // VCTR
+            case 0x4: case 0x5: case 0x6: case 0x7:
+            case 0x8: case 0x9:
+            case 0xA: {                              // LABS
+                // LATCH3 + LATCH2: X word with intensity
+                uint8_t hi = dvg_bus_byte(dvg_state.pc, 1);
+                dvg_state.dvx = ((hi & 0xf) << 8) | dvg_bus_byte(dvg_state.pc, 0);
+                dvg_state.intensity = hi >> 4;
+                dvg_state.pc++;
+                
+                if (op == 0xA) {
+                    // HALTSTROBE with OP0 clear: blank move
+#if DVG_MEMO_ACTIVE
+                    dvg_memo_abort();
+#endif
+                    dvg_state.scale = dvg_state.intensity;
+                    dvg_state.xpos = dvg_state.dvx & 0xfff;
+                    dvg_state.ypos = dvg_state.dvy & 0xfff;
+                    dvg_add_vector(dvg_state.xpos - dvg_state.x, dvg_state.ypos - dvg_state.y, 0);
+                } else {
+                    dvg_decoded_vector();
+                }
+                break;
+            }
+            
+            case 0xB:                                // HALT
+#if DVG_MEMO_ACTIVE
+                dvg_memo_abort();
+#endif
+                dvg_state.halt = true;
+                continue;
+            
+            case 0xC:                                // JSRL
+                dvg_state.stack_ptr = (dvg_state.stack_ptr + 1) & 0xf;
+                dvg_state.stack[dvg_state.stack_ptr & 3] = dvg_state.pc;
+                dvg_state.pc = dvg_state.dvy;
+#if DVG_MEMO_ACTIVE
+                if (dvg_memo_rec.entry) {
+                    dvg_memo_abort();                // Only leaves are cached
+                } else if (dvg_state.pc >= 0x800 && dvg_state.pc < 0xC00) {
+                    dvg_memo_entry& e = dvg_memo_slot(dvg_state.pc, dvg_state.scale);
+                    if (e.addr == dvg_state.pc && e.scale == dvg_state.scale && e.state != DVG_MEMO_EMPTY) {
+                        if (e.state == DVG_MEMO_VALID) dvg_memo_replay(e, steps);
+                    } else {
+                        dvg_memo_begin(e, dvg_state.pc, steps);
+                    }
+                }
+#endif
+                break;
+            
+            case 0xD:                                // RTSL
+                dvg_state.pc = dvg_state.stack[dvg_state.stack_ptr & 3];
+                dvg_state.stack_ptr = (dvg_state.stack_ptr - 1) & 0xf;
+#if DVG_MEMO_ACTIVE
+                if (dvg_memo_rec.entry) dvg_memo_end(steps);
+#endif
+                break;
             
-            // Debug: Vector area reads - DISABLED for performance
+            case 0xE:                                // JMPL
+#if DVG_MEMO_ACTIVE
+                dvg_memo_abort();
+#endif
+                dvg_state.pc = dvg_state.dvy;
+                break;
             
-            return asteroid_rom_prom2[offset_in_last_2k];
+            case 0xF:                                // SVEC
+                dvg_decoded_vector();
+                break;
         }
         
-        // The 6KB ROM (3x 2KB chips) is mirrored throughout 0x6800-0xF7FF
-        uint16_t offset_from_base = addr - 0x6800;
-        uint16_t rom_offset = offset_from_base % 0x1800;  // 0x1800 = 6KB
-        
-        // ROM layout in 6KB space:
-        // 0x0000-0x07FF: PROM0 (035145-04e.ef2) - 0x6800-0x6FFF
-        // 0x0800-0x0FFF: PROM1 (035144-04e.h2)  - 0x7000-0x77FF
-        // 0x1000-0x17FF: PROM2 (035143-02.j2)   - 0x7800-0x7FFF
-        if (rom_offset >= 0x1000) {
-            // PROM2: offset 0x1000-0x17FF
-            return asteroid_rom_prom2[rom_offset - 0x1000];
-        } else if (rom_offset >= 0x0800) {
-            // PROM1: offset 0x0800-0x0FFF
-            return asteroid_rom_prom1[rom_offset - 0x0800];
-        } else {
-            // PROM0: offset 0x0000-0x07FF
-            return asteroid_rom_prom0[rom_offset];
-        }
+        dvg_latch_op();
     }
-#endif
     
-    return 0xFF;
+    // One DVG clock per PROM step on top of the vector timer
+    dvg_state.cycles += steps;
 }
 
-void cpu6502_write_callback(uint16_t addr, uint8_t value) {
-    // RAM: 0x0000-0x0FFF
-    if (addr < 0x1000) {
-        // DEBUG: Track Zero Page 0x5B (used by bit-shift loop)
-        static int zp5b_write_count = 0;
-        if (addr == 0x5B && zp5b_write_count < 30) {
-            Serial.printf("*** ZP[0x5B] WRITE #%d: value=0x%02X (was 0x%02X), PC=0x%04X\n",
-                         ++zp5b_write_count, value, ram[0x5B], cpu->GetPC());
-        }
+#ifdef DVG_DIFF_TEST
+// Differential test: run both engines from the same start state and
+// compare the vector output and the architectural DVG state
+static struct {
+    uint32_t runs;
+    uint32_t mismatches;
+} dvg_diff_stats;
+
+static bool dvg_state_equal(const decltype(dvg_state)& a, const decltype(dvg_state)& b) {
+    return a.pc == b.pc && a.x == b.x && a.y == b.y &&
+           a.xpos == b.xpos && a.ypos == b.ypos &&
+           a.scale == b.scale && a.intensity == b.intensity &&
+           a.dvx == b.dvx && a.dvy == b.dvy && a.op == b.op &&
+           a.stack_ptr == b.stack_ptr && a.halt == b.halt &&
+           memcmp(a.stack, b.stack, sizeof(a.stack)) == 0;
+}
+
+void dvg_run_diff_test() {
+    static decltype(dvg_state) start_state, prom_state;
+    static vector_list start_buffer, prom_buffer;
+    
+    start_state = dvg_state;
+    start_buffer = *vector_back;
+    dvg_run_prom();
+    prom_state = dvg_state;
+    prom_buffer = *vector_back;
+    
+    dvg_state = start_state;
+    *vector_back = start_buffer;
+    dvg_run_decoded();
+    
+    bool same = dvg_state_equal(dvg_state, prom_state) &&
+                vector_back->count == prom_buffer.count &&
+                memcmp(vector_back->points, prom_buffer.points,
+                       vector_back->count * sizeof(vector_back->points[0])) == 0;
+    
+    dvg_diff_stats.runs++;
+    if (!same) {
+        dvg_diff_stats.mismatches++;
+        Serial.printf("*** DVG DIFF MISMATCH [run %u]: points prom=%d decoded=%d, PC prom=0x%03X decoded=0x%03X\n",
+                     dvg_diff_stats.runs, prom_buffer.count, vector_back->count,
+                     prom_state.pc, dvg_state.pc);
+    }
+    if ((dvg_diff_stats.runs % 256) == 0) {
+        Serial.printf("*** DVG diff test: %u runs, %u mismatches\n",
+                     dvg_diff_stats.runs, dvg_diff_stats.mismatches);
+    }
+}
+#endif
+
+// DVG GO: run the configured engine over the current vector list
+void dvg_run_state_machine() {
+    if (!dvg_state.running) return;
+    
+#if defined(DVG_DIFF_TEST)
+    dvg_run_diff_test();
+#elif DVG_USE_DECODED_ENGINE
+    dvg_run_decoded();
+#else
+    dvg_run_prom();
+#endif
+    
+    dvg_state.running = false;
+    if (!dvg_state.halt) dvg_overruns++;
+    
+    TRACE(TRACE_DVG, TRACE_EV_DVG_DONE, dvg_state.pc, vector_back->count, dvg_state.halt);
+}
+
+// Decode a vector RAM image from a GO into the back list and return its
+// points (dvg_service(), and the decode benchmark in test/test_bench)
+void dvg_start(uint8_t value);
+const uint32_t* dvg_decode(const uint8_t* vram, uint8_t go_value, int* count) {
+    dvg_vram = vram;
+    dvg_start(go_value);
+    dvg_run_state_machine();
+    *count = vector_back->count;
+    return vector_back->points;
+}
+
+// ============================================================================
+// REGRESSION (golden frames)
+// ============================================================================
+
+/*
+ * Deterministic replay to check optimizations for exactness: from reset
+ * the machine runs REGRESS_FRAMES NMI periods under a fixed input script,
+ * with the work of both cores done in one task so that every GO gets
+ * decoded. Each NMI folds the CPU state (registers, PC, master cycle)
+ * into one running digest and each decoded list folds its points into
+ * another. Every REGRESS_CHECKPOINT frames both digests, a RAM/VRAM hash
+ * and the list count are compared with test/golden/regress.inc, which
+ * is compiled into the native and the target build alike. A mismatch
+ * names the window of frames where the replay diverged.
+ */
+
+struct regress_checkpoint {
+    uint32_t frame;
+    uint32_t cpu;     // CPU state at every NMI so far
+    uint32_t dvg;     // Every decoded list so far
+    uint32_t mem;     // RAM + vector RAM at this frame
+    uint32_t lists;
+};
+
+static const regress_checkpoint regress_golden[] = {
+#include "../test/golden/regress.inc"
+};
+
+static struct {
+    bool     active;
+    uint32_t cpu;
+    uint32_t dvg;
+    uint32_t lists;
+    const uint8_t* vram;  // Image and GO value of the newest list
+    uint8_t  go;
+} regress;
+
+void sched_init();
+void sched_run(uint64_t until);
+bool dvg_service();
+void input_publish(uint8_t pressed);
+
+#define REGRESS_FNV_BASIS 2166136261u
+
+static inline uint32_t regress_fold(uint32_t h, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        h = (h ^ (v & 0xFF)) * 16777619u;
+        v >>= 8;
+    }
+    return h;
+}
+
+// NMI edge: instruction boundary, fold the architectural state
+static void regress_nmi() {
+    uint32_t h = regress_fold(regress.cpu, (cpu->GetA() << 24) | (cpu->GetX() << 16) |
+                                           (cpu->GetY() << 8) | cpu->GetP());
+    h = regress_fold(h, (cpu->GetS() << 16) | cpu->GetPC());
+    regress.cpu = regress_fold(h, (uint32_t)cpu->GetCycles());
+}
+
+// A list was decoded (or reused, see DVG PIPELINE)
+static void regress_list(const vector_list* list, const uint8_t* vram, uint8_t go) {
+    regress.vram = vram;
+    regress.go = go;
+    uint32_t h = regress_fold(regress.dvg, list->count);
+    for (int i = 0; i < list->count; i++) {
+        h = regress_fold(h, list->points[i]);
+    }
+    regress.dvg = h;
+    regress.lists++;
+}
+
+static uint32_t regress_mem_hash() {
+    uint32_t h = REGRESS_FNV_BASIS;
+    for (int i = 0; i < MEM_SIZE_RAM; i++) h = (h ^ ram[i]) * 16777619u;
+    for (int i = 0; i < MEM_SIZE_VECTOR; i++) h = (h ^ vector_ram[i]) * 16777619u;
+    return h;
+}
+
+// Input script by frame (4 ms): coin at 2 s, then every 30 s a start
+// followed by regular fire, thrust and turning
+void regress_input(uint32_t frame) {
+    const uint32_t second = CPU_NMI_HZ;
+    uint32_t t = frame % (30 * second);
+    
+    uint8_t pressed = 0;
+    if (frame >= 2 * second && frame < 2 * second + 25) pressed |= INPUT_COIN;
+    if (t >= 3 * second && t < 3 * second + 25) pressed |= INPUT_START;
+    if (t >= 5 * second) {
+        if ((t % 60) < 5) pressed |= INPUT_FIRE;
+        if ((t % 500) < 150) pressed |= INPUT_THRUST;
+        if ((t % 400) < 60) pressed |= INPUT_LEFT;
+    }
+    input_publish(pressed);
+}
+
+// Random play for the soak runner (native --soak): a coin and a start
+// every 30 s, in between a new random mix of turning, thrust and fire
+// every 16 frames and now and then a hyperspace jump
+void regress_input_random(uint32_t frame, uint32_t seed) {
+    const uint32_t second = CPU_NMI_HZ;
+    uint32_t t = frame % (30 * second);
+    
+    uint8_t pressed = 0;
+    if (t >= 2 * second && t < 2 * second + 25) pressed |= INPUT_COIN;
+    if (t >= 3 * second && t < 3 * second + 25) pressed |= INPUT_START;
+    if (t >= 5 * second) {
+        uint32_t r = regress_fold(REGRESS_FNV_BASIS ^ seed, frame / 16);
+        pressed |= r & (INPUT_LEFT | INPUT_RIGHT | INPUT_THRUST | INPUT_FIRE);
+        if (((r >> 8) & 0x3F) == 0) pressed |= INPUT_HYPER;
+    }
+    input_publish(pressed);
+}
+
+// Replay from the current state (reset, or a loaded savestate). With
+// 'record' the checkpoints are printed in the format of
+// test/golden/regress.inc instead of being compared. Returns the number
+// of mismatching checkpoints.
+int regress_run(bool record) {
+    const int golden_count = sizeof(regress_golden) / sizeof(regress_golden[0]);
+    int checked = 0, mismatches = 0;
+    
+    memset(&regress, 0, sizeof(regress));
+    regress.cpu = REGRESS_FNV_BASIS;
+    regress.dvg = REGRESS_FNV_BASIS;
+    regress.active = true;
+    
+    if (record) {
+        Serial.printf("// Golden checkpoints: %u frames, every %u frames\n",
+                      REGRESS_FRAMES, REGRESS_CHECKPOINT);
+        Serial.println("// frame   cpu         dvg         mem         lists");
+    } else {
+        Serial.printf("[golden] Replaying %u frames against %d checkpoints\n",
+                      REGRESS_FRAMES, golden_count);
+    }
+    
+    if (!savestate_booted) sched_init();
+    uint64_t frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+    unsigned long start = micros();
+    
+    for (uint32_t frame = 1; frame <= REGRESS_FRAMES; frame++) {
+        regress_input(frame - 1);
+        frame_end += CPU_CYCLES_PER_FRAME;
+        sched_run(frame_end);
+        dvg_service();
+        
+        if (frame % REGRESS_CHECKPOINT) continue;
+        
+        regress_checkpoint c = { frame, regress.cpu, regress.dvg, regress_mem_hash(), regress.lists };
+        if (record) {
+            Serial.printf("    { %6u, 0x%08X, 0x%08X, 0x%08X, %5u },\n",
+                          c.frame, c.cpu, c.dvg, c.mem, c.lists);
+            continue;
+        }
+        
+        const regress_checkpoint* g = (checked < golden_count) ? &regress_golden[checked] : nullptr;
+        checked++;
+        if (!g || memcmp(&c, g, sizeof(c)) != 0) {
+            mismatches++;
+            Serial.printf("[golden] MISMATCH frames %u-%u:%s%s%s%s\n",
+                          frame - REGRESS_CHECKPOINT + 1, frame,
+                          !g ? " no golden checkpoint" : "",
+                          g && g->cpu != c.cpu ? " cpu" : "",
+                          g && g->dvg != c.dvg ? " dvg" : "",
+                          g && (g->mem != c.mem || g->lists != c.lists) ? " mem/lists" : "");
+        }
+    }
+    
+    regress.active = false;
+    
+    if (!record) {
+        int matched = checked - mismatches;
+        if (checked != golden_count) mismatches++;  // Golden file has another length
+        Serial.printf("[golden] %s: %d/%d checkpoints match, %u lists, %lu ms\n",
+                      mismatches ? "FAIL" : "PASS", matched, golden_count,
+                      regress.lists, (micros() - start) / 1000);
+    }
+    return mismatches;
+}
+
+// Vector RAM images for the DVG decode benchmark: from reset without
+// input (attract mode), the image of the first list at or after every
+// 'every' frames, printed in the format of test/test_bench/attract_vram.inc
+void regress_record_vram(int images, uint32_t every) {
+    memset(&regress, 0, sizeof(regress));
+    regress.active = true;
+    Serial.printf("// Attract-mode vector RAM at GO: %d images from reset, every %u frames\n",
+                  images, every);
+    Serial.println("// frame   go    image");
+    
+    input_publish(0);
+    if (!savestate_booted) sched_init();
+    uint64_t frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+    
+    int n = 0;
+    for (uint32_t frame = 1; n < images; frame++) {
+        frame_end += CPU_CYCLES_PER_FRAME;
+        sched_run(frame_end);
+        uint32_t lists = regress.lists;
+        dvg_service();
+        if (regress.lists == lists || frame < (n + 1) * every) continue;
+        
+        Serial.printf("    { %6u, 0x%02X, {", frame, regress.go);
+        for (int i = 0; i < MEM_SIZE_VECTOR; i++) {
+            Serial.printf("%s0x%02X,", (i % 16) ? " " : "\n        ", regress.vram[i]);
+        }
+        Serial.println("\n    } },");
+        n++;
+    }
+    regress.active = false;
+}
+
+// ============================================================================
+// DVG PIPELINE (core 0 -> core 1)
+// ============================================================================
+
+/*
+ * A DVG GO on core 0 only copies vector RAM into a snapshot; decoding
+ * runs on core 1 next to the display. The snapshots form a lock-free
+ * triple buffer: core 0 owns one slot, core 1 owns one slot, and the
+ * third is exchanged through dvg_snapshot_ready together with a FRESH
+ * flag. A GO that arrives before core 1 picked up the previous one
+ * simply replaces it (latest list wins), so neither core ever waits.
+ */
+
+#define DVG_SNAPSHOT_FRESH 0x80
+
+struct dvg_snapshot {
+    uint8_t  vram[MEM_SIZE_VECTOR];
+#if DVG_REUSE_ACTIVE
+    uint32_t block_hash[DVG_BLOCKS];  // FNV-1a over the words of each block
+#endif
+    uint8_t  go_value;                // Value written to 0x3000
+    uint32_t cycle;                   // Master cycle of that write
+};
+
+static dvg_snapshot dvg_snapshots[3];
+static std::atomic<uint32_t> dvg_snapshot_ready(1);  // Slot index | FRESH
+static uint8_t dvg_snapshot_write = 0;               // Slot owned by core 0
+static uint8_t dvg_snapshot_read = 2;                // Slot owned by core 1
+
+// DVG HALT as seen by the CPU (IN0 bit 2). The snapshot releases vector
+// RAM immediately; the DVG still reports busy for as long as drawing the
+// list takes (see SCHEDULER).
+volatile bool dvg_busy = false;
+uint64_t dvg_halt_cycle = 0;                         // Master cycle of HALT
+
+// Beam time of the newest decoded list, core 1 -> core 0
+static std::atomic<uint32_t> dvg_list_cycles(0);
+
+// Points in the newest decoded list (statistics, core 1)
+int dvg_list_points = 0;
+
+// Core 0: publish the current vector RAM for decoding
+void dvg_post_snapshot(uint8_t go_value) {
+    dvg_snapshot& snap = dvg_snapshots[dvg_snapshot_write];
+#if DVG_REUSE_ACTIVE
+    // Copy by words and hash each block on the way
+    const uint32_t* src = (const uint32_t*)vector_ram;
+    uint32_t* dst = (uint32_t*)snap.vram;
+    for (int b = 0; b < DVG_BLOCKS; b++) {
+        uint32_t h = 2166136261u;
+        for (int i = 0; i < DVG_BLOCK_WORDS / 2; i++) {
+            uint32_t w = *src++;
+            *dst++ = w;
+            h = (h ^ w) * 16777619u;
+        }
+        snap.block_hash[b] = h;
+    }
+#else
+    memcpy(snap.vram, vector_ram, sizeof(snap.vram));
+#endif
+    snap.go_value = go_value;
+    snap.cycle = (uint32_t)total_cpu_cycles;
+    dvg_snapshot_write = dvg_snapshot_ready.exchange(dvg_snapshot_write | DVG_SNAPSHOT_FRESH) & 0x03;
+}
+
+// Core 1: take the newest snapshot, or nullptr if nothing new was posted
+static const dvg_snapshot* dvg_take_snapshot() {
+    if (!(dvg_snapshot_ready.load() & DVG_SNAPSHOT_FRESH)) return nullptr;
+    dvg_snapshot_read = dvg_snapshot_ready.exchange(dvg_snapshot_read) & 0x03;
+    return &dvg_snapshots[dvg_snapshot_read];
+}
+
+// Core 1: reset the DVG for a new list, as the GO strobe does
+void dvg_start(uint8_t value) {
+    // In Asteroids, the value written is typically 0x00 (start from beginning)
+    dvg_state.pc = (value & 0x0F) << 8;  // Only low 4 bits used as high address bits
+    dvg_state.running = true;
+    dvg_state.halt = false;
+    dvg_state.stack_ptr = 0;
+    dvg_state.state_latch = 0x00;  // PROM: Initial state
+    dvg_state.op = 0;
+    dvg_state.data = 0;
+    dvg_state.dvx = 0;
+    dvg_state.dvy = 0;
+    dvg_state.cycles = 0;
+    
+    // Clear previous back list
+    vector_back->count = 0;
+}
+
+#if DVG_REUSE_ACTIVE
+/*
+ * Unchanged-frame short-circuit. The game alternates between two lists
+ * (GO 0xE0 starts at word 0x000, 0xE2 at 0x200) and rewrites one while
+ * the other is drawn, so each start address gets its own entry. The
+ * decoder notes which vector RAM blocks a list read; a list depends on
+ * nothing else but the start address, the vector ROM and the few DVG
+ * registers dvg_start() does not reset. If all of those match the entry,
+ * the DVG state is put back to where that decode ended and the entry's
+ * points are used. When they equal the newest list (a static screen, in
+ * both halves) nothing is flipped, so neither the raster nor the DMA
+ * stream is rebuilt.
+ */
+
+#define DVG_REUSE_ENTRIES 2
+
+// DVG registers that carry over from one list into the next
+struct dvg_carry {
+    int16_t  x, y, xpos, ypos;
+    uint16_t stack[4];
+    uint8_t  scale, intensity;
+};
+
+static dvg_carry dvg_carry_get() {
+    dvg_carry c;
+    c.x = dvg_state.x;
+    c.y = dvg_state.y;
+    c.xpos = dvg_state.xpos;
+    c.ypos = dvg_state.ypos;
+    memcpy(c.stack, dvg_state.stack, sizeof(c.stack));
+    c.scale = dvg_state.scale;
+    c.intensity = dvg_state.intensity;
+    return c;
+}
+
+struct dvg_reuse_entry {
+    bool        valid;
+    uint8_t     start;                   // Low nibble of the GO value
+    dvg_carry   carry;                   // Registers at the start of the list
+    uint32_t    blocks;                  // Blocks the list read
+    uint32_t    block_hash[DVG_BLOCKS];  // ... and their contents
+    uint32_t    list_hash;               // Digest of the decoded points
+    decltype(dvg_state) end;             // DVG state after the list
+    vector_list list;
+};
+
+static dvg_reuse_entry dvg_reuse[DVG_REUSE_ENTRIES];
+static uint32_t dvg_newest_hash = 0;     // Digest of the newest list (back if ready, else front)
+
+static uint32_t dvg_list_hash(const vector_list* list) {
+    uint32_t h = 2166136261u ^ list->count;
+    for (int i = 0; i < list->count; i++) h = (h ^ list->points[i]) * 16777619u;
+    return h;
+}
+
+static bool dvg_reuse_match(const dvg_reuse_entry& e, const dvg_snapshot* snap, const dvg_carry& carry) {
+    if (!e.valid || e.start != (snap->go_value & 0x0F)) return false;
+    if (memcmp(&carry, &e.carry, sizeof(carry))) return false;
+    for (uint32_t m = e.blocks; m; m &= m - 1) {
+        int b = __builtin_ctz(m);
+        if (snap->block_hash[b] != e.block_hash[b]) return false;
+    }
+    return true;
+}
+#endif
+
+// Core 1: decode a pending vector list into the back buffer.
+// Returns true if a list was serviced (decoded or reused).
+bool dvg_service() {
+    const dvg_snapshot* snap = dvg_take_snapshot();
+    if (!snap) return false;
+    PROF_SCOPE(PROF_DVG);
+    
+#if DVG_REUSE_ACTIVE
+    dvg_reuse_entry& e = dvg_reuse[(snap->go_value >> 1) % DVG_REUSE_ENTRIES];  // 0xE0 / 0xE2
+    dvg_carry carry = dvg_carry_get();
+    if (dvg_reuse_match(e, snap, carry)) {
+        dvg_state = e.end;
+        dvg_list_cycles.store(dvg_state.cycles, std::memory_order_relaxed);
+        if (e.list_hash != dvg_newest_hash) {
+            vector_back->count = e.list.count;
+            memcpy(vector_back->points, e.list.points, e.list.count * sizeof(uint32_t));
+            vector_back->cycle = snap->cycle;
+            vector_back_ready = true;
+            dvg_newest_hash = e.list_hash;
+            dvg_list_points = e.list.count;
+        }
+        if (regress.active) regress_list(&e.list, snap->vram, snap->go_value);
+        dvg_reuse_hits++;
+        PROF_COUNT(PROF_DVG_REUSED);
+        return true;
+    }
+    dvg_read_blocks = 0;
+#endif
+    
+    dvg_decode(snap->vram, snap->go_value, &dvg_list_points);
+    dvg_list_cycles.store(dvg_state.cycles, std::memory_order_relaxed);
+    vector_back->cycle = snap->cycle;
+    if (regress.active) regress_list(vector_back, snap->vram, snap->go_value);
+    vector_back_ready = true;
+    
+#if DVG_REUSE_ACTIVE
+    e.valid = true;
+    e.start = snap->go_value & 0x0F;
+    e.carry = carry;
+    e.blocks = dvg_read_blocks;
+    memcpy(e.block_hash, snap->block_hash, sizeof(e.block_hash));
+    e.list_hash = dvg_list_hash(vector_back);
+    e.end = dvg_state;
+    e.list.count = vector_back->count;
+    memcpy(e.list.points, vector_back->points, vector_back->count * sizeof(uint32_t));
+    dvg_newest_hash = e.list_hash;
+#endif
+    dvg_reuse_misses++;
+    PROF_COUNT(PROF_DVG_DECODED);
+    return true;
+}
+
+// Core 1: at a frame boundary, show the newest complete list
+void vector_flip() {
+    if (!vector_back_ready) return;
+    vector_list* t = vector_front;
+    vector_front = vector_back;
+    vector_back = t;
+    vector_back_ready = false;
+    vector_front_dirty = true;
+}
+
+// ============================================================================
+// SCHEDULER (core 0)
+// ============================================================================
+
+/*
+ * All machine timing is keyed on total_cpu_cycles, the master cycle
+ * count. Timed events sit in a table with the master cycle they are due
+ * at; sched_run() runs the CPU exactly up to the earliest one (Run()
+ * stops at the first instruction boundary at or past it), dispatches
+ * everything that is due and repeats, so timing depends only on emulated
+ * cycles and never on host speed. Events posted by a bus callback in the
+ * middle of a slice are dispatched when that slice ends; the IN0 bits
+ * themselves are computed from the cycle of the reading instruction
+ * (mos6502::GetCycles), so they are exact either way.
+ */
+
+// Run one slice on the CPU core selected in config.h
+#if CPU_USE_SWITCH_CORE && CPU_PREDECODE
+  #define CPU_CORE_NAME "predecode"
+  #define cpu_run(cycles, count) cpu->RunPredecoded((cycles), (count))
+#elif CPU_USE_SWITCH_CORE
+  #define CPU_CORE_NAME "switch"
+  #define cpu_run(cycles, count) cpu->RunSwitch((cycles), (count))
+#else
+  #define CPU_CORE_NAME "table"
+  #define cpu_run(cycles, count) cpu->Run((cycles), (count))
+#endif
+
+enum sched_event {
+    SCHED_NMI,         // 250 Hz NMI (3 kHz clock / 12)
+    SCHED_DVG_HALT,    // DVG finished the list started by GO
+    SCHED_WATCHDOG,    // No write to 0x3400 in time
+    SCHED_EVENTS
+};
+
+#define SCHED_NEVER UINT64_MAX
+
+static uint64_t sched_when[SCHED_EVENTS] = { SCHED_NEVER, SCHED_NEVER, SCHED_NEVER };
+uint32_t watchdog_resets = 0;
+
+inline void sched_post(sched_event ev, uint64_t when) {
+    sched_when[ev] = when;
+}
+
+// Master cycle of the instruction being executed (inside a bus callback)
+inline uint64_t sched_now() {
+    return cpu->GetCycles();
+}
+
+static void sched_dispatch(sched_event ev, uint64_t when) {
+    switch (ev) {
+        case SCHED_NMI:
+            // Falling edge; the CPU takes it before the next instruction
+            cpu->NMI(false);
+            cpu->NMI(true);
+            sched_post(SCHED_NMI, when + CPU_CYCLES_PER_NMI);
+            if (regress.active) regress_nmi();
+            break;
+        
+        case SCHED_DVG_HALT:
+            dvg_busy = false;
+            break;
+        
+        case SCHED_WATCHDOG:
+            // The ROM stopped writing 0x3400 (hung or crashed): the real
+            // board resets the CPU
+            watchdog_resets++;
+            cpu->Reset();
+            sched_post(SCHED_WATCHDOG, when + EMU_WATCHDOG_CYCLES);
+            break;
+        
+        default:
+            break;
+    }
+}
+
+// Start the timed events at the current master cycle
+void sched_init() {
+    sched_post(SCHED_NMI, total_cpu_cycles + CPU_CYCLES_PER_NMI);
+#if EMU_WATCHDOG_CYCLES
+    sched_post(SCHED_WATCHDOG, total_cpu_cycles + EMU_WATCHDOG_CYCLES);
+#endif
+}
+
+// Run the machine until the master cycle count reaches 'until'
+void sched_run(uint64_t until) {
+    while (total_cpu_cycles < until) {
+        uint64_t next = until;
+        for (int ev = 0; ev < SCHED_EVENTS; ev++) {
+            if (sched_when[ev] < next) next = sched_when[ev];
+        }
+        
+        if (next > total_cpu_cycles) {
+            uint64_t before = total_cpu_cycles;
+            PROF_SCOPE(PROF_CPU);
+            cpu_run((int32_t)(next - total_cpu_cycles), total_cpu_cycles);
+            // A jammed CPU (illegal opcode) executes nothing, but time
+            // still passes until the watchdog resets it
+            if (total_cpu_cycles == before) total_cpu_cycles = next;
+        }
+        
+        for (int ev = 0; ev < SCHED_EVENTS; ev++) {
+            uint64_t when = sched_when[ev];
+            if (when <= total_cpu_cycles) {
+                sched_when[ev] = SCHED_NEVER;
+                sched_dispatch((sched_event)ev, when);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// SAVESTATE
+// ============================================================================
+
+/*
+ * The whole machine as one compact binary image: a header (magic,
+ * version, payload size, FNV-1a checksum of the payload) followed by
+ * the fields of savestate_fields back to back, without padding. Save and
+ * load are a memcpy per field, so the image can go to RAM, LittleFS or
+ * the network as is (same byte order on both ends). Input, display
+ * lists and sound are not part of it: they are rebuilt from the next
+ * NMI and GO. Neither is dvg_state, which belongs to core 1 and would
+ * be copied torn while it decodes; every list the game draws starts
+ * with LABS and sets position and scale again. Call on core 0 between
+ * slices, or before the emulation task starts. A load resumes at the
+ * saved master cycle, which lies just past a frame end (the last
+ * instruction overshoots it); frame timing continues from that frame
+ * end, so the slices, and with them the point where core 1 picks up
+ * each list, stay the same as in the original run.
+ * Bump SAVESTATE_VERSION whenever a field changes.
+ */
+
+#define SAVESTATE_MAGIC    0x53545341   // "ASTS"
+#define SAVESTATE_VERSION  3
+
+struct savestate_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t size;         // Payload bytes after the header
+    uint32_t checksum;     // FNV-1a of the payload
+};
+
+// Staging for state that is not plain memory
+static mos6502::State savestate_cpu;
+static uint32_t savestate_list_cycles;
+
+static const struct {
+    void*    data;
+    uint16_t size;
+} savestate_fields[] = {
+    { &savestate_cpu,          sizeof(savestate_cpu) },   // Also holds the master cycle count
+    { sched_when,              sizeof(sched_when) },
+    { &dvg_halt_cycle,         sizeof(dvg_halt_cycle) },
+    { (void*)&dvg_busy,        sizeof(dvg_busy) },
+    { &savestate_list_cycles,  sizeof(savestate_list_cycles) },
+    { &dip_switches,           sizeof(dip_switches) },
+    { &clock_3khz,             sizeof(clock_3khz) },
+    { ram,                     sizeof(ram) },
+    { vector_ram,              sizeof(vector_ram) },
+};
+
+#define SAVESTATE_FIELDS (sizeof(savestate_fields) / sizeof(savestate_fields[0]))
+
+static uint32_t savestate_checksum(const uint8_t* data, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ data[i]) * 16777619u;
+    return h;
+}
+
+// Bytes of a complete image
+size_t savestate_size() {
+    size_t size = sizeof(savestate_header);
+    for (size_t i = 0; i < SAVESTATE_FIELDS; i++) size += savestate_fields[i].size;
+    return size;
+}
+
+// Write the current state to 'buf'. Returns the image size, or 0 if
+// 'cap' is too small
+size_t savestate_save(uint8_t* buf, size_t cap) {
+    size_t size = savestate_size();
+    if (cap < size) return 0;
+    
+    cpu->GetState(savestate_cpu);
+    savestate_list_cycles = dvg_list_cycles.load(std::memory_order_relaxed);
+    
+    uint8_t* p = buf + sizeof(savestate_header);
+    for (size_t i = 0; i < SAVESTATE_FIELDS; i++) {
+        memcpy(p, savestate_fields[i].data, savestate_fields[i].size);
+        p += savestate_fields[i].size;
+    }
+    
+    savestate_header h = { SAVESTATE_MAGIC, SAVESTATE_VERSION, 0, 0, 0 };
+    h.size = size - sizeof(h);
+    h.checksum = savestate_checksum(buf + sizeof(h), h.size);
+    memcpy(buf, &h, sizeof(h));
+    return size;
+}
+
+// Replace the machine state with the image in 'buf'. Leaves the state
+// untouched and returns false if the image is damaged or from another
+// version
+bool savestate_load(const uint8_t* buf, size_t len) {
+    savestate_header h;
+    if (len < sizeof(h)) return false;
+    memcpy(&h, buf, sizeof(h));
+    
+    if (h.magic != SAVESTATE_MAGIC || h.version != SAVESTATE_VERSION ||
+        h.size != savestate_size() - sizeof(h) || len < savestate_size()) {
+        Serial.printf("[savestate] Rejected: magic 0x%08X, version %u, %u bytes\n",
+                      h.magic, h.version, h.size);
+        return false;
+    }
+    if (savestate_checksum(buf + sizeof(h), h.size) != h.checksum) {
+        Serial.println("[savestate] Rejected: checksum mismatch");
+        return false;
+    }
+    
+    const uint8_t* p = buf + sizeof(h);
+    for (size_t i = 0; i < SAVESTATE_FIELDS; i++) {
+        memcpy(savestate_fields[i].data, p, savestate_fields[i].size);
+        p += savestate_fields[i].size;
+    }
+    
+    cpu->SetState(savestate_cpu);
+    total_cpu_cycles = savestate_cpu.cycles;
+    dvg_list_cycles.store(savestate_list_cycles, std::memory_order_relaxed);
+    
+    // The DIP switches come with the image; the buttons stay as sampled
+    uint32_t ports = input_ports.load(std::memory_order_relaxed);
+    input_ports.store((ports & 0xFFFF) | ((uint32_t)dip_switches << 16), std::memory_order_relaxed);
+    return true;
+}
+
+#if SAVESTATE_BOOT && !defined(ASTEROIDINO_NATIVE)
+// Boot image in LittleFS (see config.h)
+static bool savestate_boot_load() {
+    if (!LittleFS.begin(true)) return false;
+    File f = LittleFS.open(SAVESTATE_FILE, "r");
+    if (!f) return false;
+    
+    size_t size = savestate_size();
+    uint8_t* buf = (uint8_t*)malloc(size);
+    bool ok = buf && f.read(buf, size) == size && savestate_load(buf, size);
+    free(buf);
+    f.close();
+    return ok;
+}
+
+static void savestate_boot_store() {
+    size_t size = savestate_size();
+    uint8_t* buf = (uint8_t*)malloc(size);
+    if (!buf) return;
+    savestate_save(buf, size);
+    
+    File f = LittleFS.open(SAVESTATE_FILE, "w");
+    bool ok = f && f.write(buf, size) == size;
+    if (f) f.close();
+    free(buf);
+    Serial.printf("[savestate] %s %s (%u bytes)\n",
+                  ok ? "Stored" : "Failed to store", SAVESTATE_FILE, size);
+}
+#endif
+
+// ============================================================================
+// REWIND (lib/rewind)
+// ============================================================================
+
+/*
+ * Core 0 calls rewind_frame() at the start of every frame. It records
+ * the input ports when they change and every REWIND_INTERVAL_FRAMES a
+ * savestate image into the ring. rewind_seek() loads the newest
+ * snapshot at or before a frame; from there the following frames take
+ * their inputs from the ring instead of the buttons (input_publish()
+ * holds off) until the newest record is reached, so the run after a
+ * seek is the recorded one again and recording carries on seamlessly.
+ * A seek moves total_cpu_cycles back to the snapshot; rewind_frame()
+ * returns true then, and the caller restarts its frame end from there.
+ * On the cabinet the buttons are sampled by a timer, so the ports can
+ * change within a frame; the recorded value is the one at the frame
+ * start, which makes the replay exact only up to that.
+ */
+
+#if REWIND_ENABLE
+RewindRing rewind_ring;
+static uint8_t* rewind_image = nullptr;    // savestate_size() bytes
+uint32_t rewind_frames = 0;                // Frame about to start
+static uint32_t rewind_ports = 0;          // Last recorded input ports
+static bool rewind_have_ports = false;
+static uint32_t rewind_resets = 0;         // watchdog_resets already seen
+static bool rewind_was_frozen = false;
+
+// The inputs come from the ring (written by core 0, read by the timer)
+std::atomic<bool> rewind_replaying(false);
+
+// Console: frames to go back (0 = none), and recording on hold
+std::atomic<uint32_t> rewind_request(0);
+std::atomic<bool> rewind_frozen(false);
+
+void rewind_begin() {
+    size_t size = savestate_size();
+    rewind_image = (uint8_t*)malloc(size);
+    if (!rewind_image || !rewind_ring.begin(REWIND_BYTES, REWIND_PSRAM_BYTES, size,
+                                            REWIND_KEY_INTERVAL)) {
+        Serial.println("[rewind] Not enough memory, rewind disabled");
+        free(rewind_image);
+        rewind_image = nullptr;
+        return;
+    }
+    Serial.printf("[rewind] %u KB in %s, snapshot every %u frames, key every %u, %u bytes/image\n",
+                  (unsigned)(rewind_ring.capacity / 1024), rewind_ring.in_psram ? "PSRAM" : "heap",
+                  REWIND_INTERVAL_FRAMES, REWIND_KEY_INTERVAL, (unsigned)size);
+}
+
+// Load the newest snapshot at or before 'frame' and replay from there.
+// Returns the snapshot's frame, or UINT32_MAX if the ring does not
+// reach back that far.
+uint32_t rewind_seek(uint32_t frame) {
+    uint32_t at, ports;
+    if (!rewind_image || !rewind_ring.restore(frame, rewind_image, &at, &ports) ||
+        !savestate_load(rewind_image, savestate_size())) {
+        return UINT32_MAX;
+    }
+    rewind_frames = at;
+    rewind_ports = ports;
+    rewind_replaying.store(true, std::memory_order_relaxed);
+    input_ports.store(ports, std::memory_order_relaxed);
+    return at;
+}
+
+// Start of a frame on core 0. True if a requested seek moved the master
+// cycle back to a snapshot, so the frame ends must be recomputed.
+bool rewind_frame() {
+    if (!rewind_image) return false;
+    
+    bool moved = false;
+    uint32_t back = rewind_request.exchange(0);
+    if (back) {
+        uint32_t at = rewind_seek(rewind_frames > back ? rewind_frames - back : 0);
+        moved = at != UINT32_MAX;
+        Serial.printf("[rewind] %s\n", moved ? "Replaying from the snapshot" : "Out of range");
+    }
+    
+    if (rewind_replaying.load(std::memory_order_relaxed)) {
+        uint32_t ports = rewind_ports;
+        bool replaying = rewind_ring.replay(rewind_frames, &ports);
+        if (ports != rewind_ports) {
+            rewind_ports = ports;
+            input_ports.store(ports, std::memory_order_relaxed);
+        }
+        if (replaying) {
+            rewind_frames++;
+            return moved;
+        }
+        rewind_replaying.store(false, std::memory_order_relaxed);
+    }
+    
+#if REWIND_FREEZE_ON_RESET
+    if (watchdog_resets != rewind_resets) {
+        rewind_resets = watchdog_resets;
+        if (!rewind_frozen.exchange(true)) {
+            Serial.printf("[rewind] Watchdog reset at frame %u, ring frozen\n", rewind_frames);
+        }
+    }
+#endif
+    
+    bool frozen = rewind_frozen.load(std::memory_order_relaxed);
+    if (frozen != rewind_was_frozen) {
+        // Recording resumes on a fresh ring: the frozen stretch has no inputs
+        rewind_was_frozen = frozen;
+        if (!frozen) {
+            rewind_ring.clear();
+            rewind_have_ports = false;
+        }
+    }
+    if (!frozen) {
+        uint32_t ports = input_ports.load(std::memory_order_relaxed);
+        if (!rewind_have_ports || ports != rewind_ports) {
+            rewind_ring.input(rewind_frames, ports);
+            rewind_ports = ports;
+            rewind_have_ports = true;
+        }
+        if (rewind_frames % REWIND_INTERVAL_FRAMES == 0) {
+            savestate_save(rewind_image, savestate_size());
+            rewind_ring.push(rewind_frames, ports, rewind_image);
+        }
+    }
+    rewind_frames++;
+    return moved;
+}
+#else
+void rewind_begin() {}
+bool rewind_frame() { return false; }
+uint32_t rewind_seek(uint32_t) { return UINT32_MAX; }
+#endif
+
+// ============================================================================
+// MEMORY ACCESS (called by CPU emulator)
+// ============================================================================
+
+// Slow path for CPU pages that are not direct-mapped (see memory_map_init).
+// During emulation only the I/O pages 0x2000-0x3FFF and unmapped space
+// reach this function.
+uint8_t cpu6502_read_callback(uint16_t addr) {
+    PROF_SCOPE(PROF_BUS);
+    
+    // RAM: 0x0000-0x0FFF
+    if (addr < 0x1000) {
+        return ram[addr];
+    }
+    
+    // Vector RAM: 0x4000-0x47FF
+    if (addr >= 0x4000 && addr < 0x4800) {
+        return vector_ram[addr - 0x4000];
+    }
+    
+    // Input ports: 0x2000-0x2FFF
+    // IN0: 0x2000-0x2007 (each address bit-selects one input)
+    if (addr >= 0x2000 && addr < 0x2008) {
+        // Button bits 3 (hyperspace) and 4 (fire) as published
+        uint8_t in0 = input_ports.load(std::memory_order_relaxed) & 0xFF;
+        // Bit 5: Diagnostic Step (not implemented)
+        // Bit 6: TILT (not implemented)
+        // Bit 7: Self-Test Switch - Always 0 for normal gameplay
+        
+        // NORMAL GAMEPLAY MODE: bit 7 = 0
+        // Leave bit 7 = 0 to run normal game code
+        //
+        // Reset handler at 0x7D08:
+        //   LDY $2007    ; Load IN0 bit 7
+        //   BMI L7D50    ; If bit 7=1, branch to self-test
+        //   Falls through to JMP $6803 (normal game init at 0x6803)
+        //
+        // With NMI disabled, the main game code should be able to run
+        // and eventually write to DVG GO (0x3000)
+        // Bit 7 = 0 (normal mode, NOT self-test)
+        
+        // Bit 1: 3 kHz clock (12.096 MHz / 4096 = 512 CPU cycles)
+        uint64_t now = sched_now();
+        clock_3khz = (now & 0x100) ? true : false;
+        if (clock_3khz) in0 |= 0x02;
+        
+        // Bit 2: DVG HALT (ACTIVE-LOW per schematics)
+        // HALT=0 → DVG is DONE/ready (signal LOW)
+        // HALT=1 → DVG is BUSY (signal HIGH)
+        //
+        // ROM at PC=0x6815: LDA $0x2002; BMI loop
+        // - Reads bit 2 of IN0, returns as bit 7 of result
+        // - BMI branches if bit 7=1 (negative)
+        // - Waits until bit 7=0 (positive) to continue
+        //
+        // Bit-select logic: bit_value = (in0 >> 2) & 0x01
+        //                   result = bit_value ? 0x80 : 0x7F
+        //
+        // For DVG DONE (HALT=0, active-low):
+        //   bit 2 = 0 → bit_value=0 → result=0x7F (positive) → ROM exits loop ✓
+        //
+        // For DVG BUSY (HALT=1):
+        //   bit 2 = 1 → bit_value=1 → result=0x80 (negative) → ROM loops ✓
+        //
+        // DVG state: dvg_busy is core 0's view of the DVG (see DVG PIPELINE);
+        //            dvg_state itself belongs to core 1
+        if (dvg_busy && now < dvg_halt_cycle) {
+            // DVG is actively RUNNING - HALT signal is HIGH (busy)
+            // Set bit 2 = 1
+            in0 |= 0x04;
+        }
+        // else: DVG is DONE (halted) - leave bit 2 = 0
+        
+        // Each address bit selects which bit to return in bit 7
+        uint8_t bit_select = addr & 0x07;
+        uint8_t bit_value = (in0 >> bit_select) & 0x01;
+        
+        // MAME logic: if bit set, return 0x80, else return ~0x80 (0x7F)
+        uint8_t result = bit_value ? 0x80 : 0x7F;
+        
+        TRACE(TRACE_IO, TRACE_EV_IO_READ, cpu->GetPC(), addr, result);
+        return result;
+    }
+    
+    // IN1: 0x2400-0x2407 (player controls, layout in input_buttons[])
+    if (addr >= 0x2400 && addr < 0x2408) {
+        uint32_t ports = input_ports.load(std::memory_order_relaxed);
+        uint8_t result = (ports >> (8 + (addr & 0x07))) & 0x01 ? 0x80 : 0x7F;
+        
+        TRACE(TRACE_IO, TRACE_EV_IO_READ, cpu->GetPC(), addr, result);
+        return result;
+    }
+    
+    // DSW1: 0x2800-0x2803 (DIP switches)
+    if (addr >= 0x2800 && addr < 0x2804) {
+        // Real hardware uses 74LS153 multiplexer controlled by offset:
+        // the selected switch pair in bits 0 and 1
+        uint32_t ports = input_ports.load(std::memory_order_relaxed);
+        uint8_t result = 0xFC | ((ports >> (16 + (addr & 0x03) * 2)) & 0x03);
+        
+        TRACE(TRACE_IO, TRACE_EV_IO_READ, cpu->GetPC(), addr, result);
+        return result;
+    }
+    
+    // ROM: vector ROM 0x5000-0x57FF, program ROM 0x6800-0x7FFF and their
+    // mirrors above 0x8000 (normally direct-mapped, see MEMORY MAP)
+    if (const uint8_t* rom = rom_ptr(addr)) {
+        return *rom;
+    }
+    
+    return 0xFF;
+}
+
+void cpu6502_write_callback(uint16_t addr, uint8_t value) {
+    PROF_SCOPE(PROF_BUS);
+    
+    // RAM: 0x0000-0x0FFF (only zero page is routed here by the memory map)
+    if (addr < 0x1000) {
+        if (addr == TRACE_ZP_ADDR) {
+            TRACE(TRACE_ZP, TRACE_EV_ZP_WRITE, cpu->GetPC(), addr, (ram[addr] << 8) | value);
+        }
         
         // WORKAROUND: ZP[0x5B] Frame Throttle Counter
         // The ROM increments this every 4 frames in the NMI handler at 0x7B7B
@@ -668,8 +1906,7 @@ void cpu6502_write_callback(uint16_t addr, uint8_t value) {
         // No code in ROM resets it, so we do it here to prevent infinite loop
         // This counter likely synchronizes with DVG frame completion or similar hardware timing
         if (addr == 0x5B && value >= 4) {
-            Serial.printf("*** WORKAROUND: ZP[0x5B] reached %d, resetting to 0 (PC=0x%04X)\n", 
-                         value, cpu->GetPC());
+            TRACE(TRACE_ZP, TRACE_EV_ZP_RESET, cpu->GetPC(), addr, value);
             value = 0;  // Reset to allow game loop to continue
         }
         
@@ -679,80 +1916,38 @@ void cpu6502_write_callback(uint16_t addr, uint8_t value) {
     
     // Vector RAM: 0x4000-0x47FF
     if (addr >= 0x4000 && addr < 0x4800) {
-        static int write_count = 0;
-        if (write_count++ < 100) {  // Show first 100 writes instead of 10
-            Serial.printf("*** Vector RAM write [%d]: 0x%04X = 0x%02X\n", write_count, addr, value);
-        }
+        TRACE(TRACE_VRAM, TRACE_EV_VRAM_WRITE, cpu->GetPC(), addr - 0x4000, value);
         vector_ram[addr - 0x4000] = value;
         return;
     }
     
-    // I/O Write Ports
-    
-    // Monitor all writes to 0x3000-0x3FFF range (ALL of them now!)
-    static int write_3xxx_count = 0;
-    if (addr >= 0x3000 && addr < 0x4000) {
-        write_3xxx_count++;
-        if (write_3xxx_count <= 50) {  // Show first 50
-            Serial.printf("*** WRITE [%d]: addr=0x%04X, value=0x%02X, PC=0x%04X\n", 
-                         write_3xxx_count, addr, value, cpu->GetPC());
-        }
-    }
+    // I/O Write Ports: 0x3000-0x3FFF
+    TRACE(TRACE_IO, TRACE_EV_IO_WRITE, cpu->GetPC(), addr, value);
     
     // DVG GO command: 0x3000
     if (addr == 0x3000) {
-        static int go_count = 0;
-        go_count++;
-        
         extern int dvg_frame_count;
         dvg_frame_count++;  // Increment here where DVG actually runs!
         
-        // ALWAYS show DVG GO with more context
-        Serial.printf("\n*** DVG GO [%d] WRITE! ***\n", go_count);
-        Serial.printf("    PC=0x%04X, value=0x%02X\n", cpu->GetPC(), value);
-        
-        // Show first 64 bytes of Vector RAM
-        if (go_count <= 2) {
-            Serial.printf("    VRAM DUMP (first 64 bytes):\n");
-            for (int i = 0; i < 64; i += 8) {
-                Serial.printf("    %04X: %02X %02X %02X %02X  %02X %02X %02X %02X\n", 
-                             i,
-                             vector_ram[i], vector_ram[i+1], vector_ram[i+2], vector_ram[i+3],
-                             vector_ram[i+4], vector_ram[i+5], vector_ram[i+6], vector_ram[i+7]);
-            }
-        } else {
-            Serial.printf("    VRAM[0..7]: %02X %02X %02X %02X  %02X %02X %02X %02X\n",
-                         vector_ram[0], vector_ram[1], vector_ram[2], vector_ram[3],
-                         vector_ram[4], vector_ram[5], vector_ram[6], vector_ram[7]);
-        }
-        
-        // Start DVG processing from address in 'value'
-        // In Asteroids, the value written is typically 0x00 (start from beginning)
-        dvg_state.pc = (value & 0x0F) << 8;  // Only low 4 bits used as high address bits
-        dvg_state.running = true;
-        dvg_state.halt = false;
-        dvg_state.stack_ptr = 0;
-        dvg_state.state_latch = 0x00;  // PROM: Initial state
-        dvg_state.op = 0;
-        dvg_state.data = 0;
-        dvg_state.dvx = 0;
-        dvg_state.dvy = 0;
+        TRACE(TRACE_DVG, TRACE_EV_DVG_GO, cpu->GetPC(), dvg_frame_count, value);
         
-        // Clear previous vector buffer
-        vector_buffer.count = 0;
+        // Hand the list to core 1; vector RAM is free again right away
+        dvg_post_snapshot(value);
         
-        // Run the DVG state machine
-        dvg_run_state_machine();
+#if DVG_BUSY_TIMING
+        // HALT is raised once the beam time of the list has passed. Core 1
+        // decodes in parallel, so the newest list it finished stands in for
+        // this one (consecutive lists are nearly the same length)
+        dvg_busy = true;
+        dvg_halt_cycle = sched_now() + dvg_list_cycles.load(std::memory_order_relaxed);
+        sched_post(SCHED_DVG_HALT, dvg_halt_cycle);
+#endif
         
         return;
     }
     
     // Output latch: 0x3200 (coin counters, LEDs)
     if (addr == 0x3200) {
-        static int latch_count = 0;
-        if (latch_count++ < 5) {
-            Serial.printf("*** Output latch write: 0x%02X\n", value);
-        }
         // Bit 0: Right coin counter
         // Bit 1: Center coin counter  
         // Bit 2: Left coin counter
@@ -763,311 +1958,577 @@ void cpu6502_write_callback(uint16_t addr, uint8_t value) {
     // Watchdog reset: 0x3400
     if (addr == 0x3400) {
         // Watchdog is reset by any write to this address
-        // We don't need to implement actual watchdog for emulation
+#if EMU_WATCHDOG_CYCLES
+        sched_post(SCHED_WATCHDOG, sched_now() + EMU_WATCHDOG_CYCLES);
+#endif
         return;
     }
     
-    // Explosion sound: 0x3600
-    if (addr == 0x3600) {
-        static int explode_count = 0;
-        if (explode_count++ < 3) {
-            Serial.printf("*** Explosion sound: 0x%02X\n", value);
-        }
-        // Bits 2-5: Volume (0-15)
-        // Bits 6-7: Pitch select
-        // TODO: Implement sound
+    // Sound latches: queued with their cycle, rendered on core 1
+    // 0x3600 explosion: bits 2-5 volume, bits 6-7 pitch
+    // 0x3A00 thump: bit 4 enable, bits 0-3 frequency
+    // 0x3C00-0x3C07 LS259, bit 7 = output 'addr & 7': saucer, saucer
+    //               fire, saucer select, thrust, ship fire, extra life
+    // 0x3E00 noise reset
+    if (addr == 0x3600 || addr == 0x3A00 || addr == 0x3E00 ||
+        (addr >= 0x3C00 && addr < 0x3C08)) {
+        sound_write(addr, value, (uint32_t)sched_now());
         return;
     }
-    
-    // Thump sound: 0x3A00
-    if (addr == 0x3A00) {
-        static int thump_count = 0;
-        if (thump_count++ < 3) {
-            Serial.printf("*** Thump sound: 0x%02X\n", value);
-        }
-        // Bit 4: Enable
-        // Bits 0-3: Frequency
-        // TODO: Implement sound
-        return;
+}
+
+// ============================================================================
+// IDLE LOOPS (fast-forward, see mos6502::SetIdleCheck)
+// ============================================================================
+
+// The CPU core has already seen one pass of the loop leave the registers
+// unchanged; return how many cycles further passes are guaranteed to be
+// no-ops, 0 if they might not be
+int32_t emu_idle_check(mos6502* c, uint16_t target, uint16_t branch) {
+    // Main loop 0x680C: LDA $2007 / BMI / LSR $5B / BCC 0x680C waits for
+    // the NMI handler to set ZP[0x5B]. Once ZP[0x5B] is 0 every pass
+    // only rewrites 0, until the next NMI
+    if (target == 0x680C && branch == 0x6813) {
+        return (ram[0x5B] == 0) ? INT32_MAX : 0;
     }
     
-    // Audio latch (LS259): 0x3C00-0x3C07
-    if (addr >= 0x3C00 && addr < 0x3C08) {
-        static int audio_count = 0;
-        if (audio_count++ < 5) {
-            Serial.printf("*** Audio latch [%d]: bit %d = %d\n", 
-                         audio_count, addr & 0x07, (value >> 7) & 0x01);
+    // Port poll: LDA port / Bxx back (0x6815: LDA $2002 / BMI waits for
+    // DVG halt). The 3 kHz clock and DVG halt change at known cycles,
+    // buttons are sampled by the input timer at any time
+    int32_t port = c->PollAddress(target, branch);
+    if (port >= 0x2000 && port < 0x2008) {
+        uint64_t now = c->GetCycles();
+        switch (port & 0x07) {
+            case 1:  return 0x100 - (now & 0xFF);     // Next 3 kHz edge
+            case 2:  return (dvg_busy && now < dvg_halt_cycle) ?
+                            (int32_t)(dvg_halt_cycle - now) : INT32_MAX;
+            case 3:
+            case 4:  return 0;                        // Buttons (input timer)
+            default: return INT32_MAX;                // Constant
         }
-        // Bit 0: Saucer sound enable
-        // Bit 1: Saucer fire enable
-        // Bit 2: Saucer select (big/small)
-        // Bit 3: Thrust sound enable
-        // Bit 4: Ship fire enable
-        // Bit 5: Extra life sound enable
-        // TODO: Implement sound
-        return;
     }
     
-    // Noise reset: 0x3E00
-    if (addr == 0x3E00) {
-        // Reset noise generator
-        // TODO: Implement sound
-        return;
-    }
+    return 0;
+}
+
+#if TRACE_CATEGORIES & TRACE_CPU
+// Clock-cycle callback: runs once per cycle after each instruction, so
+// only the first call with a new PC is recorded, i.e. the next
+// instruction with the registers it starts from (a jump to itself shows
+// up once)
+void trace_cpu_cycle(mos6502* c) {
+    static uint16_t last_pc = 0xFFFF;
+    uint16_t pc = c->GetPC();
+    if (pc == last_pc) return;
+    last_pc = pc;
+    TRACE(TRACE_CPU, TRACE_EV_INSN, pc, (c->GetX() << 8) | c->GetA(), (c->GetY() << 8) | c->GetP());
 }
+#endif
 
 // ============================================================================
-// INPUT HANDLING
+// MEMORY MAP (direct-mapped CPU pages)
 // ============================================================================
 
-void read_buttons() {
-    buttons.rotate_left  = !digitalRead(BTN_LEFT_PIN);
-    buttons.rotate_right = !digitalRead(BTN_RIGHT_PIN);
-    buttons.thrust       = !digitalRead(BTN_UP_PIN);
-    buttons.hyperspace   = !digitalRead(BTN_DOWN_PIN);
-    buttons.fire         = !digitalRead(BTN_FIRE_PIN);
-    buttons.start        = !digitalRead(BTN_START_PIN);
-    buttons.coin         = !digitalRead(BTN_COIN_PIN);
+// Point the CPU page table at RAM and ROM so opcode fetches and data
+// accesses there are a pointer dereference. Only the I/O pages
+// 0x2000-0x3FFF (IN0/IN1/DSW, DVG GO, latches, sound), zero page writes
+// (ZP[0x5B] workaround) and unmapped space use the bus callbacks.
+// Tracing VRAM writes routes them through the callback as well.
+void memory_map_init() {
+    cpu->MapReadPages(0x00, MEM_SIZE_RAM >> 8, ram);
+    cpu->MapWritePages(0x01, (MEM_SIZE_RAM >> 8) - 1, ram + 0x100);
+    
+    cpu->MapReadPages(0x40, MEM_SIZE_VECTOR >> 8, vector_ram);
+#if !(TRACE_CATEGORIES & TRACE_VRAM)
+    cpu->MapWritePages(0x40, MEM_SIZE_VECTOR >> 8, vector_ram);
+#endif
+    
+    // Vector and program ROM with their A15 mirrors
+    cpu->MapReadPages(ROM_VECTOR_BASE >> 8, ROM_VECTOR_SIZE >> 8, rom_vector);
+    cpu->MapReadPages(ROM_PROGRAM_BASE >> 8, ROM_PROGRAM_SIZE >> 8, rom_program);
+    cpu->MapReadPages((ROM_VECTOR_BASE | 0x8000) >> 8, ROM_VECTOR_SIZE >> 8, rom_vector);
+    cpu->MapReadPages((ROM_PROGRAM_BASE | 0x8000) >> 8, ROM_PROGRAM_SIZE >> 8, rom_program);
+    
+#if CPU_USE_SWITCH_CORE && CPU_PREDECODE
+    // All game code runs from the program ROM (reset and NMI vectors
+    // point below 0x8000); the mirror is only read for the vectors
+    cpu->SetPredecode(ROM_PROGRAM_BASE, ROM_PROGRAM_SIZE);
+#endif
 }
 
 // ============================================================================
-// VECTOR DISPLAY
+// INPUT HANDLING
 // ============================================================================
 
-// ============================================================================
-// VECTOR DISPLAY - DVG EMULATION
-// ============================================================================
+/*
+ * The buttons are sampled every BTN_DEBOUNCE_MS / 4 by an esp_timer,
+ * both GPIO banks with one register read each, and debounced with a
+ * 2-bit vertical counter: a button changes state after four samples in
+ * a row that disagree with it. Each sample publishes the finished
+ * IN0/IN1/DSW1 bytes with one atomic store, so a CPU port read is a
+ * load and a bit select.
+ */
 
-// Scale lookup table (approximated from MAME)
-static const int scale_table[16] = {
-    0, 1, 2, 3, 4, 5, 6, 8, 10, 12, 16, 20, 24, 32, 48, 64
+static const struct {
+    uint8_t pin;
+    uint8_t port;   // 0 = IN0, 1 = IN1
+    uint8_t bit;
+} input_buttons[] = {
+    { BTN_LEFT_PIN,  1, 0x80 },   // IN1 bit 7
+    { BTN_RIGHT_PIN, 1, 0x40 },   // IN1 bit 6
+    { BTN_UP_PIN,    1, 0x20 },   // IN1 bit 5: thrust
+    { BTN_DOWN_PIN,  0, 0x08 },   // IN0 bit 3: hyperspace
+    { BTN_FIRE_PIN,  0, 0x10 },   // IN0 bit 4
+    { BTN_START_PIN, 1, 0x08 },   // IN1 bit 3: start 1
+    { BTN_COIN_PIN,  1, 0x01 },   // IN1 bit 0: coin 1
 };
+#define INPUT_BUTTONS (sizeof(input_buttons) / sizeof(input_buttons[0]))
 
-void dvg_reset() {
-    dvg_state.pc = 0;
-    dvg_state.x = 512;  // Center of screen (1024x1024 coordinate system)
-    dvg_state.y = 512;
-    dvg_state.scale = 0;
-    dvg_state.intensity = 7;
-    dvg_state.stack_ptr = 0;
-    dvg_state.halt = false;
-}
+static uint8_t input_pressed = 0;       // Debounced state
+static uint8_t input_ct0 = 0, input_ct1 = 0;
+static unsigned long input_start_ms = 0;
 
-void dvg_add_point(int16_t x, int16_t y, uint8_t intensity) {
-    if (vector_buffer.count >= VECT_POINTS_PER_FRAME) return;
+// Build and publish the port bytes for a set of pressed buttons
+void input_publish(uint8_t pressed) {
+    uint8_t in[2] = { 0, 0 };
+    for (unsigned i = 0; i < INPUT_BUTTONS; i++) {
+        if (pressed & (1 << i)) in[input_buttons[i].port] |= input_buttons[i].bit;
+    }
     
-    // Convert from DVG coords (0-1023) to DAC coords (0-4095)
-    // DVG uses signed offsets, we need to clamp and scale
-    int16_t dac_x = (x * 4095) / 1023;
-    int16_t dac_y = (y * 4095) / 1023;
+#if INPUT_AUTO_START
+    // Coin after 2 s and start after 4 s, for cabinets without the buttons
+    unsigned long t = millis() - input_start_ms;
+    if (t >= 2000 && t < 4000) in[1] |= 0x01;
+    if (t >= 4000 && t < 6000) in[1] |= 0x08;
+#endif
     
-    // Clamp to valid range
-    if (dac_x < 0) dac_x = 0;
-    if (dac_x > 4095) dac_x = 4095;
-    if (dac_y < 0) dac_y = 0;
-    if (dac_y > 4095) dac_y = 4095;
+#if REWIND_ENABLE
+    // A rewind replay feeds the recorded ports instead
+    if (rewind_replaying.load(std::memory_order_relaxed)) return;
+#endif
     
-    // CSV logging of actual DAC output (first 5000 points)
-    static int dac_log_count = 0;
-    static bool dac_csv_header = false;
+    input_ports.store(in[0] | (in[1] << 8) | ((uint32_t)dip_switches << 16),
+                      std::memory_order_relaxed);
+}
+
+// Sample all buttons once, debounce, publish
+void read_buttons() {
+#ifdef ASTEROIDINO_NATIVE
+    uint64_t levels = 0;
+    for (unsigned i = 0; i < INPUT_BUTTONS; i++) {
+        if (digitalRead(input_buttons[i].pin)) levels |= 1ull << input_buttons[i].pin;
+    }
+#else
+    uint64_t levels = REG_READ(GPIO_IN_REG) | ((uint64_t)REG_READ(GPIO_IN1_REG) << 32);
+#endif
     
-    if (dac_log_count < 5000) {
-        if (!dac_csv_header) {
-            Serial.println("\n=== DVG OUTPUT (10-bit coords, 4-bit intensity) ===");
-            Serial.println("X,Y,Intensity");
-            dac_csv_header = true;
-        }
-        
-        Serial.printf("%d,%d,%d\n", x, y, intensity);
-        dac_log_count++;
+    // Pull-ups: a pressed button reads low
+    uint8_t sample = 0;
+    for (unsigned i = 0; i < INPUT_BUTTONS; i++) {
+        if (!((levels >> input_buttons[i].pin) & 1)) sample |= 1 << i;
     }
     
-    vector_buffer.points[vector_buffer.count][0] = dac_x;
-    vector_buffer.points[vector_buffer.count][1] = dac_y;
-    vector_buffer.intensity[vector_buffer.count] = (intensity * 255) / 15;
-    vector_buffer.count++;
+    uint8_t delta = sample ^ input_pressed;
+    input_ct1 = (input_ct1 ^ input_ct0) & delta;
+    input_ct0 = ~input_ct0 & delta;
+    input_pressed ^= delta & ~(input_ct0 | input_ct1);
+    
+    input_publish(input_pressed);
 }
 
-uint16_t dvg_read_word(uint16_t addr) {
-    // Vector RAM is at 0x4000-0x47FF (2KB)
-    if (addr >= 0x7FF) return 0;
-    // Words are stored little-endian
-    uint16_t lo = vector_ram[addr];
-    uint16_t hi = vector_ram[addr + 1];
-    return (hi << 8) | lo;
+#ifndef ASTEROIDINO_NATIVE
+static void input_timer(void*) {
+    read_buttons();
 }
+#endif
 
-void dvg_execute() {
-    dvg_reset();
-    vector_buffer.count = 0;
-    
-    // Debug: Check if vector RAM has data
-    static bool first_time = true;
-    if (first_time) {
-        first_time = false;
-        Serial.println("Vector RAM first 32 bytes:");
-        for (int i = 0; i < 32; i++) {
-            Serial.printf("%02X ", vector_ram[i]);
-            if ((i + 1) % 16 == 0) Serial.println();
+// Configure the pins and start the sampler
+void input_begin() {
+    for (unsigned i = 0; i < INPUT_BUTTONS; i++) {
+        pinMode(input_buttons[i].pin, INPUT_PULLUP);
+    }
+    input_start_ms = millis();
+    input_publish(0);
+    
+#ifndef ASTEROIDINO_NATIVE
+    const esp_timer_create_args_t args = { input_timer, nullptr, ESP_TIMER_TASK, "input" };
+    esp_timer_handle_t timer;
+    if (esp_timer_create(&args, &timer) == ESP_OK) {
+        esp_timer_start_periodic(timer, BTN_DEBOUNCE_MS * 1000 / 4);
+    } else {
+        Serial.println("*** Input timer could not be created");
+    }
+#endif
+}
+
+// ============================================================================
+// VECTOR DISPLAY
+// ============================================================================
+
+void render_vectors() {
+    PROF_SCOPE(PROF_RENDER);
+    
+    // Rasterize a new front list once; the raster frame is then replayed
+    // over blocking SPI or handed to the DMA engine
+    if (vector_front_dirty) {
+#if VECT_OPTIMIZE
+        // Unchanged list: the optimizer output and raster frame still hold
+        vector_opt.optimize(vector_front->points, vector_front->count);
+        if (!vector_opt.cached) raster_stale = true;
+#else
+        raster_stale = true;
+#endif
+        vector_front_dirty = false;
+    }
+    if (raster_stale) {
+#if VECT_OPTIMIZE
+        vector_raster.rasterize(vector_opt.points, vector_opt.count, display_gov.max_points);
+#else
+        vector_raster.rasterize(vector_front->points, vector_front->count, display_gov.max_points);
+#endif
+        raster_stale = false;
+        raster_dirty = true;
+    }
+    const RasterFrame& f = vector_raster.frame;
+    
+#if VECT_USE_DMA
+    // The DMA engine replays the last frame by itself
+    if (vector_dma) {
+        if (raster_dirty && vector_dac.beginFrame()) {
+            for (int i = 0; i < f.count; i++) {
+                vector_dac.addPacked(f.xy[i], f.z[i]);
+            }
+            vector_dac.endFrame();
+            raster_dirty = false;
         }
+        uint32_t draw_us = (uint32_t)((uint64_t)f.count * 1000000 / max(vector_dac.pointRate(), 1u));
+        if (display_gov.update(draw_us, f.count, f.wanted)) raster_stale = true;
+        return;
     }
+#endif
     
-    // DVG starts at address 0 in vector RAM
-    int max_ops = 10000;  // Safety limit
+    // Points are evenly spaced, so a fixed dwell gives even brightness
+    unsigned long start = micros();
+    uint8_t dwell = display_gov.dwell_us;
+    int z = -1;
+    for (int i = 0; i < f.count; i++) {
+        if (f.z[i] != z) {
+            z = f.z[i];
+            vector_dac.setIntensity(z);
+        }
+        vector_dac.setXYPacked(f.xy[i]);
+        delayMicroseconds(dwell);
+    }
+    raster_dirty = false;
     
-    while (!dvg_state.halt && max_ops-- > 0) {
-        uint16_t opcode = dvg_read_word(dvg_state.pc);
-        dvg_state.pc += 2;
-        
-        // Decode opcode (see MAME avgdvg.cpp for reference)
-        uint8_t op = (opcode >> 12) & 0x0F;
+    // A new point budget takes effect with the next frame
+    if (display_gov.update(micros() - start, f.count, f.wanted)) raster_stale = true;
+}
+
+// ============================================================================
+// VECTOR REPLAY (lib/vector_logger)
+// ============================================================================
+
+/*
+ * With VECTOR_REPLAY the CPU never starts: loop() reads the frames of an
+ * indexed capture (vcap_format.h) from SD card into the back list and
+ * hands it over when it is due, as the DVG would have. The frames are
+ * paced by the master cycle of their list, relative to the first frame
+ * after each start, so the display sees the list rate of the recording;
+ * captures without cycles run at the refresh rate they were taken at.
+ * A stamp that goes backwards or jumps far ahead (the recording device
+ * was reset in between) starts a new timeline at that frame.
+ * Raster, governor and DAC are the same as in the game.
+ */
+
+#if VECTOR_REPLAY
+
+static VectorReplay vector_replay;
+static SPIClass replay_spi(HSPI);
+bool replay_active = false;
+static bool replay_loaded = false;    // vector_back holds the next frame
+static bool replay_restart = true;    // Next frame starts the timeline
+static unsigned long replay_start_us = 0;
+static unsigned long replay_due_us = 0;
+static uint32_t replay_first_frame = 0;
+static uint32_t replay_first_cycle = 0;
+static uint32_t replay_frame = 0;
+static uint64_t replay_offset_us = 0;  // Of the frame in vector_back
+
+#define REPLAY_MAX_GAP_US  60000000   // Longer pauses are a new recording
+
+static bool replay_begin() {
+    replay_spi.begin(VECTOR_REPLAY_SD_SCK, VECTOR_REPLAY_SD_MISO, VECTOR_REPLAY_SD_MOSI, VECTOR_REPLAY_SD_CS);
+    if (!SD.begin(VECTOR_REPLAY_SD_CS, replay_spi)) {
+        Serial.println("[replay] No SD card, running the game");
+    } else if (!vector_replay.begin(SD, VECTOR_REPLAY_FILE)) {
+        Serial.printf("[replay] %s missing or not a capture, running the game\n", VECTOR_REPLAY_FILE);
+        SD.end();
+    } else {
+        const vcap_file_header& h = vector_replay.header();
+        Serial.printf("[replay] %s: %u Hz clock, %u Hz display, up to %u points\n",
+                      VECTOR_REPLAY_FILE, h.cpu_hz, h.refresh_hz, h.max_points);
+        replay_active = true;
+        return true;
+    }
+    replay_spi.end();  // Buttons get their pins back
+    return false;
+}
+
+// Core 1: in place of dvg_service(), no snapshots arrive while replaying
+static void replay_service() {
+    if (!replay_active || vector_back_ready) return;
+    
+    if (!replay_loaded) {
+        uint32_t cycle;
+        if (!vector_replay.next(vector_back->points, VECT_POINTS_PER_FRAME,
+                                &vector_back->count, &replay_frame, &cycle)) {
+            if (!VECTOR_REPLAY_LOOP) return;  // Last frame stays on screen
+            vector_replay.rewind();
+            replay_restart = true;
+            return;
+        }
+        vector_back->cycle = cycle;
         
-        switch (op) {
-            case 0x0: // VCTR - Draw vector
-            case 0x1:
-            case 0x2:
-            case 0x3:
-            case 0x4:
-            case 0x5:
-            case 0x6:
-            case 0x7: {
-                // Extract fields
-                int16_t dy = (opcode >> 0) & 0x03;  // 2 bits Y
-                int16_t dx = (opcode >> 2) & 0x03;  // 2 bits X
-                uint8_t brightness = (opcode >> 4) & 0x0F;  // 4 bits intensity
-                uint8_t length = ((opcode >> 8) & 0x0F);    // 4 bits length
-                
-                // Sign extend 2-bit values to 16-bit
-                if (dy & 0x02) dy |= 0xFFFC;
-                if (dx & 0x02) dx |= 0xFFFC;
-                
-                // Apply scale
-                int scale = scale_table[dvg_state.scale];
-                dx = (dx * length * scale) >> 4;
-                dy = (dy * length * scale) >> 4;
-                
-                // Draw line from current position to new position
-                int16_t x0 = dvg_state.x;
-                int16_t y0 = dvg_state.y;
-                int16_t x1 = x0 + dx;
-                int16_t y1 = y0 + dy;
-                
-                // Simple line drawing - add intermediate points
-                int steps = max(abs(dx), abs(dy)) / 4;
-                if (steps < 1) steps = 1;
-                if (steps > 20) steps = 20;  // Limit points per line
-                
-                for (int i = 0; i <= steps; i++) {
-                    int16_t x = x0 + (dx * i) / steps;
-                    int16_t y = y0 + (dy * i) / steps;
-                    dvg_add_point(x, y, brightness);
-                }
-                
-                dvg_state.x = x1;
-                dvg_state.y = y1;
-                break;
-            }
-            
-            case 0x8: // LABS - Load absolute position
-            case 0x9: {
-                uint16_t next = dvg_read_word(dvg_state.pc);
-                dvg_state.pc += 2;
-                
-                dvg_state.y = (opcode & 0x03FF);
-                dvg_state.x = (next & 0x03FF);
-                break;
-            }
-            
-            case 0xA: // HALT
-                dvg_state.halt = true;
-                break;
-            
-            case 0xB: // JSRL - Jump to subroutine
-                if (dvg_state.stack_ptr < 4) {
-                    dvg_state.stack[dvg_state.stack_ptr++] = dvg_state.pc;
-                }
-                dvg_state.pc = (opcode & 0x0FFF) << 1;
-                break;
-            
-            case 0xC: // RTSL - Return from subroutine
-                if (dvg_state.stack_ptr > 0) {
-                    dvg_state.pc = dvg_state.stack[--dvg_state.stack_ptr];
-                } else {
-                    dvg_state.halt = true;
-                }
-                break;
-            
-            case 0xD: // JMPL - Jump
-                dvg_state.pc = (opcode & 0x0FFF) << 1;
-                break;
-            
-            case 0xE: // SVEC - Short vector
-            case 0xF: {
-                int16_t dy = (opcode >> 0) & 0x07;  // 3 bits Y
-                int16_t dx = (opcode >> 8) & 0x07;  // 3 bits X
-                uint8_t brightness = (opcode >> 4) & 0x0F;
-                
-                // Sign extend 3-bit values
-                if (dy & 0x04) dy |= 0xFFF8;
-                if (dx & 0x04) dx |= 0xFFF8;
-                
-                // Apply scale
-                int scale = scale_table[dvg_state.scale];
-                dx = (dx * scale) >> 1;
-                dy = (dy * scale) >> 1;
-                
-                int16_t x1 = dvg_state.x + dx;
-                int16_t y1 = dvg_state.y + dy;
-                
-                dvg_add_point(dvg_state.x, dvg_state.y, brightness);
-                dvg_add_point(x1, y1, brightness);
-                
-                dvg_state.x = x1;
-                dvg_state.y = y1;
-                break;
-            }
+        const vcap_file_header& h = vector_replay.header();
+        uint64_t offset_us = (cycle && h.cpu_hz)
+            ? (uint64_t)(cycle - replay_first_cycle) * 1000000 / h.cpu_hz
+            : (uint64_t)(replay_frame - replay_first_frame) * 1000000 / max(h.refresh_hz, (uint16_t)1);
+        if (replay_restart || offset_us < replay_offset_us ||
+            offset_us - replay_offset_us > REPLAY_MAX_GAP_US) {
+            replay_restart = false;
+            replay_start_us = micros();
+            replay_first_frame = replay_frame;
+            replay_first_cycle = cycle;
+            offset_us = 0;
         }
+        replay_offset_us = offset_us;
+        replay_due_us = replay_start_us + (unsigned long)offset_us;
+        replay_loaded = true;
     }
+    
+    if ((long)(micros() - replay_due_us) < 0) return;
+    replay_loaded = false;
+    dvg_list_points = vector_back->count;
+    vector_back_ready = true;
 }
 
-void process_vector_list() {
-    // Don't increment frame_count here - it's done in DVG GO handler!
-    
-    // Check if vector RAM has any non-zero data
-    bool has_data = false;
-    for (int i = 0; i < 32 && !has_data; i++) {
-        if (vector_ram[i] != 0x00) has_data = true;
+#else
+static inline void replay_service() {}
+#endif
+
+// ============================================================================
+// CONSOLE (lib/console)
+// ============================================================================
+
+/*
+ * Commands run in the console task on core 1 and never touch emulation
+ * or display state directly. The pacing knobs are atomics that the
+ * emulation task reads once per frame; display limits go through a
+ * sequence lock to loop(), which hands them to the governor at the next
+ * frame boundary. Counters are read as they are; rates are taken
+ * between two "stats" commands.
+ */
+
+// Core 0 pacing in percent of real time, 0 = as fast as possible
+std::atomic<uint32_t> emu_speed_pct(EMU_THROTTLE ? 100 : 0);
+
+// Periodic status lines of both cores
+std::atomic<bool> status_reports(true);
+
+// Core 0 counters, published once per frame (low 32 bits, for deltas)
+static struct {
+    std::atomic<uint32_t> instructions{0};
+    std::atomic<uint32_t> cycles{0};
+    std::atomic<uint32_t> idle_us{0};  // Throttle sleep
+} emu_counters;
+
+// Display limits, console -> loop(); seq is odd while they are written
+static struct {
+    std::atomic<uint32_t> seq{0};
+    uint16_t hz_min, hz_max;
+    int      points;
+    uint8_t  dwell_min, dwell_max;
+} display_knobs;
+static uint32_t display_knobs_applied = 0;
+
+// Core 1, frame boundary: take new display limits. Returns true if the
+// raster frame has to be rebuilt.
+static bool display_knobs_apply() {
+    uint32_t seq = display_knobs.seq.load(std::memory_order_acquire);
+    if (seq == display_knobs_applied || (seq & 1)) return false;
+    uint16_t hz_min = display_knobs.hz_min, hz_max = display_knobs.hz_max;
+    int points = display_knobs.points;
+    uint8_t dwell_min = display_knobs.dwell_min, dwell_max = display_knobs.dwell_max;
+    if (display_knobs.seq.load(std::memory_order_acquire) != seq) return false;  // Try next frame
+    display_knobs_applied = seq;
+    display_gov.setLimits(hz_min, hz_max, points, dwell_min, dwell_max);
+    return true;
+}
+
+static void display_knobs_post(uint16_t hz_min, uint16_t hz_max, int points,
+                               uint8_t dwell_min, uint8_t dwell_max) {
+    uint32_t seq = display_knobs.seq.load(std::memory_order_relaxed);
+    display_knobs.seq.store(seq + 1, std::memory_order_release);
+    display_knobs.hz_min = hz_min;
+    display_knobs.hz_max = hz_max;
+    display_knobs.points = points;
+    display_knobs.dwell_min = dwell_min;
+    display_knobs.dwell_max = dwell_max;
+    display_knobs.seq.store(seq + 2, std::memory_order_release);
+}
+
+// Limits as posted last (the governor may not have taken them yet)
+static void display_knobs_get(uint16_t& hz_min, uint16_t& hz_max, int& points,
+                              uint8_t& dwell_min, uint8_t& dwell_max) {
+    if (display_knobs.seq.load(std::memory_order_acquire)) {
+        hz_min = display_knobs.hz_min;
+        hz_max = display_knobs.hz_max;
+        points = display_knobs.points;
+        dwell_min = display_knobs.dwell_min;
+        dwell_max = display_knobs.dwell_max;
+    } else {
+        hz_min = display_gov.hz_min;
+        hz_max = display_gov.hz_max;
+        points = display_gov.points_limit;
+        dwell_min = display_gov.dwell_min;
+        dwell_max = display_gov.dwell_max;
     }
+}
+
+static size_t cmd_stats(int argc, char** argv, char* out, size_t cap) {
+    static struct {
+        unsigned long time;
+        uint32_t instructions, cycles, idle_us, lists, frames;
+    } last;
     
-    if (has_data) {
-        // Execute DVG program from vector RAM
-        dvg_execute();
-    } else {
-        // Fallback: Show test pattern until ROM fills vector RAM
-        vector_buffer.count = 0;
-        for (int i = 0; i < 100 && vector_buffer.count < VECT_POINTS_PER_FRAME; i++) {
-            float angle = i * 2 * PI / 100.0;
-            uint16_t x = 2048 + (int)(1024 * cos(angle));
-            uint16_t y = 2048 + (int)(1024 * sin(angle));
-            
-            vector_buffer.points[vector_buffer.count][0] = x;
-            vector_buffer.points[vector_buffer.count][1] = y;
-            vector_buffer.intensity[vector_buffer.count] = 255;
-            vector_buffer.count++;
+    unsigned long now = micros();
+    uint32_t instructions = emu_counters.instructions.load(std::memory_order_relaxed);
+    uint32_t cycles = emu_counters.cycles.load(std::memory_order_relaxed);
+    uint32_t idle_us = emu_counters.idle_us.load(std::memory_order_relaxed);
+    uint32_t lists = dvg_reuse_hits + dvg_reuse_misses;
+    uint32_t frames = display_gov.frames;
+    float dt = max((now - last.time) / 1e6f, 1e-6f);
+    
+    size_t len = snprintf(out, cap,
+        "[stats] %.1f s: %.0f inst/s, %.3f MHz emulated, core 0 idle %.0f%%\n"
+        "[stats] dvg %.1f lists/s, %d points/list, %u reused / %u decoded\n"
+        "[stats] display %.1f frames/s at %u Hz, %d points/frame, output %u us (%u%% of period), "
+        "%u overloads, DAC %s %u points/s max\n",
+        dt, (instructions - last.instructions) / dt, (cycles - last.cycles) / dt / 1e6f,
+        100.0f * (idle_us - last.idle_us) / (now - last.time),
+        (lists - last.lists) / dt, dvg_list_points, dvg_reuse_hits, dvg_reuse_misses,
+        (frames - last.frames) / dt, display_gov.hz, vector_raster.frame.count,
+        display_gov.last_draw_us, display_gov.last_draw_us * 100 / display_gov.period_us,
+        display_gov.overloads, vector_dac.name(), vector_dac.maxPointRate());
+    
+    last.time = now;
+    last.instructions = instructions;
+    last.cycles = cycles;
+    last.idle_us = idle_us;
+    last.lists = lists;
+    last.frames = frames;
+    return len;
+}
+
+static size_t cmd_speed(int argc, char** argv, char* out, size_t cap) {
+    if (argc > 1) emu_speed_pct.store(atoi(argv[1]), std::memory_order_relaxed);
+    uint32_t speed = emu_speed_pct.load(std::memory_order_relaxed);
+    if (!speed) return snprintf(out, cap, "speed unthrottled\n");
+    return snprintf(out, cap, "speed %u%% of real time\n", speed);
+}
+
+// hz / points / dwell: change one limit, keep the others
+static size_t cmd_display(int argc, char** argv, char* out, size_t cap) {
+    uint16_t hz_min, hz_max;
+    int points;
+    uint8_t dwell_min, dwell_max;
+    display_knobs_get(hz_min, hz_max, points, dwell_min, dwell_max);
+    
+    if (argc > 1) {
+        int a = atoi(argv[1]);
+        int b = (argc > 2) ? atoi(argv[2]) : -1;
+        if (!strcmp(argv[0], "hz")) {
+            hz_max = max(a, 1);
+            if (b >= 0) hz_min = max(b, 1);
+            hz_min = min(hz_min, hz_max);
+        } else if (!strcmp(argv[0], "points")) {
+            points = a;
+        } else {
+            dwell_max = min(max(a, 0), 255);
+            if (b >= 0) dwell_min = min(max(b, 0), 255);
+            dwell_min = min(dwell_min, dwell_max);
         }
+        display_knobs_post(hz_min, hz_max, points, dwell_min, dwell_max);
     }
+    return snprintf(out, cap, "display %u-%u Hz, %d points max, dwell %u-%u us%s "
+                    "(now %u Hz, %d points, dwell %u us)\n",
+                    hz_min, hz_max, points, dwell_min, dwell_max,
+                    vector_dma ? " (DMA: no dwell)" : "",
+                    display_gov.hz, display_gov.max_points, display_gov.dwell_us);
 }
 
-void render_vectors() {
-    // Render all buffered vector points to DAC
-    for (int i = 0; i < vector_buffer.count; i++) {
-        uint16_t x = vector_buffer.points[i][0];
-        uint16_t y = vector_buffer.points[i][1];
-        
-        vector_dac.setXY(x, y);
-        delayMicroseconds(VECT_DWELL_US);
+static size_t cmd_trace(int argc, char** argv, char* out, size_t cap) {
+    if (argc > 1) trace_set_mask(strtoul(argv[1], nullptr, 0));
+    return snprintf(out, cap, "trace 0x%02X of 0x%02X compiled in "
+                    "(0x01 CPU, 0x02 ZP, 0x04 VRAM, 0x08 DVG, 0x10 IO)\n",
+                    trace_get_mask(), TRACE_CATEGORIES);
+}
+
+static size_t cmd_status(int argc, char** argv, char* out, size_t cap) {
+    if (argc > 1) status_reports.store(!strcmp(argv[1], "on"), std::memory_order_relaxed);
+    return snprintf(out, cap, "status reports %s\n",
+                    status_reports.load(std::memory_order_relaxed) ? "on" : "off");
+}
+
+#if REWIND_ENABLE
+static size_t cmd_rewind(int argc, char** argv, char* out, size_t cap) {
+    if (argc > 1) {
+        if (!strcmp(argv[1], "freeze")) {
+            rewind_frozen.store(true);
+        } else if (!strcmp(argv[1], "resume")) {
+            rewind_frozen.store(false);
+        } else {
+            uint32_t frames = (uint32_t)(atof(argv[1]) * CPU_NMI_HZ);
+            rewind_request.store(max(frames, 1u));
+            return snprintf(out, cap, "rewind %u frames back at the next frame\n", frames);
+        }
     }
+    const RewindRing& r = rewind_ring;
+    uint32_t span = r.snapshots ? r.last_frame - r.first_frame : 0;
+    return snprintf(out, cap, "rewind %u KB of %u KB %s, %u snapshots (%u key), frames %u-%u (%.1f s)%s\n"
+                    "rewind snapshot every %u frames, key every %u, delta %u bytes avg of %u\n",
+                    (unsigned)(r.used() / 1024), (unsigned)(r.capacity / 1024), r.in_psram ? "PSRAM" : "heap",
+                    r.snapshots, r.keys, r.first_frame, r.last_frame, (float)span / CPU_NMI_HZ,
+                    rewind_frozen.load() ? ", frozen" : "",
+                    REWIND_INTERVAL_FRAMES, REWIND_KEY_INTERVAL,
+                    r.delta_count ? (uint32_t)(r.delta_bytes / r.delta_count) : 0, (unsigned)savestate_size());
+}
+#endif
+
+#if PROFILE_ENABLE
+static size_t cmd_prof(int argc, char** argv, char* out, size_t cap) {
+    size_t len = prof_report(out, cap);
+    if (!len) len = snprintf(out, cap, "[prof] no window finished yet\n");
+    return len;
 }
+#endif
+
+static const ConsoleCommand console_commands[] = {
+    { "stats",  "",              "Rates since the last stats, points, output time", cmd_stats },
+    { "speed",  "[pct]",         "Emulation pace in % of real time, 0 = unthrottled", cmd_speed },
+    { "hz",     "[max] [min]",   "Refresh rate limits of the governor",         cmd_display },
+    { "points", "[max]",         "Raster point budget",                         cmd_display },
+    { "dwell",  "[max] [min]",   "Dwell per point (us), blocking SPI only",     cmd_display },
+    { "trace",  "[mask]",        "Trace categories to record",                  cmd_trace },
+    { "status", "[on|off]",      "Periodic status reports",                     cmd_status },
+#if REWIND_ENABLE
+    { "rewind", "[s|freeze|resume]", "Rewind ring usage, or jump back s seconds", cmd_rewind },
+#endif
+#if PROFILE_ENABLE
+    { "prof",   "",              "Profiler report of the last window",          cmd_prof },
+#endif
+};
 
 // ============================================================================
 // EMULATION TASK (Core 0)
@@ -1079,72 +2540,110 @@ void emulation_task(void *parameter) {
     // Remove this task from watchdog - it needs tight CPU timing
     disableCore0WDT();
     
-    Serial.println("\n=== FRAME-BASED EMULATION (MAME Style) ===");
-    Serial.println("Running CPU at maximum speed");
-    Serial.println("NMI triggered every ~300 instructions (tunable)\n");
+    Serial.println("\n=== CYCLE-BUDGETED FRAME EMULATION ===");
+    Serial.printf("CPU %d Hz, NMI %d Hz, %d cycles per frame, throttle=%d, %s core\n\n",
+                  CPU_CLOCK_HZ, CPU_NMI_HZ, CPU_CYCLES_PER_FRAME, EMU_THROTTLE, CPU_CORE_NAME);
     
-    // Frame-based emulation: Run as fast as possible
-    // Trigger NMI based on instruction count, not real time
-    // This matches how MAME works - it runs "full speed" and syncs to display
+    // Each frame runs the machine for exactly one NMI period of master
+    // cycles; NMI, DVG HALT and the watchdog are scheduler events, so
+    // they land on the right instruction boundary regardless of slicing.
+    const uint32_t FRAME_US = 1000000 / CPU_NMI_HZ;
+    if (!savestate_booted) sched_init();  // Restored from the boot image otherwise
     
-    const uint32_t INSTRUCTIONS_PER_NMI = 300;  // Tunable parameter
-    uint32_t instruction_count = 0;
+    // Frames end at fixed master cycles, so cycles overshot by the last
+    // instruction of a frame are taken from the next one (also after a
+    // boot image, which was saved just past a frame end)
+    uint64_t frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+    uint32_t frame_count = 0;
     
-    bool nmi_active = false;
-    uint32_t nmi_release_count = 0;
-    
-    uint64_t total_instructions = 0;
-    uint32_t nmi_count = 0;
-    unsigned long last_status_time = micros();
     unsigned long start_time = micros();
+    unsigned long last_status_time = start_time;
+    unsigned long next_frame_time = start_time + FRAME_US;
+    uint64_t last_status_instructions = 0;
     
     Serial.println("*** Frame-based emulation started ***\n");
     
     while (true) {
-        // Run CPU - single instruction for maximum control
-        uint64_t cycles = 0;
-        cpu->Run(1, cycles);
-        instruction_count++;
-        total_instructions++;
+        PROF_BEGIN(PROF_CORE0);
+        if (rewind_frame()) {
+            // Seeked back: the frame starts at the snapshot's master cycle
+            frame_end = total_cpu_cycles - total_cpu_cycles % CPU_CYCLES_PER_FRAME;
+        }
+        frame_end += CPU_CYCLES_PER_FRAME;
+        sched_run(frame_end);
+        sound_sync((uint32_t)total_cpu_cycles);
+        frame_count++;
+        
+#if SAVESTATE_BOOT && !defined(ASTEROIDINO_NATIVE)
+        // First boot: keep the attract mode as boot image for the next one
+        if (!savestate_booted && frame_count == SAVESTATE_BOOT_FRAMES) {
+            savestate_boot_store();
+        }
+#endif
         
         // Check if we reached main game code (0x6800-0x6FFF)
-        uint16_t pc = cpu->GetPC();
         static bool reached_game_code = false;
-        if (!reached_game_code && pc >= 0x6800 && pc < 0x7000) {
-            reached_game_code = true;
-            Serial.printf("\n*** REACHED MAIN GAME CODE! PC=0x%04X ***\n", pc);
-            Serial.printf("    After %llu instructions, %u NMIs\n\n", 
-                         total_instructions, nmi_count);
+        if (!reached_game_code) {
+            uint16_t pc = cpu->GetPC();
+            if (pc >= 0x6800 && pc < 0x7000) {
+                reached_game_code = true;
+                Serial.printf("\n*** REACHED MAIN GAME CODE! PC=0x%04X ***\n", pc);
+                Serial.printf("    After %llu instructions, %u frames\n\n",
+                             cpu->GetInstructionCount(), frame_count);
+            }
         }
         
-        // Trigger NMI every INSTRUCTIONS_PER_NMI instructions
-        if (!nmi_active && instruction_count >= INSTRUCTIONS_PER_NMI) {
-            cpu->NMI(false);  // Pull NMI line LOW (trigger)
-            nmi_active = true;
-            nmi_release_count = 0;
-            instruction_count = 0;
-            nmi_count++;
-        }
+        PROF_END(PROF_CORE0);
+        emu_counters.instructions.store((uint32_t)cpu->GetInstructionCount(), std::memory_order_relaxed);
+        emu_counters.cycles.store((uint32_t)total_cpu_cycles, std::memory_order_relaxed);
+        unsigned long now = micros();
         
-        // Release NMI after a few instructions (simulate edge trigger)
-        if (nmi_active) {
-            nmi_release_count++;
-            if (nmi_release_count >= 3) {
-                cpu->NMI(true);  // Pull NMI line HIGH (release)
-                nmi_active = false;
+        // Pace frames against real time (console "speed"). If we fall far
+        // behind (debug output, flash writes) resync instead of bursting to
+        // catch up. Whole ticks are slept so the core can idle instead of
+        // spinning.
+        uint32_t speed = emu_speed_pct.load(std::memory_order_relaxed);
+        if (speed) {
+            const unsigned long frame_us = FRAME_US * 100 / speed;
+            long ahead = (long)(next_frame_time - now);
+            if (ahead > 0) {
+                PROF_SCOPE(PROF_IDLE);
+                unsigned long sleep_start = now;
+                const long TICK_US = 1000000 / configTICK_RATE_HZ;
+                if (ahead > TICK_US) {
+                    vTaskDelay((ahead - TICK_US) / TICK_US);
+                    now = micros();
+                    ahead = (long)(next_frame_time - now);
+                }
+                if (ahead > 0) delayMicroseconds(ahead);
+                now = micros();
+                emu_counters.idle_us.fetch_add(now - sleep_start, std::memory_order_relaxed);
+            } else if (ahead < -(long)(8 * frame_us)) {
+                next_frame_time = now;
             }
+            next_frame_time += frame_us;
+        } else {
+            next_frame_time = now;
         }
+        prof_frame(0);
         
-        // Status report every 2 seconds (real time)
-        unsigned long now = micros();
-        if (now - last_status_time >= 2000000) {
+        // Status report (real time), checked once per frame
+        if (now - last_status_time >= EMU_STATUS_INTERVAL_US &&
+            status_reports.load(std::memory_order_relaxed)) {
             unsigned long elapsed_ms = (now - start_time) / 1000;
-            float instructions_per_sec = total_instructions / (elapsed_ms / 1000.0);
+            uint64_t instructions = cpu->GetInstructionCount();
+            float interval_s = (now - last_status_time) / 1000000.0;
+            float instructions_per_sec = (instructions - last_status_instructions) / interval_s;
+            float emulated_mhz = total_cpu_cycles / (elapsed_ms * 1000.0);
+            float idle_pct = total_cpu_cycles ? 100.0 * cpu->GetIdleCycles() / total_cpu_cycles : 0;
             
-            Serial.printf("*** Status: %llu instructions in %lu ms (%.0f inst/sec), %u NMIs, PC=0x%04X\n",
-                         total_instructions, elapsed_ms, instructions_per_sec, nmi_count, cpu->GetPC());
+            Serial.printf("*** Status [%s core]: %llu instructions in %lu ms (%.0f inst/sec), %u frames, %.3f MHz, %.0f%% idle-skipped, %u watchdog resets, %u/%u sound drops/resyncs, PC=0x%04X\n",
+                         CPU_CORE_NAME, instructions, elapsed_ms, instructions_per_sec, frame_count,
+                         emulated_mhz, idle_pct, watchdog_resets, sound_dropped(), sound_resyncs(),
+                         cpu->GetPC());
             
             last_status_time = now;
+            last_status_instructions = instructions;
         }
     }
 }
@@ -1153,6 +2652,9 @@ void emulation_task(void *parameter) {
 // SETUP & MAIN LOOP (Core 1)
 // ============================================================================
 
+// A PlatformIO test (test/test_bench) brings its own setup() and loop()
+// and builds this file only for the emulator parts
+#ifndef PIO_UNIT_TESTING
 void setup() {
     Serial.begin(SERIAL_BAUD);
     delay(100);  // Wait for Serial to stabilize
@@ -1165,14 +2667,19 @@ void setup() {
     Serial.printf("Free heap: %d bytes\n", ESP.getFreeHeap());
     Serial.printf("Chip: ESP32 rev%d\n", ESP.getChipRevision());
     
-    // Initialize GPIO buttons
-    pinMode(BTN_LEFT_PIN, INPUT_PULLUP);
-    pinMode(BTN_RIGHT_PIN, INPUT_PULLUP);
-    pinMode(BTN_UP_PIN, INPUT_PULLUP);
-    pinMode(BTN_DOWN_PIN, INPUT_PULLUP);
-    pinMode(BTN_FIRE_PIN, INPUT_PULLUP);
-    pinMode(BTN_START_PIN, INPUT_PULLUP);
-    pinMode(BTN_COIN_PIN, INPUT_PULLUP);
+    // Trace drain task (no-op with TRACE_CATEGORIES 0)
+    trace_begin();
+    prof_begin();
+    
+    // I2S sound task (no-op with AUDIO_ENABLE 0)
+    sound_begin();
+    
+#if VECTOR_REPLAY
+    // Capture from SD card instead of the game; its bus takes two button pins
+    if (!replay_begin())
+#endif
+    // GPIO buttons, sampled and debounced by a timer from here on
+    input_begin();
     
     // Initialize Vector DAC
     vector_dac.begin();
@@ -1183,8 +2690,51 @@ void setup() {
     delay(2000);
 #endif
     
+#if VECT_USE_DMA
+    // Switch to DMA streaming; falls back to blocking SPI on failure
+    vector_dma = vector_dac.beginStream();
+#endif
+    
+    // The DMA engine paces its points itself; blocking SPI has a dwell
+    if (vector_dma) {
+        display_gov.begin(min(VECT_POINTS_PER_FRAME, VECT_DMA_MAX_POINTS), 0, 0);
+    } else {
+        display_gov.begin(VECT_POINTS_PER_FRAME, VECT_DWELL_US, VECT_DWELL_MIN_US);
+    }
+    
+#ifdef ENABLE_VECTOR_LOGGER
+    // Frame capture (lib/vector_logger, mode in config.h)
+  #ifndef VECTOR_LOG_MODE
+    #define VECTOR_LOG_MODE LOG_UDP
+  #endif
+    vectorLog.begin(VECTOR_LOG_MODE);
+#endif
+    
+#if VECTOR_REPLAY
+    // Display path only: no ROM, CPU or emulation task
+    if (replay_active) {
+        console_begin(console_commands, sizeof(console_commands) / sizeof(console_commands[0]));
+        Serial.println("\nSetup complete. Replaying...\n");
+        return;
+    }
+#endif
+    
+    // ROM image before the CPU reads its reset vector
+    if (!rom_image_init()) {
+        while (true) delay(1000);
+    }
+    
     // Initialize CPU with callbacks
+#if TRACE_CATEGORIES & TRACE_CPU
+    // The clock-cycle callback makes RunSwitch() defer to the table core
+    cpu = new mos6502(cpu6502_read_callback, cpu6502_write_callback, trace_cpu_cycle);
+#else
     cpu = new mos6502(cpu6502_read_callback, cpu6502_write_callback);
+#endif
+#if EMU_IDLE_SKIP
+    cpu->SetIdleCheck(emu_idle_check);
+#endif
+    memory_map_init();
     
     // Initialize interrupt lines (NMI is edge-triggered HIGH->LOW)
     cpu->NMI(true);  // Set NMI line HIGH (inactive)
@@ -1241,6 +2791,22 @@ void setup() {
     Serial.println("\n*** NMI configured as per MAME: 250 Hz, only when IN0 bit 7 = 0 ***\n");
 #endif
     
+#if SAVESTATE_BOOT && !defined(ASTEROIDINO_NATIVE)
+    // Skip the self-test and RAM clear of the power-up sequence
+    savestate_booted = savestate_boot_load();
+    Serial.printf("*** Boot image %s: %s\n", SAVESTATE_FILE,
+                  savestate_booted ? "restored" : "not available, cold start");
+#endif
+    
+    // Rewind ring (lib/rewind), recorded by core 0 from its first frame
+    rewind_begin();
+    
+#ifdef RUN_REGRESSION_TEST
+    // Golden-frame check instead of the game (see REGRESSION)
+    regress_run(false);
+    while (true) delay(1000);
+#endif
+    
     // Start emulation on Core 0
     xTaskCreatePinnedToCore(
         emulation_task,
@@ -1252,6 +2818,9 @@ void setup() {
         0      // Core 0
     );
     
+    // Command console (lib/console), a task next to loop() on core 1
+    console_begin(console_commands, sizeof(console_commands) / sizeof(console_commands[0]));
+    
     Serial.println("\nSetup complete. Running...\n");
 }
 
@@ -1260,101 +2829,94 @@ void loop() {
     // Handles display refresh and input
     
     static unsigned long last_frame = 0;
+    bool frame_shown = false;
+    PROF_BEGIN(PROF_CORE1);
+    
+    // Decode vector lists posted by core 0 as soon as they arrive
+    dvg_service();
+    replay_service();
+    
     unsigned long now = micros();
     
-    // 60 Hz frame rate
-    if (now - last_frame >= 16667) {
+    // Refresh period chosen by the governor (VECT_REFRESH_HZ at most); the
+    // last frame is drawn again if no new list arrived in between
+    if (now - last_frame >= display_gov.period_us) {
         last_frame = now;
+        frame_shown = true;
         
-        // Read input
-        read_buttons();
+        // Frame boundary: switch to the newest decoded list and take new
+        // display limits from the console
+        vector_flip();
+        if (display_knobs_apply()) raster_stale = true;
         
         // Render vectors
         render_vectors();
         
-        // Debug output - CSV format for analysis
-        static unsigned long last_debug = 0;
-        static int frame_number = 0;
-        static bool csv_header_printed = false;
-        
-        // CSV OUTPUT: First 100 frames
-        if (frame_number < 100) {
-            // Print CSV header once
-            if (!csv_header_printed) {
-                Serial.println("\n=== ASTEROIDS VECTOR DATA CSV ===");
-                Serial.println("Frame,VectorCount,Index,X,Y,Z");
-                csv_header_printed = true;
+        // Rasterizer load report
+        static unsigned long last_raster_report = 0;
+        if (now - last_raster_report >= EMU_STATUS_INTERVAL_US &&
+            status_reports.load(std::memory_order_relaxed)) {
+            last_raster_report = now;
+            const RasterFrame& f = vector_raster.frame;
+            Serial.printf("[raster] %d points/frame (%d lit, %d settle), step %u\n",
+                         f.count, f.drawn, f.blanked, f.step);
+            Serial.printf("[gov] %u Hz, %d points max, dwell %u us, draw %u us (peak %u), "
+                         "%u overloads, %u down / %u up\n",
+                         display_gov.hz, display_gov.max_points, display_gov.dwell_us,
+                         display_gov.last_draw_us, display_gov.peak_draw_us,
+                         display_gov.overloads, display_gov.degrades, display_gov.restores);
+            display_gov.peak_draw_us = 0;
+#if DVG_MEMO && DVG_USE_DECODED_ENGINE
+            Serial.printf("[dvg] subroutines %u replayed, %u recorded\n",
+                         dvg_memo_hits, dvg_memo_misses);
+#endif
+#if DVG_FRAME_REUSE
+            Serial.printf("[dvg] lists %u reused, %u decoded\n",
+                         dvg_reuse_hits, dvg_reuse_misses);
+#endif
+#if VECT_OPTIMIZE
+            Serial.printf("[vopt] %d groups, jumps %d -> %d, points %d -> %d, cached %u/%u\n",
+                         vector_opt.groups, vector_opt.jumps_in, vector_opt.jumps_out,
+                         vector_opt.points_in, vector_opt.count,
+                         vector_opt.cache_hits, vector_opt.frames);
+#endif
+#if VECTOR_REPLAY
+            if (replay_active) {
+                Serial.printf("[replay] frame %u, %u shown, %u redraws skipped, %u bad bytes, loop %u\n",
+                             replay_frame, vector_replay.frames, vector_replay.redraws,
+                             vector_replay.skipped, vector_replay.loops);
             }
-            
-            // Output all vectors in this frame
-            for (int i = 0; i < vector_buffer.count; i++) {
-                Serial.printf("%d,%d,%d,%d,%d,%d\n",
-                    frame_number,
-                    vector_buffer.count,
-                    i,
-                    vector_buffer.points[i][0],
-                    vector_buffer.points[i][1],
-                    vector_buffer.intensity[i]);
+#endif
+#ifdef ENABLE_VECTOR_LOGGER
+            Serial.printf("[vlog] %u points, %u bytes, %u frames dropped\n",
+                         vectorLog.getPointCount(), vectorLog.getBytesWritten(),
+                         vectorLog.getFramesDropped());
+#endif
+#if PROFILE_ENABLE
+            static char prof_text[1024];
+            if (prof_report(prof_text, sizeof(prof_text))) {
+                Serial.print(prof_text);
+  #ifdef ENABLE_VECTOR_LOGGER
+                vectorLog.logText(prof_text);
+  #endif
             }
-            frame_number++;
+#endif
         }
         
-        // OLD DEBUG CODE (kept for reference)
-        /*
-        if (now - last_debug >= 1000000) {  // Every second = ~60 frames
-            last_debug = now;
-            
-            // Print CSV header once
-            if (!csv_header_printed) {
-                Serial.println("\n=== ASTEROIDS VECTOR DATA CSV ===");
-                Serial.println("Frame,VectorCount,PC,Index,X,Y,Intensity");
-                csv_header_printed = true;
-            }
-            
-            // Output current frame info
-            uint16_t pc = cpu->GetPC();
-            int vec_count = vector_buffer.count;
-            
-            // Print first 5 frames in detail, then summary
-            if (frame_number < 5) {
-                // Detailed CSV output
-                for (int i = 0; i < vec_count && i < VECT_POINTS_PER_FRAME; i++) {
-                    Serial.printf("%d,%d,0x%04X,%d,%d,%d,%d\n",
-                                 frame_number,
-                                 vec_count,
-                                 pc,
-                                 i,
-                                 vector_buffer.points[i][0],
-                                 vector_buffer.points[i][1],
-                                 vector_buffer.intensity[i]);
-                }
-            } else if (frame_number == 5) {
-                Serial.println("=== CSV DETAILED OUTPUT END ===");
-                Serial.println("(Continuing with summary output...)\n");
-            }
-            
-            // Summary output after first 5 frames
-            if (frame_number >= 5) {
-                Serial.printf("Frame %d: PC=0x%04X, Vectors=%d, VRAM[0..3]=0x%02X%02X%02X%02X\n",
-                             frame_number, pc, vec_count,
-                             vector_ram[0], vector_ram[1], vector_ram[2], vector_ram[3]);
-                
-                // Show first and last vector of frame
-                if (vec_count > 0) {
-                    Serial.printf("  First: (%d,%d,I=%d), Last: (%d,%d,I=%d)\n",
-                                 vector_buffer.points[0][0],
-                                 vector_buffer.points[0][1],
-                                 vector_buffer.intensity[0],
-                                 vector_buffer.points[vec_count-1][0],
-                                 vector_buffer.points[vec_count-1][1],
-                                 vector_buffer.intensity[vec_count-1]);
-                }
-            }
-            
-            frame_number++;
-        }
-        */
+#ifdef ENABLE_VECTOR_LOGGER
+        // Capture the frame just shown (UDP: delta-encoded, background send;
+        // binary: indexed records with the cycle the list was drawn at)
+        static uint32_t capture_frame = 0;
+        vectorLog.beginFrame(capture_frame++, vector_front->cycle);
+        vectorLog.logFrame(vector_front->points, vector_front->count);
+        vectorLog.endFrame();
+#endif
     }
     
+    // A display frame closes the profile of everything core 1 did since the last one
+    PROF_END(PROF_CORE1);
+    if (frame_shown) prof_frame(1);
+    
     yield();  // Let other tasks run
 }
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,397 @@
+/*
+ * test_bench.cpp - Mikrobenchmarks auf dem Board
+ *
+ * Misst, was ein Frame kostet, in CPU-Takten (ESP.getCycleCount) statt
+ * über die Bildrate: DAC-Aufrufe pro Aufruf und pro Rasterpunkt, den
+ * Bus-Callback pro Adressbereich, die drei CPU-Kerne pro Opcode-Klasse
+ * und den DVG-Decoder auf Vektor-RAM-Abbildern aus dem Attract-Modus
+ * (attract_vram.inc, erzeugt mit native --record-vram).
+ *
+ * Verwendung:
+ *   pio test -e bench
+ *   PLATFORMIO_BUILD_FLAGS=-DVECT_DAC_BACKEND=1 pio test -e bench
+ *
+ * Jede Messung ist eine Zeile "@bench group=... case=... variant=..."
+ * mit Median und Minimum über BENCH_REPEATS Durchläufe, abzüglich der
+ * Schleife selbst; "@bench env ..." nennt Chip, Takt, Compiler und
+ * Konfiguration. grep '^@bench' über zwei Läufe ergibt den Vergleich.
+ */
+
+#include <Arduino.h>
+#include <unity.h>
+#include "../../src/config.h"
+#include <cpu6502.h>
+#include <vector_dac.h>
+#include <vector_raster.h>
+
+// From src/main.cpp (test_build_src)
+extern mos6502* cpu;
+extern VectorDAC vector_dac;
+extern VectorRaster vector_raster;
+bool rom_image_init();
+void memory_map_init();
+uint8_t cpu6502_read_callback(uint16_t addr);
+void cpu6502_write_callback(uint16_t addr, uint8_t value);
+const uint32_t* dvg_decode(const uint8_t* vram, uint8_t go_value, int* count);
+
+#define BENCH_REPEATS   15      // Median and minimum over this many runs
+#define BENCH_CALLS     2000    // Calls per run for the per-call cases
+
+#if CPU_USE_SWITCH_CORE && CPU_PREDECODE
+  #define BENCH_CORE "predecode"
+#elif CPU_USE_SWITCH_CORE
+  #define BENCH_CORE "switch"
+#else
+  #define BENCH_CORE "table"
+#endif
+
+struct bench_vram {
+    uint32_t frame;
+    uint8_t  go;
+    uint8_t  image[MEM_SIZE_VECTOR];
+};
+
+static const bench_vram attract_vram[] = {
+#include "attract_vram.inc"
+};
+#define BENCH_IMAGES (int)(sizeof(attract_vram) / sizeof(attract_vram[0]))
+
+// ============================================================================
+// MEASUREMENT
+// ============================================================================
+
+struct bench_result {
+    float median;   // CPU cycles per unit
+    float min;
+};
+
+static float bench_samples[BENCH_REPEATS];
+static float bench_overhead = 0;   // Loop cycles per iteration
+static volatile uint32_t bench_sink;
+static bool bench_roms = false;    // ROM image found, emulator parts usable
+
+// Median and minimum of bench_samples (per unit, overhead already off)
+static bench_result bench_stats() {
+    for (int i = 1; i < BENCH_REPEATS; i++) {
+        float v = bench_samples[i];
+        int j = i;
+        for (; j > 0 && bench_samples[j - 1] > v; j--) bench_samples[j] = bench_samples[j - 1];
+        bench_samples[j] = v;
+    }
+    bench_result r = { bench_samples[BENCH_REPEATS / 2], bench_samples[0] };
+    return r;
+}
+
+// Time 'n' calls of body(i) per run
+template <typename Body>
+static bench_result bench_run(uint32_t n, Body body) {
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        uint32_t t0 = ESP.getCycleCount();
+        for (uint32_t i = 0; i < n; i++) body(i);
+        uint32_t t = ESP.getCycleCount() - t0;
+        float per = (float)t / n - bench_overhead;
+        bench_samples[r] = per > 0 ? per : 0;
+    }
+    return bench_stats();
+}
+
+static void bench_report(const char* group, const char* name, const char* variant,
+                         uint32_t n, bench_result r) {
+    float mhz = getCpuFrequencyMhz();
+    Serial.printf("@bench group=%s case=%s variant=%s n=%u cycles=%.2f min=%.2f ns=%.1f\n",
+                  group, name, variant, n, r.median, r.min, r.median * 1000.0f / mhz);
+}
+
+static void test_env() {
+    Serial.printf("@bench env chip=rev%d mhz=%u compiler=\"%s\" core=%s dac=\"%s\" dma=%d "
+                  "points=%d repeats=%d\n",
+                  ESP.getChipRevision(), getCpuFrequencyMhz(), __VERSION__, BENCH_CORE,
+                  vector_dac.name(), VECT_USE_DMA, VECT_POINTS_PER_FRAME, BENCH_REPEATS);
+
+    bench_overhead = 0;
+    bench_result r = bench_run(BENCH_CALLS, [](uint32_t i) { asm volatile("" ::: "memory"); });
+    bench_overhead = r.median;
+    bench_report("loop", "empty", "-", BENCH_CALLS, r);
+    TEST_ASSERT_TRUE(bench_overhead < 100);
+    TEST_ASSERT_TRUE_MESSAGE(bench_roms, "ROM image missing, only the DAC and CPU cases run");
+}
+
+// ============================================================================
+// VECTOR DAC
+// ============================================================================
+
+static void test_dac_calls() {
+    const char* v = vector_dac.name();
+    bench_report("dac", "setXY", v, BENCH_CALLS, bench_run(BENCH_CALLS, [](uint32_t i) {
+        vector_dac.setXY(i & 0xFFF, (i * 7) & 0xFFF);
+    }));
+    bench_report("dac", "setXYPacked", v, BENCH_CALLS, bench_run(BENCH_CALLS, [](uint32_t i) {
+        vector_dac.setXYPacked(VectorDAC::packXY(i & 0xFFF, (i * 7) & 0xFFF));
+    }));
+    bench_report("dac", "setIntensity", v, BENCH_CALLS, bench_run(BENCH_CALLS, [](uint32_t i) {
+        vector_dac.setIntensity(i & 0xFF);
+    }));
+    bench_report("dac", "setXYZ", v, BENCH_CALLS, bench_run(BENCH_CALLS, [](uint32_t i) {
+        vector_dac.setXYZ(i & 0xFFF, (i * 7) & 0xFFF, i & 0xFF);
+    }));
+    vector_dac.blank();
+
+    uint32_t rate = vector_dac.maxPointRate();
+    Serial.printf("@bench group=dac case=maxPointRate variant=%s points_s=%u\n", v, rate);
+    TEST_ASSERT_TRUE(rate > 0);
+}
+
+// The blocking output loop of render_vectors() without dwell, over the
+// rasterized attract frames: what a point costs on screen
+static void test_dac_points() {
+    for (int k = 0; k < BENCH_IMAGES; k++) {
+        int count;
+        const uint32_t* points = dvg_decode(attract_vram[k].image, attract_vram[k].go, &count);
+        vector_raster.rasterize(points, count, VECT_POINTS_PER_FRAME);
+        const RasterFrame& f = vector_raster.frame;
+        TEST_ASSERT_TRUE(f.count > 0);
+
+        bench_result r = bench_run(1, [&f](uint32_t) {
+            int z = -1;
+            for (int i = 0; i < f.count; i++) {
+                if (f.z[i] != z) {
+                    z = f.z[i];
+                    vector_dac.setIntensity(z);
+                }
+                vector_dac.setXYPacked(f.xy[i]);
+            }
+        });
+        r.median /= f.count;
+        r.min /= f.count;
+        char name[24];
+        snprintf(name, sizeof(name), "point_f%u", attract_vram[k].frame);
+        bench_report("dac", name, vector_dac.name(), f.count, r);
+    }
+    vector_dac.blank();
+}
+
+#if VECT_USE_DMA
+// Filling a stream frame; runs last, setXY no longer applies afterwards
+static void test_dac_stream() {
+    TEST_ASSERT_TRUE(vector_dac.beginStream());
+    const RasterFrame& f = vector_raster.frame;
+
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        while (!vector_dac.beginFrame()) delay(1);
+        uint32_t t0 = ESP.getCycleCount();
+        for (int i = 0; i < f.count; i++) vector_dac.addPacked(f.xy[i], f.z[i]);
+        uint32_t t = ESP.getCycleCount() - t0;
+        vector_dac.endFrame();
+        bench_samples[r] = (float)t / f.count;
+    }
+    bench_report("dac", "addPacked", vector_dac.name(), f.count, bench_stats());
+    Serial.printf("@bench group=dac case=streamRate variant=%s points_s=%u\n",
+                  vector_dac.name(), vector_dac.pointRate());
+}
+#endif
+
+// ============================================================================
+// BUS CALLBACK
+// ============================================================================
+
+static void bench_read(const char* region, uint16_t addr, uint16_t span) {
+    bench_report("bus", region, "read", BENCH_CALLS, bench_run(BENCH_CALLS, [=](uint32_t i) {
+        bench_sink = cpu6502_read_callback(addr + (i % span));
+    }));
+}
+
+static void test_bus_read() {
+    bench_read("ram", 0x0100, 0x100);
+    bench_read("in0", 0x2000, 8);
+    bench_read("in1", 0x2400, 8);
+    bench_read("dsw", 0x2800, 4);
+    bench_read("vram", 0x4000, 0x100);
+    bench_read("vector_rom", 0x5000, 0x100);
+    bench_read("program_rom", 0x6800, 0x100);
+    bench_read("mirror", 0xF800, 0x100);
+    bench_read("unmapped", 0x3800, 0x100);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, cpu6502_read_callback(0x3800));
+}
+
+// ============================================================================
+// CPU CORES
+// ============================================================================
+
+/*
+ * Each class is a straight run of its instructions, repeated to fill a
+ * block and closed by a JMP back, on a CPU of its own over 4 KB of
+ * direct-mapped memory (mirrored by the callback): code from $0200,
+ * data in the zero page and at $0E00, a subroutine at $0F00. The JMP is
+ * part of every block, one instruction in about fifty.
+ */
+struct bench_class {
+    const char* name;
+    int16_t prelude[8];   // Once before the loop, -1 ends
+    int16_t body[16];     // Repeated, -1 ends
+};
+
+static const bench_class bench_classes[] = {
+    { "load_store", { 0xD8, -1 },
+      { 0xA5, 0x10, 0x85, 0x11, 0xA2, 0x01, 0x86, 0x12, 0xAD, 0x00, 0x0E, 0x8D, 0x01, 0x0E, -1 } },
+    { "alu",        { 0xD8, -1 },
+      { 0x69, 0x01, 0x25, 0x10, 0x49, 0x55, 0xC5, 0x11, 0x09, 0x01, 0xE5, 0x12, -1 } },
+    { "rmw",        { 0xD8, -1 },
+      { 0xE6, 0x10, 0x06, 0x11, 0x66, 0x12, 0xCE, 0x00, 0x0E, 0x46, 0x13, -1 } },
+    { "branch",     { 0xD8, 0x18, 0xA9, 0x01, -1 },   // C = 0, Z = 0: BCC/BNE taken
+      { 0x90, 0x00, 0xB0, 0x00, 0xD0, 0x00, 0xF0, 0x00, -1 } },
+    { "indexed",    { 0xD8, 0xA2, 0x04, 0xA0, 0x08, -1 },
+      { 0xBD, 0x00, 0x0E, 0x95, 0x10, 0xB1, 0x20, 0x99, 0x00, 0x0E, 0xB5, 0x10, -1 } },
+    { "stack_jsr",  { 0xD8, -1 },
+      { 0x48, 0x68, 0x08, 0x28, 0x20, 0x00, 0x0F, -1 } },   // JSR $0F00 = RTS
+    { "implied",    { 0xD8, -1 },
+      { 0xE8, 0x88, 0xAA, 0x98, 0x18, 0xEA, 0x8A, 0xC8, -1 } },
+};
+#define BENCH_CLASSES (int)(sizeof(bench_classes) / sizeof(bench_classes[0]))
+#define BENCH_CODE       0x0200    // First block
+#define BENCH_BLOCK      0x0180    // Bytes per class
+#define BENCH_SLICE      20000     // Emulated cycles per run
+
+static uint8_t bench_mem[0x1000];
+static uint16_t bench_entry[BENCH_CLASSES];
+
+static uint8_t bench_mem_read(uint16_t addr) { return bench_mem[addr & 0x0FFF]; }
+static void bench_mem_write(uint16_t addr, uint8_t value) { bench_mem[addr & 0x0FFF] = value; }
+
+static void bench_code() {
+    memset(bench_mem, 0, sizeof(bench_mem));
+    bench_mem[0x20] = 0x00;    // ($20),Y -> $0E00
+    bench_mem[0x21] = 0x0E;
+    bench_mem[0x0F00] = 0x60;  // RTS
+    bench_mem[0x0FFC] = BENCH_CODE & 0xFF;
+    bench_mem[0x0FFD] = BENCH_CODE >> 8;
+
+    for (int k = 0; k < BENCH_CLASSES; k++) {
+        const bench_class& c = bench_classes[k];
+        uint16_t pc = BENCH_CODE + k * BENCH_BLOCK;
+        bench_entry[k] = pc;
+        for (int i = 0; c.prelude[i] >= 0; i++) bench_mem[pc++] = c.prelude[i];
+        uint16_t loop = pc;
+        int len = 0;
+        while (c.body[len] >= 0) len++;
+        while (pc + len + 3 <= bench_entry[k] + BENCH_BLOCK) {
+            for (int i = 0; i < len; i++) bench_mem[pc++] = c.body[i];
+        }
+        bench_mem[pc++] = 0x4C;    // JMP loop
+        bench_mem[pc++] = loop & 0xFF;
+        bench_mem[pc++] = loop >> 8;
+    }
+}
+
+static void bench_cpu_core(mos6502* bc, const char* core) {
+    for (int k = 0; k < BENCH_CLASSES; k++) {
+        bc->Reset();
+        bc->SetPC(bench_entry[k]);
+        uint64_t count = 0;
+        uint64_t insn = 0;
+        for (int r = -1; r < BENCH_REPEATS; r++) {   // r = -1 warms up (predecode, cache)
+            uint64_t i0 = bc->GetInstructionCount();
+            uint32_t t0 = ESP.getCycleCount();
+            if (core[0] == 't') {
+                bc->Run(BENCH_SLICE, count);
+            } else if (core[0] == 's') {
+                bc->RunSwitch(BENCH_SLICE, count);
+            } else {
+                bc->RunPredecoded(BENCH_SLICE, count);
+            }
+            uint32_t t = ESP.getCycleCount() - t0;
+            insn = bc->GetInstructionCount() - i0;
+            if (r >= 0) bench_samples[r] = (float)t / insn;
+        }
+        TEST_ASSERT_TRUE(insn > 0);
+        uint16_t pc = bc->GetPC();
+        TEST_ASSERT_TRUE((pc >= bench_entry[k] && pc < bench_entry[k] + BENCH_BLOCK) || pc == 0x0F00);
+        bench_report("cpu", bench_classes[k].name, core, (uint32_t)insn, bench_stats());
+    }
+}
+
+static void test_cpu_classes() {
+    bench_code();
+    mos6502* bc = new mos6502(bench_mem_read, bench_mem_write);
+    bc->MapReadPages(0x00, 0x10, bench_mem);
+    bc->MapWritePages(0x00, 0x10, bench_mem);
+    bc->SetPredecode(BENCH_CODE, BENCH_CLASSES * BENCH_BLOCK);
+    bc->NMI(true);
+    bc->IRQ(true);
+
+    bench_cpu_core(bc, "table");
+    bench_cpu_core(bc, "switch");
+    bench_cpu_core(bc, "predecode");
+    delete bc;
+}
+
+// ============================================================================
+// DVG DECODE
+// ============================================================================
+
+// The decoder reads vector RAM from the snapshot in DRAM, not from flash
+static uint8_t bench_vram_copy[BENCH_IMAGES][MEM_SIZE_VECTOR];
+
+static void test_dvg_decode() {
+    for (int k = 0; k < BENCH_IMAGES; k++) {
+        memcpy(bench_vram_copy[k], attract_vram[k].image, MEM_SIZE_VECTOR);
+    }
+
+    // One image over and over: what a static attract screen costs
+    for (int k = 0; k < BENCH_IMAGES; k++) {
+        int count = 0;
+        bench_result r = bench_run(1, [&](uint32_t) {
+            dvg_decode(bench_vram_copy[k], attract_vram[k].go, &count);
+        });
+        TEST_ASSERT_TRUE(count > 0);
+        char name[24];
+        snprintf(name, sizeof(name), "frame_f%u", attract_vram[k].frame);
+        bench_report("dvg", name, "same", count, r);
+    }
+
+    // All images in turn: the memo sees a changing screen
+    int points = 0;
+    bench_result r = bench_run(BENCH_IMAGES, [&](uint32_t i) {
+        int count;
+        dvg_decode(bench_vram_copy[i], attract_vram[i].go, &count);
+        points += count;
+    });
+    bench_report("dvg", "frame_all", "alternating", points / (BENCH_REPEATS * BENCH_IMAGES), r);
+}
+
+// ============================================================================
+// RUNNER
+// ============================================================================
+
+void setup() {
+    Serial.begin(SERIAL_BAUD);
+    delay(2000);  // Monitor attached before the first line
+
+    // What setup() in main.cpp does for the parts measured here
+    vector_dac.begin();
+    bench_roms = rom_image_init();
+    if (bench_roms) {
+        cpu = new mos6502(cpu6502_read_callback, cpu6502_write_callback);
+        memory_map_init();
+        cpu->NMI(true);
+        cpu->IRQ(true);
+        cpu->Reset();
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_env);
+    RUN_TEST(test_dac_calls);
+    RUN_TEST(test_cpu_classes);
+    if (bench_roms) {
+        RUN_TEST(test_dac_points);
+        RUN_TEST(test_bus_read);
+        RUN_TEST(test_dvg_decode);
+    }
+#if VECT_USE_DMA
+    if (bench_roms) RUN_TEST(test_dac_stream);  // Needs the raster frame of test_dac_points
+#endif
+    UNITY_END();
+}
+
+void loop() {
+    delay(1000);
+}
@@ -55,6 +55,9 @@ def parse_binary(filename):
     with open(filename, 'rb') as f:
         # Read header
         magic = f.read(4)
+        if magic == b'VCI1':
+            sys.exit("Indexed capture (LOG_BINARY): build tools/vcap_tool.cpp and run "
+                     "'vcap_tool extract FILE out.csv', then analyze out.csv")
         if magic != b'VEC1':
             print(f"Warning: Invalid magic number: {magic}")
         
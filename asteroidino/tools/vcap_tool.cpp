@@ -0,0 +1,586 @@
+/*
+ * vcap_tool.cpp - Auswertung indizierter Aufnahmen (.vci, LOG_BINARY)
+ *
+ * Übersetzen (Host, POSIX):
+ *     g++ -O2 -std=c++17 -o vcap_tool tools/vcap_tool.cpp
+ *
+ * Verwendung:
+ *     vcap_tool info    capture.vci
+ *     vcap_tool stats   capture.vci [--from N] [--to M]
+ *     vcap_tool list    capture.vci [--from N] [--to M]
+ *     vcap_tool extract capture.vci out.csv|out.vcap|out.vci [--from N] [--to M]
+ *     vcap_tool convert session.vcap out.vci [--hz 60]
+ *
+ * Die Datei wird per mmap gelesen. Mit Index und Trailer (VectorLogger::end())
+ * kommen die Frame-Positionen aus den VIDX-Records, ohne die Frames
+ * anzufassen; --from/--to springen direkt hin. Text vom Serial zwischen
+ * den Records verschiebt die Offsets, das wird beim Lesen ausgeglichen.
+ * Fehlt der Trailer oder passt der Index nicht, wird die Datei nach
+ * gültigen Frame-Records durchsucht. Frames mit falscher Prüfsumme
+ * (Text mitten im Record) zählt stats, extract lässt sie weg.
+ *
+ * extract schreibt je nach Endung: .csv (frame,x,y,z wie der CSV-Modus,
+ * 12-bit Skala, für analyze_vector_log.py), .vcap (Format von
+ * vector_capture.py) oder .vci (bereinigt, neu indiziert, z.B. für die
+ * SD-Karte). convert macht aus einer UDP-Aufnahme (.vcap) eine .vci,
+ * ohne CPU-Takte; das Replay spielt sie mit --hz Frames pro Sekunde.
+ */
+
+#include "../lib/vector_logger/vcap_format.h"
+#include "../lib/vector_dac/vector_point.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// MAPPED CAPTURE
+// ============================================================================
+
+template <class T>
+static T get(const uint8_t* p) {
+    T v;
+    memcpy(&v, p, sizeof(v));  // Records need not be aligned in the file
+    return v;
+}
+
+struct Frame {
+    uint64_t   offset;  // Of the VFRM record, from the start of the file
+    vcap_frame head;
+};
+
+class Capture {
+public:
+    ~Capture() {
+        if (data) munmap((void*)data, size);
+        if (fd >= 0) close(fd);
+    }
+
+    bool open(const char* path) {
+        fd = ::open(path, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) {
+            fprintf(stderr, "%s: cannot open\n", path);
+            return false;
+        }
+        size = st.st_size;
+        if (size) {
+            void* m = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (m == MAP_FAILED) {
+                fprintf(stderr, "%s: mmap failed\n", path);
+                return false;
+            }
+            data = (const uint8_t*)m;
+            madvise(m, size, MADV_SEQUENTIAL);
+        }
+        return true;
+    }
+
+    // Header first, then the frame table from the index, else by scanning
+    bool load() {
+        if (!find_header()) return false;
+        indexed = load_index();
+        if (!indexed) scan();
+        return true;
+    }
+
+    // Points of a frame, copied out of the mapping
+    const uint32_t* points(const Frame& f) {
+        buf.resize(f.head.count);
+        memcpy(buf.data(), data + f.offset + sizeof(vcap_record) + sizeof(vcap_frame),
+               f.head.count * sizeof(uint32_t));
+        return buf.data();
+    }
+
+    // First table entry at or after display frame 'n'
+    size_t lower(uint32_t n) const {
+        return std::lower_bound(frames.begin(), frames.end(), n,
+                                [](const Frame& f, uint32_t v) { return f.head.frame < v; }) - frames.begin();
+    }
+
+    const uint8_t*     data = nullptr;
+    size_t             size = 0;
+    uint64_t           base = 0;      // File offset of the header
+    vcap_file_header   hdr = {};
+    std::vector<Frame> frames;
+    bool               indexed = false;
+    bool               has_end = false;
+    vcap_end           end_rec = {};
+    uint64_t           shift = 0;     // Index: bytes of text between the records
+    uint64_t           skipped = 0;   // Scan: bytes outside valid records
+    uint32_t           bad_frames = 0;  // Scan: VFRM records with a wrong check
+
+private:
+    int fd = -1;
+    std::vector<uint32_t> buf;
+
+    bool find_header() {
+        for (uint64_t p = 0; p + sizeof(hdr) <= size; p++) {
+            if (get<uint32_t>(data + p) != VCAP_MAGIC) continue;
+            hdr = get<vcap_file_header>(data + p);
+            if (hdr.version == VCAP_VERSION && hdr.header_size >= sizeof(hdr)) {
+                base = p;
+                return true;
+            }
+        }
+        fprintf(stderr, "no capture header (VCI1) found\n");
+        return false;
+    }
+
+    // Frame record at file offset 'p' (payload length and check); 'deep'
+    // also computes the check word over the points
+    bool frame_at(uint64_t p, vcap_frame* f, bool deep) {
+        if (p + sizeof(vcap_record) + sizeof(vcap_frame) > size) return false;
+        vcap_record r = get<vcap_record>(data + p);
+        if (r.magic != VCAP_REC_FRAME || r.length < sizeof(vcap_frame)) return false;
+        if (p + sizeof(r) + r.length > size) return false;
+        *f = get<vcap_frame>(data + p + sizeof(r));
+        if (r.length != sizeof(vcap_frame) + f->count * sizeof(uint32_t)) return false;
+        if (!deep) return true;
+        Frame tmp = { p, *f };
+        return vcap_check(*f, points(tmp)) == f->check;
+    }
+
+    // Walk the VIDX chain back from the trailer, then take the frames
+    // from the entries in order. Text that got into a Serial capture
+    // shifts every record after it by the same amount, so the reader
+    // keeps a running shift: an entry that is not where the offset says
+    // is looked for up to the shift of the index record that follows it
+    // (text only ever adds bytes). Anything that does not line up falls
+    // back to scan().
+    bool load_index() {
+        if (size < base + sizeof(hdr) + sizeof(vcap_record) + sizeof(vcap_end) + sizeof(vcap_tail)) return false;
+        vcap_tail t = get<vcap_tail>(data + size - sizeof(vcap_tail));
+        if (t.magic != VCAP_TAIL_MAGIC) return false;
+        uint64_t e = size - sizeof(vcap_tail) - sizeof(vcap_end) - sizeof(vcap_record);
+        vcap_record r = get<vcap_record>(data + e);
+        if (r.magic != VCAP_REC_END || r.length != sizeof(vcap_end) || e < base + t.end) return false;
+        end_rec = get<vcap_end>(data + e + sizeof(r));
+        has_end = true;
+        shift = e - base - t.end;
+
+        struct Chunk { uint64_t pos; uint64_t shift; vcap_index ix; };
+        std::vector<Chunk> chunks;
+        uint64_t hi = shift;
+        for (uint32_t x = end_rec.last_index; x != VCAP_NONE; ) {
+            Chunk c = { 0, 0, {} };
+            bool found = false;
+            for (uint64_t s = hi + 1; s-- > 0 && !found; ) {
+                uint64_t p = base + x + s;
+                if (p + sizeof(vcap_record) + sizeof(vcap_index) > size) continue;
+                r = get<vcap_record>(data + p);
+                c.ix = get<vcap_index>(data + p + sizeof(r));
+                found = r.magic == VCAP_REC_INDEX &&
+                        r.length == sizeof(c.ix) + (uint64_t)c.ix.count * sizeof(vcap_index_entry) &&
+                        p + sizeof(r) + r.length <= size && (c.ix.prev < x || c.ix.prev == VCAP_NONE);
+                c.pos = p;
+                c.shift = s;
+            }
+            if (!found) return false;
+            chunks.push_back(c);
+            hi = c.shift;
+            x = c.ix.prev;
+        }
+
+        frames.clear();
+        uint64_t s = 0;
+        for (auto c = chunks.rbegin(); c != chunks.rend(); ++c) {
+            const uint8_t* q = data + c->pos + sizeof(vcap_record) + sizeof(vcap_index);
+            for (uint32_t i = 0; i < c->ix.count; i++) {
+                vcap_index_entry en = get<vcap_index_entry>(q + i * sizeof(en));
+                Frame f = { 0, {} };
+                bool found = false;
+                for (; s <= c->shift && !found; s++) {
+                    f.offset = base + en.offset + s;
+                    found = frame_at(f.offset, &f.head, false) && f.head.frame == en.frame;
+                }
+                if (!found) return false;
+                s--;
+                frames.push_back(f);
+            }
+        }
+        return true;
+    }
+
+    // Every record in order; on anything that is not one, one byte on
+    void scan() {
+        frames.clear();
+        skipped = 0;
+        bad_frames = 0;
+        uint64_t p = base + hdr.header_size;
+        while (p + sizeof(vcap_record) <= size) {
+            vcap_record r = get<vcap_record>(data + p);
+            uint64_t next = p + sizeof(r) + r.length;
+            vcap_frame f;
+            if (r.magic == VCAP_REC_FRAME && r.length <= sizeof(f) + VCAP_MAX_POINTS * 4 &&
+                frame_at(p, &f, false)) {
+                if (frame_at(p, &f, true)) {
+                    frames.push_back({ p, f });
+                    p = next;
+                    continue;
+                }
+                bad_frames++;
+            } else if (r.magic == VCAP_REC_INDEX && next <= size) {
+                p = next;
+                continue;
+            } else if (r.magic == VCAP_REC_END && next + sizeof(vcap_tail) <= size) {
+                if (r.length == sizeof(vcap_end)) {
+                    end_rec = get<vcap_end>(data + p + sizeof(r));
+                    has_end = true;
+                }
+                p = next + sizeof(vcap_tail);
+                continue;
+            }
+            skipped++;
+            p++;
+        }
+        skipped += size - std::min<uint64_t>(p, size);
+    }
+};
+
+// ============================================================================
+// INDEXED WRITER
+// ============================================================================
+
+// Same layout as VectorLogger in LOG_BINARY, into a file
+class Writer {
+public:
+    bool open(const char* path, const vcap_file_header& h) {
+        f = fopen(path, "wb");
+        if (!f) {
+            fprintf(stderr, "%s: cannot create\n", path);
+            return false;
+        }
+        hdr = h;
+        hdr.magic = VCAP_MAGIC;
+        hdr.version = VCAP_VERSION;
+        hdr.header_size = sizeof(hdr);
+        if (!hdr.index_interval) hdr.index_interval = 64;
+        put(&hdr, sizeof(hdr));
+        return true;
+    }
+
+    void frame(vcap_frame head, const uint32_t* points) {
+        head.check = vcap_check(head, points);
+        index.push_back({ offset, head.frame });
+        vcap_record r = { VCAP_REC_FRAME, (uint32_t)(sizeof(head) + head.count * sizeof(uint32_t)) };
+        put(&r, sizeof(r));
+        put(&head, sizeof(head));
+        put(points, head.count * sizeof(uint32_t));
+        frames++;
+        point_count += head.count;
+        if (index.size() == hdr.index_interval) write_index();
+    }
+
+    bool close() {
+        write_index();
+        uint32_t e = offset;
+        vcap_record r = { VCAP_REC_END, sizeof(vcap_end) };
+        vcap_end en = { frames, point_count, 0, last_index };
+        vcap_tail t = { e, VCAP_TAIL_MAGIC };
+        put(&r, sizeof(r));
+        put(&en, sizeof(en));
+        put(&t, sizeof(t));
+        bool ok = !ferror(f);
+        return fclose(f) == 0 && ok;
+    }
+
+    uint32_t frames = 0;
+
+private:
+    FILE* f = nullptr;
+    vcap_file_header hdr;
+    uint32_t offset = 0;
+    uint32_t point_count = 0;
+    uint32_t last_index = VCAP_NONE;
+    std::vector<vcap_index_entry> index;
+
+    void put(const void* p, size_t n) {
+        fwrite(p, 1, n, f);
+        offset += n;
+    }
+
+    void write_index() {
+        if (index.empty()) return;
+        uint32_t x = offset;
+        vcap_record r = { VCAP_REC_INDEX, (uint32_t)(sizeof(vcap_index) + index.size() * sizeof(vcap_index_entry)) };
+        vcap_index ix = { last_index, (uint32_t)index.size() };
+        put(&r, sizeof(r));
+        put(&ix, sizeof(ix));
+        put(index.data(), index.size() * sizeof(vcap_index_entry));
+        last_index = x;
+        index.clear();
+    }
+};
+
+// ============================================================================
+// COMMANDS
+// ============================================================================
+
+struct Range {
+    uint32_t from = 0;
+    uint32_t to = UINT32_MAX;
+};
+
+static void cmd_info(Capture& c) {
+    const vcap_file_header& h = c.hdr;
+    printf("header       at byte %" PRIu64 ", version %u, %u Hz clock, %u Hz display, "
+           "index every %u frames, %u points max\n",
+           c.base, h.version, h.cpu_hz, h.refresh_hz, h.index_interval, h.max_points);
+    printf("frame table  %s\n", c.indexed ? "from index" : "by scanning (no valid index)");
+    if (c.indexed && c.shift) {
+        printf("index        realigned over %" PRIu64 " bytes of text between records\n", c.shift);
+    }
+    if (!c.indexed) {
+        printf("scan         %" PRIu64 " bytes outside records, %u frames with bad check\n",
+               c.skipped, c.bad_frames);
+    }
+    if (c.has_end) {
+        printf("trailer      %u frames, %u points, %u dropped by the logger\n",
+               c.end_rec.frames, c.end_rec.points, c.end_rec.dropped);
+    } else {
+        printf("trailer      missing (capture not closed with end())\n");
+    }
+    if (c.frames.empty()) {
+        printf("frames       none\n");
+        return;
+    }
+    const vcap_frame& a = c.frames.front().head;
+    const vcap_frame& b = c.frames.back().head;
+    printf("frames       %zu, display frames %u-%u", c.frames.size(), a.frame, b.frame);
+    if (a.cycle && b.cycle && h.cpu_hz) {
+        printf(", %.2f s of CPU time", (double)(uint32_t)(b.cycle - a.cycle) / h.cpu_hz);
+    } else if (h.refresh_hz) {
+        printf(", %.2f s at %u Hz", (double)(b.frame - a.frame + 1) / h.refresh_hz, h.refresh_hz);
+    }
+    printf("\n");
+}
+
+static void cmd_stats(Capture& c, const Range& r) {
+    size_t first = c.lower(r.from);
+    uint64_t n = 0, redraws = 0, gaps = 0, points = 0, lit = 0, bad = 0;
+    uint32_t pmin = UINT32_MAX, pmax = 0;
+    uint32_t xmin = 1023, xmax = 0, ymin = 1023, ymax = 0;
+    uint64_t z_hist[16] = {};
+    uint32_t imin = UINT32_MAX, imax = 0, lists = 0;
+    uint64_t isum = 0;
+    const Frame* prev = nullptr;
+    const Frame* prev_list = nullptr;
+
+    for (size_t i = first; i < c.frames.size() && c.frames[i].head.frame <= r.to; i++) {
+        const Frame& f = c.frames[i];
+        const uint32_t* p = c.points(f);
+        if (vcap_check(f.head, p) != f.head.check) bad++;
+        n++;
+        points += f.head.count;
+        pmin = std::min<uint32_t>(pmin, f.head.count);
+        pmax = std::max<uint32_t>(pmax, f.head.count);
+        for (uint32_t k = 0; k < f.head.count; k++) {
+            uint8_t z = vpoint_z(p[k]);
+            z_hist[z]++;
+            if (!z) continue;
+            lit++;
+            xmin = std::min<uint32_t>(xmin, vpoint_x(p[k]));
+            xmax = std::max<uint32_t>(xmax, vpoint_x(p[k]));
+            ymin = std::min<uint32_t>(ymin, vpoint_y(p[k]));
+            ymax = std::max<uint32_t>(ymax, vpoint_y(p[k]));
+        }
+        if (prev && f.head.frame != prev->head.frame + 1) gaps++;
+        prev = &f;
+
+        if (f.head.flags & VCAP_FRAME_REDRAW) {
+            redraws++;
+            continue;
+        }
+        lists++;
+        if (prev_list && f.head.cycle && prev_list->head.cycle) {
+            uint32_t d = f.head.cycle - prev_list->head.cycle;
+            imin = std::min(imin, d);
+            imax = std::max(imax, d);
+            isum += d;
+        }
+        prev_list = &f;
+    }
+
+    if (!n) {
+        printf("no frames in range\n");
+        return;
+    }
+    printf("frames       %" PRIu64 " (%" PRIu64 " redraws, %u new lists), %" PRIu64 " gaps in numbering",
+           n, redraws, lists, gaps);
+    if (bad) printf(", %" PRIu64 " BAD CHECK", bad);
+    printf("\n");
+    printf("points       %" PRIu64 ", per frame min %u / avg %.1f / max %u, %.1f%% lit\n",
+           points, pmin, (double)points / n, pmax, points ? 100.0 * lit / points : 0.0);
+    if (lit) printf("lit extent   x %u-%u, y %u-%u (DVG 0-1023)\n", xmin, xmax, ymin, ymax);
+    if (isum && lists > 1 && c.hdr.cpu_hz) {
+        double ms = 1000.0 / c.hdr.cpu_hz;
+        printf("list period  min %.2f / avg %.2f / max %.2f ms\n",
+               imin * ms, (double)isum / (lists - 1) * ms, imax * ms);
+    }
+    printf("intensity   ");
+    for (int z = 0; z < 16; z++) {
+        if (z_hist[z]) printf(" %d:%" PRIu64, z, z_hist[z]);
+    }
+    printf("\n");
+}
+
+static void cmd_list(Capture& c, const Range& r) {
+    printf("frame,cycle,count,flags,offset\n");
+    for (size_t i = c.lower(r.from); i < c.frames.size() && c.frames[i].head.frame <= r.to; i++) {
+        const Frame& f = c.frames[i];
+        printf("%u,%u,%u,%u,%" PRIu64 "\n", f.head.frame, f.head.cycle, f.head.count, f.head.flags, f.offset);
+    }
+}
+
+static bool ends_with(const std::string& s, const char* ext) {
+    size_t n = strlen(ext);
+    return s.size() >= n && s.compare(s.size() - n, n, ext) == 0;
+}
+
+static int cmd_extract(Capture& c, const char* out, const Range& r) {
+    std::string name = out;
+    bool csv = ends_with(name, ".csv"), vcap = ends_with(name, ".vcap"), vci = ends_with(name, ".vci");
+    if (!csv && !vcap && !vci) {
+        fprintf(stderr, "%s: output must be .csv, .vcap or .vci\n", out);
+        return 1;
+    }
+
+    Writer w;
+    FILE* f = nullptr;
+    if (vci) {
+        if (!w.open(out, c.hdr)) return 1;
+    } else if (!(f = fopen(out, "wb"))) {
+        fprintf(stderr, "%s: cannot create\n", out);
+        return 1;
+    }
+    if (csv) fprintf(f, "frame,x,y,z,comment\n");
+
+    uint32_t count = 0, bad = 0;
+    for (size_t i = c.lower(r.from); i < c.frames.size() && c.frames[i].head.frame <= r.to; i++) {
+        const Frame& fr = c.frames[i];
+        const uint32_t* p = c.points(fr);
+        if (vcap_check(fr.head, p) != fr.head.check) {
+            bad++;  // Text inside the record; the index only vouches for its position
+            continue;
+        }
+        count++;
+        if (vci) {
+            w.frame(fr.head, p);
+        } else if (vcap) {
+            uint32_t h[2] = { fr.head.frame, fr.head.count };
+            fwrite(h, sizeof(h), 1, f);
+            fwrite(p, sizeof(uint32_t), fr.head.count, f);
+        } else {
+            for (uint32_t k = 0; k < fr.head.count; k++) {
+                fprintf(f, "%u,%u,%u,%u,\n", fr.head.frame, vpoint_x(p[k]) << 2,
+                        vpoint_y(p[k]) << 2, vpoint_z(p[k]) * 0x111);
+            }
+        }
+    }
+
+    bool ok = vci ? w.close() : (fclose(f) == 0);
+    printf("%u frames to %s", count, out);
+    if (bad) printf(", %u with bad check left out", bad);
+    printf("\n");
+    return ok ? 0 : 1;
+}
+
+// .vcap from vector_capture.py: u32 frame, u32 count, points
+static int cmd_convert(const char* in, const char* out, uint16_t hz) {
+    Capture src;
+    if (!src.open(in)) return 1;
+
+    // Frames that are complete, and the largest one for the header
+    uint64_t end = 0;
+    uint32_t max_points = 0;
+    while (end + 8 <= src.size) {
+        uint32_t count = get<uint32_t>(src.data + end + 4);
+        if (count > VCAP_MAX_POINTS || end + 8 + count * 4ull > src.size) {
+            fprintf(stderr, "%s: truncated or not a .vcap at byte %" PRIu64 "\n", in, end);
+            break;
+        }
+        max_points = std::max(max_points, count);
+        end += 8 + count * 4ull;
+    }
+
+    vcap_file_header h = {};
+    h.cpu_hz = 1512000;
+    h.refresh_hz = hz;
+    h.index_interval = 64;
+    h.max_points = max_points;
+
+    std::vector<uint32_t> points;
+    Writer w;
+    if (!w.open(out, h)) return 1;
+    for (uint64_t p = 0; p < end; ) {
+        uint32_t frame = get<uint32_t>(src.data + p);
+        uint32_t count = get<uint32_t>(src.data + p + 4);
+        points.resize(count);
+        memcpy(points.data(), src.data + p + 8, count * 4);
+        vcap_frame f = { frame, 0, (uint16_t)count, 0, 0, 0 };  // No cycles: paced by refresh_hz
+        w.frame(f, points.data());
+        p += 8 + count * 4ull;
+    }
+    uint32_t frames = w.frames;
+    bool ok = w.close();
+    printf("%u frames to %s\n", frames, out);
+    return ok ? 0 : 1;
+}
+
+static int usage() {
+    fprintf(stderr,
+            "usage: vcap_tool info    FILE.vci\n"
+            "       vcap_tool stats   FILE.vci [--from N] [--to M]\n"
+            "       vcap_tool list    FILE.vci [--from N] [--to M]\n"
+            "       vcap_tool extract FILE.vci OUT.csv|OUT.vcap|OUT.vci [--from N] [--to M]\n"
+            "       vcap_tool convert FILE.vcap OUT.vci [--hz N]\n");
+    return 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) return usage();
+    std::string cmd = argv[1];
+    std::vector<const char*> files;
+    Range range;
+    unsigned hz = 60;
+
+    for (int i = 2; i < argc; i++) {
+        std::string a = argv[i];
+        if ((a == "--from" || a == "--to" || a == "--hz") && i + 1 < argc) {
+            unsigned long v = strtoul(argv[++i], nullptr, 0);
+            if (a == "--from") range.from = v;
+            else if (a == "--to") range.to = v;
+            else hz = v ? v : 1;
+        } else if (a.compare(0, 2, "--") == 0) {
+            return usage();
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+
+    if (cmd == "convert") {
+        return files.size() == 2 ? cmd_convert(files[0], files[1], hz) : usage();
+    }
+
+    size_t want = (cmd == "extract") ? 2 : 1;
+    if (files.size() != want) return usage();
+    Capture c;
+    if (!c.open(files[0]) || !c.load()) return 1;
+
+    if (cmd == "info") cmd_info(c);
+    else if (cmd == "stats") cmd_stats(c, range);
+    else if (cmd == "list") cmd_list(c, range);
+    else if (cmd == "extract") return cmd_extract(c, files[1], range);
+    else return usage();
+    return 0;
+}
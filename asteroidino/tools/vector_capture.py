@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""
+vector_capture.py - Empfange Vector-Frames vom ESP32 über UDP (LOG_UDP)
+
+Verwendung:
+    python3 vector_capture.py session.vcap
+    python3 vector_capture.py session.csv --csv --port 5005
+    python3 vector_capture.py session.vcap --frames 3600
+
+Der Vector Logger schickt jeden angezeigten Frame als gepackte 32-Bit-
+Punkte (vector_point.h), delta-kodiert gegen den Vorframe; das Format
+steht in lib/vector_logger/vector_logger.h. Das Skript setzt die
+Datagramme wieder zusammen, dekodiert die Deltas und schreibt:
+
+    .vcap  (Standard) pro Frame: u32 Frame-Nummer, u32 Punktzahl,
+           dann die Punkte als u32, little endian
+    --csv  frame,x,y,z wie der CSV-Modus (12-bit Skala), lesbar für
+           analyze_vector_log.py
+
+Geht ein Datagramm verloren, fehlen Frames bis zum nächsten Key-Frame.
+Text-Datagramme (Profiler-Report, PROFILE_ENABLE) werden ausgegeben.
+Ctrl+C beendet die Aufnahme.
+"""
+
+import argparse
+import socket
+import struct
+import sys
+import time
+
+UDP_MAGIC = 0x31504356        # "VCP1"
+TEXT_MAGIC = 0x31585456       # "VTX1"
+HEADER = struct.Struct('<IIHBB')
+FRAME_HEADER = struct.Struct('<IHBB')
+FRAME_KEY = 0x01
+RUN_LITERAL = 0x8000
+
+
+def decode_frame(data, previous):
+    """Decode one encoded frame against the previous point list.
+    Returns (frame number, points), or None if it needs a missing reference"""
+    frame, count, flags, _ = FRAME_HEADER.unpack_from(data, 0)
+    if not (flags & FRAME_KEY) and previous is None:
+        return None
+
+    points = []
+    pos = FRAME_HEADER.size
+    while len(points) < count:
+        (run,) = struct.unpack_from('<H', data, pos)
+        pos += 2
+        n = run & 0x7FFF
+        if run & RUN_LITERAL:
+            points.extend(struct.unpack_from(f'<{n}I', data, pos))
+            pos += 4 * n
+        else:
+            start = len(points)
+            if start + n > len(previous):
+                return None
+            points.extend(previous[start:start + n])
+
+    return frame, points
+
+
+class Reassembler:
+    """Collect the datagrams of one frame (they arrive in order)"""
+
+    def __init__(self):
+        self.frame = None
+        self.parts = {}
+        self.length = 0
+        self.fragments = 0
+
+    def add(self, packet):
+        if len(packet) < HEADER.size:
+            return None
+        magic, frame, length, fragment, fragments = HEADER.unpack_from(packet, 0)
+        if magic != UDP_MAGIC:
+            return None
+
+        if frame != self.frame:
+            self.frame = frame
+            self.parts = {}
+            self.length = length
+            self.fragments = fragments
+        self.parts[fragment] = packet[HEADER.size:]
+
+        if len(self.parts) < self.fragments:
+            return None
+        data = b''.join(self.parts[i] for i in range(self.fragments))
+        self.frame = None
+        return data if len(data) == self.length else None
+
+
+def write_vcap(f, frame, points):
+    f.write(struct.pack('<II', frame, len(points)))
+    f.write(struct.pack(f'<{len(points)}I', *points))
+
+
+def write_csv(f, frame, points):
+    for p in points:
+        x = (p & 0x3FF) << 2
+        y = ((p >> 10) & 0x3FF) << 2
+        z = ((p >> 20) & 0x0F) * 0x111
+        f.write(f"{frame},{x},{y},{z},\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Receive LOG_UDP vector frames')
+    parser.add_argument('output', help='Output file (.vcap or, with --csv, CSV)')
+    parser.add_argument('--port', type=int, default=5005, help='UDP port (VECTOR_LOG_UDP_PORT)')
+    parser.add_argument('--csv', action='store_true', help='Write CSV instead of .vcap')
+    parser.add_argument('--frames', type=int, default=0, help='Stop after N frames (0 = Ctrl+C)')
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1 << 20)
+    sock.bind(('', args.port))
+    sock.settimeout(1.0)
+
+    out = open(args.output, 'w' if args.csv else 'wb')
+    if args.csv:
+        out.write("frame,x,y,z,comment\n")
+    write = write_csv if args.csv else write_vcap
+
+    print(f"Listening on UDP port {args.port}, writing {args.output} (Ctrl+C to stop)")
+
+    assembler = Reassembler()
+    previous = None
+    last_frame = None
+    frames = lost = points_total = bytes_total = 0
+    report = time.time()
+
+    try:
+        while not args.frames or frames < args.frames:
+            try:
+                packet, _ = sock.recvfrom(2048)
+            except socket.timeout:
+                continue
+            bytes_total += len(packet)
+            if len(packet) >= 4 and struct.unpack_from('<I', packet)[0] == TEXT_MAGIC:
+                print(packet[4:].decode('utf-8', 'replace'), end='')
+                continue
+
+            data = assembler.add(packet)
+            if data is None:
+                continue
+            # A delta only applies to the frame right before it
+            frame = FRAME_HEADER.unpack_from(data, 0)[0]
+            reference = previous if last_frame is not None and frame == last_frame + 1 else None
+            decoded = decode_frame(data, reference)
+            if decoded is None:
+                continue          # Wait for the next key frame
+
+            frame, points = decoded
+            if last_frame is not None and frame != last_frame + 1:
+                lost += max(0, frame - last_frame - 1)
+            last_frame = frame
+            previous = points
+
+            write(out, frame, points)
+            frames += 1
+            points_total += len(points)
+
+            now = time.time()
+            if now - report >= 2.0:
+                print(f"{frames} frames, {points_total / frames:.0f} points/frame, "
+                      f"{bytes_total * 8 / (now - report) / 1000:.0f} kbit/s, {lost} lost")
+                report = now
+                bytes_total = 0
+    except KeyboardInterrupt:
+        pass
+
+    out.close()
+    print(f"\nDone: {frames} frames, {points_total} points, {lost} frames lost")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())